@@ -450,6 +450,23 @@ typedef struct SDL_AudioSpec
  */
 typedef struct SDL_AudioStream SDL_AudioStream;
 
+/**
+ * The quality of the resampler used by an audio stream.
+ *
+ * Higher quality costs more CPU time per sample frame, and the high quality
+ * resampler also delays output by a few more sample frames.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER
+ */
+typedef enum SDL_AudioResampleQuality
+{
+    SDL_AUDIO_RESAMPLE_QUALITY_LOW,     /**< Linear interpolation. Cheap, but dulls high frequencies and aliases. Suited to voice chat and large numbers of sound effects. */
+    SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM,  /**< A short windowed sinc filter. This is the default. */
+    SDL_AUDIO_RESAMPLE_QUALITY_HIGH     /**< A long windowed sinc filter, which also filters out frequencies above the new Nyquist frequency when downsampling. Suited to music and offline conversion. */
+} SDL_AudioResampleQuality;
+
 
 /* Function prototypes */
 
@@ -1077,6 +1094,14 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
  *   be cleaned up. Streams that are not cleaned up will still be unbound from
  *   devices when the audio subsystem quits. This property was added in SDL
  *   3.4.0.
+ * - `SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER`: an SDL_AudioResampleQuality
+ *   value for the resampler used when the input and output sample rates
+ *   differ. Defaults to SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM. This is checked
+ *   each time data is read from the stream, so it can be changed at any time.
+ *   This property was added in SDL 3.4.0.
+ * - `SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER`: the number of sample frames in
+ *   a .WAV file opened with SDL_OpenWAVStream_IO(). This property was added
+ *   in SDL 3.4.0.
  *
  * \param stream the SDL_AudioStream to query.
  * \returns a valid property ID on success or 0 on failure; call
@@ -1089,6 +1114,8 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioStreamProperties(SDL_AudioStream *stream);
 
 #define SDL_PROP_AUDIOSTREAM_AUTO_CLEANUP_BOOLEAN "SDL.audiostream.auto_cleanup"
+#define SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER "SDL.audiostream.resample_quality"
+#define SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER "SDL.audiostream.wav.frames"
 
 
 /**
@@ -1658,6 +1685,41 @@ extern SDL_DECLSPEC int SDLCALL SDL_GetAudioStreamAvailable(SDL_AudioStream *str
 extern SDL_DECLSPEC int SDLCALL SDL_GetAudioStreamQueued(SDL_AudioStream *stream);
 
 
+/**
+ * Let one thread put data into an audio stream without ever waiting on the
+ * thread reading from it.
+ *
+ * Normally, putting data into a stream holds the same lock that the audio
+ * device thread needs to read from it, so a busy or preempted producer can
+ * make the device wait. After this call, data is instead copied into a
+ * preallocated ring buffer of at least `buffer_size` bytes, which the reader
+ * picks up without allocating or waiting on the producer. If the ring doesn't
+ * have room for all of the data, the put fails and nothing is added, so the
+ * producer should try again after some of it has been played. A single put
+ * can't be larger than the ring.
+ *
+ * Only one thread may put data into the stream, flush it, or change its
+ * input format or channel map once this has been called, and it should be
+ * called before that thread starts. The stream's put callback isn't called
+ * for data added this way. If the stream's get callback puts data, it must
+ * be the only thread that does. This can't be turned off again, and can only
+ * be called once per stream.
+ *
+ * \param stream the audio stream to change.
+ * \param buffer_size the size of the ring buffer, in bytes.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but see
+ *               above for the threads that may use the stream afterwards.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_FlushAudioStream
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamSingleProducer(SDL_AudioStream *stream, int buffer_size);
+
 /**
  * Tell the stream that you're done sending data, and anything being buffered
  * should be converted/resampled and made available immediately.
@@ -2243,6 +2305,96 @@ extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len);
 
+/**
+ * Open a WAVE file as an audio stream that decodes it as it plays.
+ *
+ * Unlike SDL_LoadWAV_IO(), this only reads the file's header up front. The
+ * audio data is read and decoded a block at a time, from the stream's get
+ * callback, as the stream needs more of it. This keeps memory use small
+ * and constant no matter how long the file is, and audio can start
+ * playing right away. The same formats as SDL_LoadWAV_IO() are supported,
+ * and the same hints apply.
+ *
+ * The stream's input format is set to the decoded format of the file, and
+ * its output format to `dst_spec`. Bind it to an audio device, or call
+ * SDL_GetAudioStreamData() on it, to get the audio. The stream is flushed
+ * once the end of the file is reached. Use SDL_SeekWAVStream() to move
+ * around in the file, and the stream's
+ * `SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER` property to find its length.
+ *
+ * Don't replace the stream's get callback, it's what does the decoding.
+ *
+ * Since the data is read from the thread reading from the stream (the audio
+ * device thread, when the stream is bound to a device), `src` should be
+ * quick to read from, and must not be used by anything else until the
+ * stream is destroyed. An I/O error ends the audio early. It is required
+ * that the data source supports seeking.
+ *
+ * \param src the data source for the WAVE data.
+ * \param closeio if true, calls SDL_CloseIO() on `src` when the stream is
+ *                destroyed, or before returning in the case of an error.
+ * \param dst_spec the format details of the stream's output, or NULL to
+ *                 output the data in the format it's decoded to.
+ * \returns a new audio stream on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_LoadWAV_IO
+ * \sa SDL_OpenWAVStream
+ * \sa SDL_SeekWAVStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_OpenWAVStream_IO(SDL_IOStream *src, bool closeio, const SDL_AudioSpec *dst_spec);
+
+/**
+ * Open a WAVE file from a file path as an audio stream that decodes it as it
+ * plays.
+ *
+ * This is a convenience function that is effectively the same as:
+ *
+ * ```c
+ * SDL_OpenWAVStream_IO(SDL_IOFromFile(path, "rb"), true, dst_spec);
+ * ```
+ *
+ * \param path the file path of the WAV file to open.
+ * \param dst_spec the format details of the stream's output, or NULL to
+ *                 output the data in the format it's decoded to.
+ * \returns a new audio stream on success, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_OpenWAVStream_IO
+ * \sa SDL_SeekWAVStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_OpenWAVStream(const char *path, const SDL_AudioSpec *dst_spec);
+
+/**
+ * Move to a different sample frame in a WAVE file opened as an audio stream.
+ *
+ * Anything already queued in the stream is cleared, and decoding continues
+ * from `frame`. Seeking past the end of the file ends the audio.
+ *
+ * \param stream an audio stream from SDL_OpenWAVStream_IO().
+ * \param frame the sample frame to continue from, counting from zero.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_OpenWAVStream_IO
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SeekWAVStream(SDL_AudioStream *stream, Sint64 frame);
+
 /**
  * Mix audio data in a specified format.
  *
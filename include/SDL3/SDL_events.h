@@ -1358,10 +1358,39 @@ extern SDL_DECLSPEC bool SDLCALL SDL_WaitEventTimeout(SDL_Event *event, Sint32 t
  *
  * \sa SDL_PeepEvents
  * \sa SDL_PollEvent
+ * \sa SDL_PushEvents
  * \sa SDL_RegisterEvents
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_PushEvent(SDL_Event *event);
 
+/**
+ * Add several events to the event queue at once.
+ *
+ * This behaves like calling SDL_PushEvent() on each event in turn, but the
+ * event filter and event watchers are run over the whole batch in one pass,
+ * the events are added to the queue in a single operation, and the thread
+ * waiting for events is only woken up once. This is much cheaper than
+ * pushing a large number of events one at a time.
+ *
+ * Events with a timestamp of 0 are given the current time. Events rejected
+ * by the event filter are removed from `events`, and the remaining events are
+ * moved to the front of the array, in their original order.
+ *
+ * \param events an array of events to be added to the queue.
+ * \param numevents the number of events in `events`.
+ * \returns the number of events added to the queue, which is less than
+ *          `numevents` if some of them were filtered out or the queue is
+ *          full, or -1 on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_PeepEvents
+ * \sa SDL_PushEvent
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_PushEvents(SDL_Event *events, int numevents);
+
 /**
  * A function pointer used for callbacks that watch the event queue.
  *
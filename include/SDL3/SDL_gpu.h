@@ -2242,6 +2242,13 @@ extern SDL_DECLSPEC SDL_GPUDevice * SDLCALL SDL_CreateGPUDevice(
  *   useful debug information on device creation, defaults to true.
  * - `SDL_PROP_GPU_DEVICE_CREATE_NAME_STRING`: the name of the GPU driver to
  *   use, if a specific one is desired.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_POINTER`: pipeline cache data
+ *   previously returned by SDL_GetGPUPipelineCacheData(), to speed up
+ *   pipeline creation. It is ignored if it came from a different device or
+ *   driver version, or is damaged. The data only needs to stay valid until
+ *   this function returns. Currently only used by the Vulkan backend.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_SIZE_NUMBER`: the size in bytes
+ *   of `SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_POINTER`.
  *
  * These are the current shader format properties:
  *
@@ -2308,6 +2315,8 @@ extern SDL_DECLSPEC SDL_GPUDevice * SDLCALL SDL_CreateGPUDeviceWithProperties(
 #define SDL_PROP_GPU_DEVICE_CREATE_PREFERLOWPOWER_BOOLEAN                   "SDL.gpu.device.create.preferlowpower"
 #define SDL_PROP_GPU_DEVICE_CREATE_VERBOSE_BOOLEAN                          "SDL.gpu.device.create.verbose"
 #define SDL_PROP_GPU_DEVICE_CREATE_NAME_STRING                              "SDL.gpu.device.create.name"
+#define SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_POINTER                    "SDL.gpu.device.create.pipelinecache"
+#define SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_SIZE_NUMBER                "SDL.gpu.device.create.pipelinecache.size"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_PRIVATE_BOOLEAN                  "SDL.gpu.device.create.shaders.private"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_SPIRV_BOOLEAN                    "SDL.gpu.device.create.shaders.spirv"
 #define SDL_PROP_GPU_DEVICE_CREATE_SHADERS_DXBC_BOOLEAN                     "SDL.gpu.device.create.shaders.dxbc"
@@ -2492,6 +2501,33 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetGPUDeviceProperties(SDL_GPUD
 #define SDL_PROP_GPU_DEVICE_DRIVER_VERSION_STRING     "SDL.gpu.device.driver_version"
 #define SDL_PROP_GPU_DEVICE_DRIVER_INFO_STRING        "SDL.gpu.device.driver_info"
 
+/**
+ * Get the contents of a GPU device's pipeline cache.
+ *
+ * The pipeline cache holds the results of compiling the pipelines created
+ * so far. Save this data when the app exits and pass it back with
+ * `SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_POINTER` the next time the
+ * device is created, so those pipelines don't need to be compiled again.
+ *
+ * The data is only useful to the same device with the same driver version;
+ * SDL checks this and ignores data that doesn't match, so it is safe to
+ * keep using a cache after a driver update.
+ *
+ * \param device a GPU context to query.
+ * \param size a pointer filled in with the number of bytes returned, may be
+ *             NULL.
+ * \returns the pipeline cache data on success or NULL on failure; call
+ *          SDL_GetError() for more information. This should be freed with
+ *          SDL_free() when it is no longer needed.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUDeviceWithProperties
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_GetGPUPipelineCacheData(SDL_GPUDevice *device, size_t *size);
+
 
 /* State Creation */
 
@@ -322,6 +322,33 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_APP_ICON_NAME "SDL_AUDIO_DEVICE_APP_ICON_NAME"
 
+/**
+ * A variable controlling how many threads may be used to mix audio streams
+ * bound to a playback device.
+ *
+ * This hint is an integer. When it is greater than 1, SDL creates up to that
+ * many threads in total (the device's audio thread plus helpers, limited by
+ * the number of CPU cores) and, when a logical device has several streams
+ * bound to it, converts and resamples those streams in parallel before
+ * summing them. This helps when an app binds many streams to one device, at
+ * the cost of some extra threads and scratch memory per device. Values above
+ * 16 are treated as 16.
+ *
+ * When streams are mixed in parallel, their get callbacks (see
+ * SDL_SetAudioStreamGetCallback) are called from the helper threads as well
+ * as the device's audio thread, and callbacks of different streams bound to
+ * the same device can run at the same time. Callbacks that share data with
+ * each other need to do their own locking.
+ *
+ * The default is 0, which mixes every stream on the device's audio thread,
+ * one after another.
+ *
+ * This hint should be set before an audio device is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_AUDIO_DEVICE_MIX_THREADS "SDL_AUDIO_DEVICE_MIX_THREADS"
+
 /**
  * A variable controlling device buffer size.
  *
@@ -641,6 +668,8 @@ extern "C" {
  * - "neon"
  * - "lsx"
  * - "lasx"
+ * - "pclmul"
+ * - "arm-crc32"
  *
  * The items can be prefixed by '+'/'-' to add/remove features.
  *
@@ -836,6 +865,27 @@ extern "C" {
  */
 #define SDL_HINT_EVENT_LOGGING "SDL_EVENT_LOGGING"
 
+/**
+ * A variable controlling whether the event queue uses a lock-free ring for
+ * incoming events.
+ *
+ * When enabled, SDL_PushEvent() and SDL_PeepEvents() with SDL_ADDEVENT can
+ * add most events to the queue without taking the queue lock, which helps
+ * when several threads push events at a high rate. Events that carry
+ * temporary memory, and events pushed while the ring is full, still go
+ * through the regular queue, and event order is preserved either way.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Events are always added to the queue under its lock. (default)
+ * - "1": Events are added through a lock-free ring when possible.
+ *
+ * This hint should be set before SDL is initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_EVENT_QUEUE_LOCKFREE "SDL_EVENT_QUEUE_LOCKFREE"
+
 /**
  * A variable controlling whether raising the window should be done more
  * forcefully.
@@ -3148,6 +3198,26 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_METAL_PREFER_LOW_POWER_DEVICE "SDL_RENDER_METAL_PREFER_LOW_POWER_DEVICE"
 
+/**
+ * A variable controlling how many threads the software renderer uses to draw.
+ *
+ * This hint is an integer. When it is greater than 1, the software renderer
+ * splits its render target into tiles and draws each batch of queued
+ * commands on up to that many threads in total (the rendering thread plus a
+ * pool of helpers owned by the renderer). Commands that can't be split
+ * exactly, like lines, scaled and rotated copies, are drawn on the rendering
+ * thread in order with the rest, so the output is identical to drawing on a
+ * single thread. Values larger than the number of CPU cores are unlikely to
+ * help.
+ *
+ * The default is 0, which draws everything on the rendering thread.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS "SDL_RENDER_SOFTWARE_THREADS"
+
 /**
  * A variable controlling whether updates to the SDL screen surface should be
  * synchronized with the vertical refresh, to avoid tearing.
@@ -3333,6 +3403,30 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling how many threads may be used for large software
+ * surface blits.
+ *
+ * This hint is an integer. When it is greater than 1, unscaled blits done
+ * with SDL_BlitSurface(), SDL_ConvertSurface(), SDL_ConvertPixels() and
+ * related functions that cover a large area are split into horizontal bands
+ * and run on up to that many threads in total (the calling thread plus a
+ * shared pool of helpers). This helps when converting or compositing very
+ * large surfaces, which is otherwise limited by what a single core can do.
+ * Values larger than the number of CPU cores are unlikely to help.
+ *
+ * Scaled blits, blits that look up the nearest color in a palette and blits
+ * within a single surface where the source and destination overlap always run
+ * on the calling thread.
+ *
+ * The default is 0, which runs every blit on the calling thread.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_SURFACE_BLIT_THREADS "SDL_SURFACE_BLIT_THREADS"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as
  * realtime.
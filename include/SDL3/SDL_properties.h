@@ -65,6 +65,22 @@ extern "C" {
  */
 typedef Uint32 SDL_PropertiesID;
 
+/**
+ * An interned property name.
+ *
+ * An atom stands for a property name in every group of properties, and
+ * looking a property up by atom skips hashing and comparing the name. Get an
+ * atom once with SDL_GetPropertyAtom() and then use it with
+ * SDL_GetPointerPropertyByAtom() and the other `ByAtom` functions.
+ *
+ * Atoms are valid until SDL_Quit() is called.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyAtom
+ */
+typedef Uint32 SDL_PropertyAtom;
+
 /**
  * SDL property type
  *
@@ -467,6 +483,155 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetFloatProperty(SDL_PropertiesID props, c
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value);
 
+/**
+ * Get the atom for a property name.
+ *
+ * The atom can be used to query that property in any group of properties,
+ * which is faster than passing the name every time. The same name always
+ * gives the same atom, until SDL_Quit() is called.
+ *
+ * Only names passed to this function get atoms, and they are kept until
+ * SDL_Quit() is called, so this is meant for a fixed set of names that are
+ * looked up often, not names made up at run time. SDL keeps track of up to
+ * 1048576 of them, after which this fails for new names. Setting properties
+ * is not affected by this limit.
+ *
+ * \param name the name of the property.
+ * \returns the atom for `name`, or 0 on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetBooleanPropertyByAtom
+ * \sa SDL_GetFloatPropertyByAtom
+ * \sa SDL_GetNumberPropertyByAtom
+ * \sa SDL_GetPointerPropertyByAtom
+ * \sa SDL_GetStringPropertyByAtom
+ */
+extern SDL_DECLSPEC SDL_PropertyAtom SDLCALL SDL_GetPropertyAtom(const char *name);
+
+/**
+ * Get a pointer property from a group of properties, using an atom for the
+ * name.
+ *
+ * This works like SDL_GetPointerProperty().
+ *
+ * \param props the properties to query.
+ * \param atom the atom for the name of the property to query, from
+ *             SDL_GetPropertyAtom().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a pointer property.
+ *
+ * \threadsafety It is safe to call this function from any thread, although
+ *               the data returned is not protected and could potentially be
+ *               freed if you call SDL_SetPointerProperty() or
+ *               SDL_ClearProperty() on these properties from another thread.
+ *               If you need to avoid this, use SDL_LockProperties() and
+ *               SDL_UnlockProperties().
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPointerProperty
+ * \sa SDL_GetPropertyAtom
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_GetPointerPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, void *default_value);
+
+/**
+ * Get a string property from a group of properties, using an atom for the
+ * name.
+ *
+ * This works like SDL_GetStringProperty().
+ *
+ * \param props the properties to query.
+ * \param atom the atom for the name of the property to query, from
+ *             SDL_GetPropertyAtom().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a string property.
+ *
+ * \threadsafety It is safe to call this function from any thread, although
+ *               the data returned is not protected and could potentially be
+ *               freed if you call SDL_SetStringProperty() or
+ *               SDL_ClearProperty() on these properties from another thread.
+ *               If you need to avoid this, use SDL_LockProperties() and
+ *               SDL_UnlockProperties().
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyAtom
+ * \sa SDL_GetStringProperty
+ */
+extern SDL_DECLSPEC const char * SDLCALL SDL_GetStringPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *default_value);
+
+/**
+ * Get a number property from a group of properties, using an atom for the
+ * name.
+ *
+ * This works like SDL_GetNumberProperty().
+ *
+ * \param props the properties to query.
+ * \param atom the atom for the name of the property to query, from
+ *             SDL_GetPropertyAtom().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a number property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetNumberProperty
+ * \sa SDL_GetPropertyAtom
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetNumberPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, Sint64 default_value);
+
+/**
+ * Get a floating point property from a group of properties, using an atom
+ * for the name.
+ *
+ * This works like SDL_GetFloatProperty().
+ *
+ * \param props the properties to query.
+ * \param atom the atom for the name of the property to query, from
+ *             SDL_GetPropertyAtom().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a float property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetFloatProperty
+ * \sa SDL_GetPropertyAtom
+ */
+extern SDL_DECLSPEC float SDLCALL SDL_GetFloatPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, float default_value);
+
+/**
+ * Get a boolean property from a group of properties, using an atom for the
+ * name.
+ *
+ * This works like SDL_GetBooleanProperty().
+ *
+ * \param props the properties to query.
+ * \param atom the atom for the name of the property to query, from
+ *             SDL_GetPropertyAtom().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a boolean property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetBooleanProperty
+ * \sa SDL_GetPropertyAtom
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetBooleanPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, bool default_value);
+
 /**
  * Clear a property from a group of properties.
  *
@@ -464,6 +464,38 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetRendererName(SDL_Renderer *rende
  *   enabled, this will be 1.0. This property can change dynamically when
  *   SDL_EVENT_WINDOW_HDR_STATE_CHANGED is sent.
  *
+ * These properties are updated by SDL_RenderPresent() and describe the frame
+ * it just presented:
+ *
+ * - `SDL_PROP_RENDERER_STATS_COMMANDS_NUMBER`: the number of commands queued
+ *   for the frame, including drawing and state changes.
+ * - `SDL_PROP_RENDERER_STATS_DRAW_COMMANDS_NUMBER`: the number of drawing
+ *   operations queued for the frame.
+ * - `SDL_PROP_RENDERER_STATS_MERGED_DRAW_COMMANDS_NUMBER`: the number of those
+ *   drawing operations that were joined with the one before them, so the
+ *   renderer drew them together.
+ * - `SDL_PROP_RENDERER_STATS_DROPPED_STATE_COMMANDS_NUMBER`: the number of
+ *   draw color, viewport and clip rectangle changes that were skipped because
+ *   they were overridden or didn't change anything.
+ * - `SDL_PROP_RENDERER_STATS_DRAW_CALLS_NUMBER`: the number of draw calls the
+ *   rendering driver made. The software renderer counts each drawing
+ *   operation it carries out.
+ * - `SDL_PROP_RENDERER_STATS_STATE_CHANGES_NUMBER`: the number of draw color,
+ *   viewport and clip rectangle changes sent to the rendering driver, plus
+ *   the number of times the texture, blend mode, texture sampling or GPU
+ *   render state changed between draws. These are the changes that keep
+ *   draws from being joined together.
+ * - `SDL_PROP_RENDERER_STATS_VERTEX_BYTES_NUMBER`: the number of bytes of
+ *   vertex data queued for the rendering driver.
+ * - `SDL_PROP_RENDERER_STATS_TEXTURE_UPLOADS_NUMBER`: the number of times
+ *   texture pixels were sent to the rendering driver with
+ *   SDL_UpdateTexture(), SDL_UpdateYUVTexture(), SDL_UpdateNVTexture() or
+ *   SDL_UnlockTexture().
+ * - `SDL_PROP_RENDERER_STATS_FORCED_FLUSHES_NUMBER`: the number of times
+ *   rendering had to be sent to the rendering driver before the end of the
+ *   frame, because a texture or GPU render state used by queued drawing was
+ *   about to change or be destroyed.
+ *
  * With the direct3d renderer:
  *
  * - `SDL_PROP_RENDERER_D3D9_DEVICE_POINTER`: the IDirect3DDevice9 associated
@@ -528,6 +560,15 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetRendererProperties(SDL_Rende
 #define SDL_PROP_RENDERER_HDR_ENABLED_BOOLEAN                       "SDL.renderer.HDR_enabled"
 #define SDL_PROP_RENDERER_SDR_WHITE_POINT_FLOAT                     "SDL.renderer.SDR_white_point"
 #define SDL_PROP_RENDERER_HDR_HEADROOM_FLOAT                        "SDL.renderer.HDR_headroom"
+#define SDL_PROP_RENDERER_STATS_COMMANDS_NUMBER                     "SDL.renderer.stats.commands"
+#define SDL_PROP_RENDERER_STATS_DRAW_COMMANDS_NUMBER                "SDL.renderer.stats.draw_commands"
+#define SDL_PROP_RENDERER_STATS_MERGED_DRAW_COMMANDS_NUMBER         "SDL.renderer.stats.merged_draw_commands"
+#define SDL_PROP_RENDERER_STATS_DROPPED_STATE_COMMANDS_NUMBER       "SDL.renderer.stats.dropped_state_commands"
+#define SDL_PROP_RENDERER_STATS_DRAW_CALLS_NUMBER                   "SDL.renderer.stats.draw_calls"
+#define SDL_PROP_RENDERER_STATS_STATE_CHANGES_NUMBER                "SDL.renderer.stats.state_changes"
+#define SDL_PROP_RENDERER_STATS_VERTEX_BYTES_NUMBER                 "SDL.renderer.stats.vertex_bytes"
+#define SDL_PROP_RENDERER_STATS_TEXTURE_UPLOADS_NUMBER              "SDL.renderer.stats.texture_uploads"
+#define SDL_PROP_RENDERER_STATS_FORCED_FLUSHES_NUMBER               "SDL.renderer.stats.forced_flushes"
 #define SDL_PROP_RENDERER_D3D9_DEVICE_POINTER                       "SDL.renderer.d3d9.device"
 #define SDL_PROP_RENDERER_D3D11_DEVICE_POINTER                      "SDL.renderer.d3d11.device"
 #define SDL_PROP_RENDERER_D3D11_SWAPCHAIN_POINTER                   "SDL.renderer.d3d11.swap_chain"
@@ -2231,6 +2272,47 @@ extern SDL_DECLSPEC bool SDLCALL SDL_RenderTextureAffine(SDL_Renderer *renderer,
                                                      const SDL_FRect *srcrect, const SDL_FPoint *origin,
                                                      const SDL_FPoint *right, const SDL_FPoint *down);
 
+/**
+ * Copy portions of a texture to the current rendering target many times, at
+ * subpixel precision.
+ *
+ * This draws the same thing as calling SDL_RenderTextureRotated() once for
+ * each copy, with a NULL center, but it is much faster when drawing lots of
+ * sprites from the same texture, because most renderers can draw the whole
+ * batch at once.
+ *
+ * Each copy is modulated by the texture color and alpha, and drawn with the
+ * texture blend mode and scale mode, as with SDL_RenderTexture().
+ *
+ * \param renderer the renderer which should copy parts of a texture.
+ * \param texture the source texture.
+ * \param srcrects an array of `count` source rectangles, or NULL to copy the
+ *                 entire texture each time.
+ * \param dstrects an array of `count` destination rectangles.
+ * \param colors an array of `count` colors to multiply with the texture color
+ *               and alpha for each copy, or NULL to use the texture color
+ *               and alpha as-is.
+ * \param angles an array of `count` angles in degrees, each rotating its copy
+ *               clockwise around the center of its destination rectangle, or
+ *               NULL to draw without rotation.
+ * \param flips an array of `count` SDL_FlipMode values, or NULL to draw
+ *              without flipping.
+ * \param count the number of copies to draw.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety You may only call this function from the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderTexture
+ * \sa SDL_RenderTextureRotated
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RenderTextureBatch(SDL_Renderer *renderer, SDL_Texture *texture,
+                                                    const SDL_FRect *srcrects, const SDL_FRect *dstrects,
+                                                    const SDL_FColor *colors, const double *angles,
+                                                    const SDL_FlipMode *flips, int count);
+
 /**
  * Tile a portion of the texture to the current rendering target at subpixel
  * precision.
@@ -2912,6 +2994,227 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderGPUState(SDL_Renderer *renderer, S
  */
 extern SDL_DECLSPEC void SDLCALL SDL_DestroyGPURenderState(SDL_GPURenderState *state);
 
+/**
+ * A list of render commands that can be recorded on another thread.
+ *
+ * A command list has its own command queue and vertex data, and its own copy
+ * of the renderer's view state, so several threads can each record into
+ * their own list at the same time. The thread that uses the renderer then
+ * submits the lists in the order they should be drawn.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateRenderCommandList
+ * \sa SDL_SubmitRenderCommandList
+ */
+typedef struct SDL_RenderCommandList SDL_RenderCommandList;
+
+/**
+ * Create a list of render commands that can be recorded on another thread.
+ *
+ * The list starts with a copy of the renderer's current render target,
+ * viewport, clip rectangle, scale, draw color, draw blend mode and texture
+ * address modes. Commands recorded into the list use that state, no matter
+ * what happens to the renderer while they are recorded. Custom GPU render
+ * state isn't copied.
+ *
+ * Not every renderer supports command lists.
+ *
+ * The list must be destroyed before the renderer.
+ *
+ * \param renderer the rendering context.
+ * \returns a new command list or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyRenderCommandList
+ * \sa SDL_ResetRenderCommandList
+ * \sa SDL_SubmitRenderCommandList
+ */
+extern SDL_DECLSPEC SDL_RenderCommandList * SDLCALL SDL_CreateRenderCommandList(SDL_Renderer *renderer);
+
+/**
+ * Discard everything recorded in a command list and copy the renderer's state
+ * again.
+ *
+ * \param list the command list to reset.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread, while
+ *               no other thread is recording into the list.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateRenderCommandList
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ResetRenderCommandList(SDL_RenderCommandList *list);
+
+/**
+ * Set the color used for drawing operations recorded into a command list.
+ *
+ * \param list the command list to modify.
+ * \param r the red value used to draw on the rendering target.
+ * \param g the green value used to draw on the rendering target.
+ * \param b the blue value used to draw on the rendering target.
+ * \param a the alpha value used to draw on the rendering target.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               only one thread uses the list at a time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetRenderDrawColorFloat
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderCommandListDrawColorFloat(SDL_RenderCommandList *list, float r, float g, float b, float a);
+
+/**
+ * Set the blend mode used for drawing operations recorded into a command
+ * list.
+ *
+ * \param list the command list to modify.
+ * \param blendMode the SDL_BlendMode to use for blending.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               only one thread uses the list at a time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetRenderDrawBlendMode
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetRenderCommandListDrawBlendMode(SDL_RenderCommandList *list, SDL_BlendMode blendMode);
+
+/**
+ * Record filling some number of rectangles into a command list.
+ *
+ * This draws the same as SDL_RenderFillRects() would, using the draw color
+ * and blend mode of the list.
+ *
+ * \param list the command list to record into.
+ * \param rects a pointer to an array of destination rectangles.
+ * \param count the number of rectangles.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               only one thread uses the list at a time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderFillRects
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RecordRenderFillRects(SDL_RenderCommandList *list, const SDL_FRect *rects, int count);
+
+/**
+ * Record copying a portion of a texture into a command list.
+ *
+ * This draws the same as SDL_RenderTexture() would. The texture's color, alpha
+ * and blend mode are read when the copy is recorded.
+ *
+ * The texture must not be changed or destroyed while the list is being
+ * recorded, or before the list has been submitted and presented.
+ *
+ * \param list the command list to record into.
+ * \param texture the source texture.
+ * \param srcrect a pointer to the source rectangle, or NULL for the entire
+ *                texture.
+ * \param dstrect a pointer to the destination rectangle, or NULL for the
+ *                entire rendering target.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               only one thread uses the list at a time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderTexture
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RecordRenderTexture(SDL_RenderCommandList *list, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FRect *dstrect);
+
+/**
+ * Record a list of triangles into a command list.
+ *
+ * This draws the same as SDL_RenderGeometry() would, except that the software
+ * renderer always draws the triangles, even when they could be drawn as
+ * rectangles.
+ *
+ * The texture must not be changed or destroyed while the list is being
+ * recorded, or before the list has been submitted and presented.
+ *
+ * \param list the command list to record into.
+ * \param texture (optional) The SDL texture to use.
+ * \param vertices vertices.
+ * \param num_vertices number of vertices.
+ * \param indices (optional) An array of integer indices into the 'vertices'
+ *                array, if NULL all vertices will be rendered in sequential
+ *                order.
+ * \param num_indices number of indices.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               only one thread uses the list at a time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_RenderGeometry
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RecordRenderGeometry(SDL_RenderCommandList *list,
+                                               SDL_Texture *texture,
+                                               const SDL_Vertex *vertices, int num_vertices,
+                                               const int *indices, int num_indices);
+
+/**
+ * Add the commands recorded in a command list to the renderer.
+ *
+ * The commands are drawn after everything already queued on the renderer, and
+ * before anything queued after this call. Submitting lists in a fixed order
+ * draws the same every time, no matter which threads recorded them or when.
+ *
+ * Afterwards the list is empty and can be recorded into again. It keeps its
+ * view state, draw color and blend mode.
+ *
+ * The renderer must have the same render target as when the list was created
+ * or last reset.
+ *
+ * \param list the command list to submit.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called on the main thread, while
+ *               no other thread is recording into the list.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateRenderCommandList
+ * \sa SDL_RenderPresent
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitRenderCommandList(SDL_RenderCommandList *list);
+
+/**
+ * Destroy a command list.
+ *
+ * Anything recorded into the list that hasn't been submitted is discarded.
+ *
+ * \param list the command list to destroy.
+ *
+ * \threadsafety This function should only be called on the main thread, while
+ *               no other thread is recording into the list.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateRenderCommandList
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyRenderCommandList(SDL_RenderCommandList *list);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
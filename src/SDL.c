@@ -675,6 +675,7 @@ void SDL_Quit(void)
 
     SDL_QuitTimers();
     SDL_QuitAsyncIO();
+    SDL_QuitBlit();
 
     SDL_SetObjectsInvalid();
     SDL_AssertionsQuit();
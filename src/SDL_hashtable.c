@@ -20,57 +20,184 @@
 */
 #include "SDL_internal.h"
 
+/* This is an open addressing table in the style of "Swiss tables".
+ *
+ * Every slot has a control byte: either EMPTY, DELETED, or the low 7 bits of
+ * the item's hash. Lookups load a whole group of control bytes at once and
+ * compare them all against the hash fragment, using SIMD where available, so
+ * keys are only compared for likely matches. The control bytes are kept apart
+ * from the items, so probing only touches the control bytes, and a lookup
+ * usually touches a single item. Keys and values stay together, since a hit
+ * needs both. The full hashes are kept in a third array that is only used
+ * when the table is resized, so keys never have to be hashed again.
+ */
+
+#if defined(SDL_SSE2_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define HASHTABLE_SSE2
+#define GROUP_WIDTH 16
+#elif defined(SDL_NEON_INTRINSICS) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define HASHTABLE_NEON
+#define GROUP_WIDTH 8
+#else
+#define GROUP_WIDTH 8
+#endif
+
+#define CTRL_EMPTY   0x80
+#define CTRL_DELETED 0xFE
+
+// Anything larger than this will cause integer overflows
+#define MAX_HASHTABLE_SIZE (0x80000000u / 32)
+
 typedef struct SDL_HashItem
 {
-    // TODO: Splitting off values into a separate array might be more cache-friendly
     const void *key;
     const void *value;
-    Uint32 hash;
-    Uint32 probe_len : 31;
-    Uint32 live : 1;
 } SDL_HashItem;
 
-// Must be a power of 2 >= sizeof(SDL_HashItem)
-#define MAX_HASHITEM_SIZEOF 32u
-SDL_COMPILE_TIME_ASSERT(sizeof_SDL_HashItem, sizeof(SDL_HashItem) <= MAX_HASHITEM_SIZEOF);
-
-// Anything larger than this will cause integer overflows
-#define MAX_HASHTABLE_SIZE (0x80000000u / (MAX_HASHITEM_SIZEOF))
-
 struct SDL_HashTable
 {
     SDL_RWLock *lock;  // NULL if not created threadsafe
-    SDL_HashItem *table;
+    Uint8 *ctrl;       // capacity + GROUP_WIDTH bytes, the last group mirrors the first
+    SDL_HashItem *items;
+    Uint32 *hashes;
+    Uint32 hash_mask;
+    Uint32 num_items;
+    Uint32 growth_left; // Empty slots that can be filled before resizing
     SDL_HashCallback hash;
     SDL_HashKeyMatchCallback keymatch;
     SDL_HashDestroyCallback destroy;
     void *userdata;
-    Uint32 hash_mask;
-    Uint32 max_probe_len;
-    Uint32 num_occupied_slots;
 };
 
+// Group matching, each function returns a mask with one bit per slot in the group
+
+#ifdef HASHTABLE_SSE2
+static SDL_INLINE Uint32 group_match(const Uint8 *ctrl, Uint8 h2)
+{
+    const __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+    return (Uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)h2)));
+}
+
+static SDL_INLINE Uint32 group_match_empty(const Uint8 *ctrl)
+{
+    return group_match(ctrl, CTRL_EMPTY);
+}
+
+static SDL_INLINE Uint32 group_match_empty_or_deleted(const Uint8 *ctrl)
+{
+    return (Uint32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+}
+#else
+// Gather the top bit of each byte into one bit per byte
+static SDL_INLINE Uint32 pack_group_mask(Uint64 bytes)
+{
+    return (Uint32)((((bytes >> 7) & 0x0101010101010101ULL) * 0x0102040810204080ULL) >> 56);
+}
+
+#ifdef HASHTABLE_NEON
+static SDL_INLINE Uint32 group_match(const Uint8 *ctrl, Uint8 h2)
+{
+    const uint8x8_t matches = vceq_u8(vld1_u8(ctrl), vdup_n_u8(h2));
+    return pack_group_mask(vget_lane_u64(vreinterpret_u64_u8(matches), 0));
+}
+
+static SDL_INLINE Uint32 group_match_empty(const Uint8 *ctrl)
+{
+    return group_match(ctrl, CTRL_EMPTY);
+}
+
+static SDL_INLINE Uint32 group_match_empty_or_deleted(const Uint8 *ctrl)
+{
+    return pack_group_mask(vget_lane_u64(vreinterpret_u64_u8(vld1_u8(ctrl)), 0));
+}
+#else
+static SDL_INLINE Uint64 load_group(const Uint8 *ctrl)
+{
+    Uint64 group;
+    SDL_memcpy(&group, ctrl, sizeof(group));
+    return SDL_Swap64LE(group);
+}
+
+static SDL_INLINE Uint32 group_match(const Uint8 *ctrl, Uint8 h2)
+{
+    // This can have false positives after a real match, which the full hash comparison rejects
+    const Uint64 lsbs = 0x0101010101010101ULL;
+    const Uint64 x = load_group(ctrl) ^ (lsbs * h2);
+    return pack_group_mask((x - lsbs) & ~x & 0x8080808080808080ULL);
+}
+
+static SDL_INLINE Uint32 group_match_empty(const Uint8 *ctrl)
+{
+    // EMPTY is the only control byte with the top bit set and bit 1 clear
+    const Uint64 group = load_group(ctrl);
+    return pack_group_mask(group & ~(group << 6) & 0x8080808080808080ULL);
+}
+
+static SDL_INLINE Uint32 group_match_empty_or_deleted(const Uint8 *ctrl)
+{
+    return pack_group_mask(load_group(ctrl) & 0x8080808080808080ULL);
+}
+#endif // HASHTABLE_NEON
+#endif // HASHTABLE_SSE2
+
+static SDL_INLINE void prefetch_item(const SDL_HashItem *item)
+{
+#ifdef HASHTABLE_SSE2
+    _mm_prefetch((const char *)item, _MM_HINT_T0);
+#elif defined(__GNUC__)
+    __builtin_prefetch(item);
+#else
+    (void)item;
+#endif
+}
+
+static SDL_INLINE Uint32 lowest_bit_index(Uint32 mask)
+{
+    return (Uint32)SDL_MostSignificantBitIndex32(mask & (~mask + 1));
+}
+
+static SDL_INLINE Uint32 max_items_for_capacity(Uint32 capacity)
+{
+    // Keep the table at most 7/8 full
+    return capacity - (capacity / 8);
+}
 
 static Uint32 CalculateHashBucketsFromEstimate(int estimated_capacity)
 {
     if (estimated_capacity <= 0) {
-        return 4;  // start small, grow as necessary.
+        return GROUP_WIDTH;  // start small, grow as necessary.
+    }
+
+    const Uint32 estimated32 = (Uint32)SDL_min(estimated_capacity, (int)MAX_HASHTABLE_SIZE);
+    Uint32 buckets = GROUP_WIDTH;
+    while (buckets < MAX_HASHTABLE_SIZE && max_items_for_capacity(buckets) < estimated32) {
+        buckets <<= 1;
     }
+    return buckets;
+}
 
-    const Uint32 estimated32 = (Uint32) estimated_capacity;
-    Uint32 buckets = ((Uint32) 1) << SDL_MostSignificantBitIndex32(estimated32);
-    if (!SDL_HasExactlyOneBitSet32(estimated32)) {
-        buckets <<= 1;  // need next power of two up to fit overflow capacity bits.
+static bool allocate_slots(SDL_HashTable *table, Uint32 num_buckets)
+{
+    const size_t size = num_buckets * (sizeof(SDL_HashItem) + sizeof(Uint32)) + num_buckets + GROUP_WIDTH;
+    Uint8 *memory = (Uint8 *)SDL_malloc(size);
+    if (!memory) {
+        return false;
     }
 
-    return SDL_min(buckets, MAX_HASHTABLE_SIZE);
+    table->items = (SDL_HashItem *)memory;
+    table->hashes = (Uint32 *)(table->items + num_buckets);
+    table->ctrl = (Uint8 *)(table->hashes + num_buckets);
+    SDL_memset(table->ctrl, CTRL_EMPTY, num_buckets + GROUP_WIDTH);
+    table->hash_mask = num_buckets - 1;
+    table->num_items = 0;
+    table->growth_left = max_items_for_capacity(num_buckets);
+    return true;
 }
 
 SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_HashCallback hash,
                                    SDL_HashKeyMatchCallback keymatch,
                                    SDL_HashDestroyCallback destroy, void *userdata)
 {
-    const Uint32 num_buckets = CalculateHashBucketsFromEstimate(estimated_capacity);
     SDL_HashTable *table = (SDL_HashTable *)SDL_calloc(1, sizeof(SDL_HashTable));
     if (!table) {
         return NULL;
@@ -84,13 +211,11 @@ SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_
         }
     }
 
-    table->table = (SDL_HashItem *)SDL_calloc(num_buckets, sizeof(SDL_HashItem));
-    if (!table->table) {
+    if (!allocate_slots(table, CalculateHashBucketsFromEstimate(estimated_capacity))) {
         SDL_DestroyHashTable(table);
         return NULL;
     }
 
-    table->hash_mask = num_buckets - 1;
     table->userdata = userdata;
     table->hash = hash;
     table->keymatch = keymatch;
@@ -104,190 +229,149 @@ static SDL_INLINE Uint32 calc_hash(const SDL_HashTable *table, const void *key)
     return table->hash(table->userdata, key) * BitMixer;
 }
 
-static SDL_INLINE Uint32 get_probe_length(Uint32 zero_idx, Uint32 actual_idx, Uint32 num_buckets)
+// Probing starts at the slot picked by the top bits of the hash, the low 7 bits go in the control byte
+#define HASH_H1(hash) ((hash) >> 7)
+#define HASH_H2(hash) ((Uint8)((hash) & 0x7F))
+
+static SDL_INLINE void set_ctrl(SDL_HashTable *table, Uint32 idx, Uint8 value)
 {
-    // returns the probe sequence length from zero_idx to actual_idx
-    if (actual_idx < zero_idx) {
-        return num_buckets - zero_idx + actual_idx;
+    table->ctrl[idx] = value;
+    if (idx < GROUP_WIDTH) {
+        table->ctrl[table->hash_mask + 1 + idx] = value;
     }
-
-    return actual_idx - zero_idx;
 }
 
-static SDL_HashItem *find_item(const SDL_HashTable *ht, const void *key, Uint32 hash, Uint32 *i, Uint32 *probe_len)
+// Returns the slot holding key, or -1 if it isn't in the table
+static Sint32 find_item(const SDL_HashTable *table, const void *key, Uint32 hash)
 {
-    Uint32 hash_mask = ht->hash_mask;
-    Uint32 max_probe_len = ht->max_probe_len;
+    const Uint32 hash_mask = table->hash_mask;
+    const Uint8 h2 = HASH_H2(hash);
+    Uint32 pos = HASH_H1(hash) & hash_mask;
+    Uint32 step = 0;
 
-    SDL_HashItem *table = ht->table;
+    // A hit is usually close to the start of the first group, fetch it while the control bytes load
+    prefetch_item(&table->items[pos]);
 
     while (true) {
-        SDL_HashItem *item = table + *i;
-        Uint32 item_hash = item->hash;
+        const Uint8 *group = table->ctrl + pos;
+        Uint32 matches = group_match(group, h2);
 
-        if (!item->live) {
-            return NULL;
-        }
-
-        if (item_hash == hash && ht->keymatch(ht->userdata, item->key, key)) {
-            return item;
+        while (matches) {
+            const Uint32 idx = (pos + lowest_bit_index(matches)) & hash_mask;
+            if (table->keymatch(table->userdata, table->items[idx].key, key)) {
+                return (Sint32)idx;
+            }
+            matches &= matches - 1;
         }
 
-        Uint32 item_probe_len = item->probe_len;
-        SDL_assert(item_probe_len == get_probe_length(item_hash & hash_mask, (Uint32)(item - table), hash_mask + 1));
-
-        if (*probe_len > item_probe_len) {
-            return NULL;
+        if (group_match_empty(group)) {
+            return -1;
         }
 
-        if (++*probe_len > max_probe_len) {
-            return NULL;
+        // Triangular probing over groups visits every group when the capacity is a power of two
+        step += GROUP_WIDTH;
+        if (step > hash_mask) {
+            return -1;
         }
-
-        *i = (*i + 1) & hash_mask;
+        pos = (pos + step) & hash_mask;
     }
 }
 
-static SDL_HashItem *find_first_item(const SDL_HashTable *ht, const void *key, Uint32 hash)
+static Uint32 find_free_slot(const SDL_HashTable *table, Uint32 hash)
 {
-    Uint32 i = hash & ht->hash_mask;
-    Uint32 probe_len = 0;
-    return find_item(ht, key, hash, &i, &probe_len);
-}
-
-static SDL_HashItem *insert_item(SDL_HashItem *item_to_insert, SDL_HashItem *table, Uint32 hash_mask, Uint32 *max_probe_len_ptr)
-{
-    const Uint32 num_buckets = hash_mask + 1;
-    Uint32 idx = item_to_insert->hash & hash_mask;
-    SDL_HashItem *target = NULL;
-    SDL_HashItem temp_item;
+    const Uint32 hash_mask = table->hash_mask;
+    Uint32 pos = HASH_H1(hash) & hash_mask;
+    Uint32 step = 0;
 
     while (true) {
-        SDL_HashItem *candidate = table + idx;
-
-        if (!candidate->live) {
-            // Found an empty slot. Put it here and we're done.
-            *candidate = *item_to_insert;
-
-            if (target == NULL) {
-                target = candidate;
-            }
-
-            const Uint32 probe_len = get_probe_length(candidate->hash & hash_mask, idx, num_buckets);
-            candidate->probe_len = probe_len;
-
-            if (*max_probe_len_ptr < probe_len) {
-                *max_probe_len_ptr = probe_len;
-            }
-
-            break;
+        const Uint32 available = group_match_empty_or_deleted(table->ctrl + pos);
+        if (available) {
+            return (pos + lowest_bit_index(available)) & hash_mask;
         }
-
-        const Uint32 candidate_probe_len = candidate->probe_len;
-        SDL_assert(candidate_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
-        const Uint32 new_probe_len = get_probe_length(item_to_insert->hash & hash_mask, idx, num_buckets);
-
-        if (candidate_probe_len < new_probe_len) {
-            // Robin Hood hashing: the item at idx has a better probe length than our item would at this position.
-            // Evict it and put our item in its place, then continue looking for a new spot for the displaced item.
-            // This algorithm significantly reduces clustering in the table, making lookups take very few probes.
-
-            temp_item = *candidate;
-            *candidate = *item_to_insert;
-
-            if (target == NULL) {
-                target = candidate;
-            }
-
-            *item_to_insert = temp_item;
-
-            SDL_assert(new_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
-            candidate->probe_len = new_probe_len;
-
-            if (*max_probe_len_ptr < new_probe_len) {
-                *max_probe_len_ptr = new_probe_len;
-            }
-        }
-
-        idx = (idx + 1) & hash_mask;
+        step += GROUP_WIDTH;
+        pos = (pos + step) & hash_mask;
     }
-
-    return target;
 }
 
-static void delete_item(SDL_HashTable *ht, SDL_HashItem *item)
+static void insert_new_item(SDL_HashTable *table, const void *key, const void *value, Uint32 hash)
 {
-    const Uint32 hash_mask = ht->hash_mask;
-    SDL_HashItem *table = ht->table;
+    const Uint32 idx = find_free_slot(table, hash);
 
-    if (ht->destroy) {
-        ht->destroy(ht->userdata, item->key, item->value);
+    if (table->ctrl[idx] == CTRL_EMPTY) {
+        SDL_assert(table->growth_left > 0);
+        table->growth_left--;
     }
+    set_ctrl(table, idx, HASH_H2(hash));
+    table->items[idx].key = key;
+    table->items[idx].value = value;
+    table->hashes[idx] = hash;
+    table->num_items++;
+}
 
-    SDL_assert(ht->num_occupied_slots > 0);
-    ht->num_occupied_slots--;
-
-    Uint32 idx = (Uint32)(item - ht->table);
-
-    while (true) {
-        idx = (idx + 1) & hash_mask;
-        SDL_HashItem *next_item = table + idx;
+static void delete_item(SDL_HashTable *table, Uint32 idx)
+{
+    const Uint32 hash_mask = table->hash_mask;
 
-        if (next_item->probe_len < 1) {
-            SDL_zerop(item);
-            return;
-        }
+    if (table->destroy) {
+        table->destroy(table->userdata, table->items[idx].key, table->items[idx].value);
+    }
 
-        *item = *next_item;
-        item->probe_len -= 1;
-        SDL_assert(item->probe_len < ht->max_probe_len);
-        item = next_item;
+    SDL_assert(table->num_items > 0);
+    table->num_items--;
+
+    /* If there's an empty slot within a group's width on both sides, no probe
+       sequence ever had to look past this slot, so it can become EMPTY again.
+       Otherwise it has to be left as DELETED so lookups keep going. */
+    const Uint32 empty_before = group_match_empty(table->ctrl + ((idx - GROUP_WIDTH) & hash_mask));
+    const Uint32 empty_after = group_match_empty(table->ctrl + idx);
+    if (empty_before && empty_after &&
+        (lowest_bit_index(empty_after) + (GROUP_WIDTH - 1 - (Uint32)SDL_MostSignificantBitIndex32(empty_before))) < GROUP_WIDTH) {
+        set_ctrl(table, idx, CTRL_EMPTY);
+        table->growth_left++;
+    } else {
+        set_ctrl(table, idx, CTRL_DELETED);
     }
 }
 
-static bool resize(SDL_HashTable *ht, Uint32 new_size)
+static bool resize(SDL_HashTable *table, Uint32 new_size)
 {
-    const Uint32 new_hash_mask = new_size - 1;
-    SDL_HashItem *new_table = SDL_calloc(new_size, sizeof(*new_table));
+    Uint8 *old_ctrl = table->ctrl;
+    SDL_HashItem *old_items = table->items;
+    Uint32 *old_hashes = table->hashes;
+    const Uint32 old_hash_mask = table->hash_mask;
 
-    if (!new_table) {
+    // This only changes the table if it succeeds
+    if (!allocate_slots(table, new_size)) {
         return false;
     }
 
-    SDL_HashItem *old_table = ht->table;
-    const Uint32 old_size = ht->hash_mask + 1;
-
-    ht->max_probe_len = 0;
-    ht->hash_mask = new_hash_mask;
-    ht->table = new_table;
-
-    for (Uint32 i = 0; i < old_size; ++i) {
-        SDL_HashItem *item = old_table + i;
-        if (item->live) {
-            insert_item(item, new_table, new_hash_mask, &ht->max_probe_len);
+    for (Uint32 i = 0; i <= old_hash_mask; ++i) {
+        if (!(old_ctrl[i] & CTRL_EMPTY)) {
+            insert_new_item(table, old_items[i].key, old_items[i].value, old_hashes[i]);
         }
     }
 
-    SDL_free(old_table);
+    SDL_free(old_items);
     return true;
 }
 
-static bool maybe_resize(SDL_HashTable *ht)
+static bool maybe_resize(SDL_HashTable *table)
 {
-    const Uint32 capacity = ht->hash_mask + 1;
-
-    if (capacity >= MAX_HASHTABLE_SIZE) {
-        return false;
+    if (table->growth_left > 0) {
+        return true;
     }
 
-    const Uint32 max_load_factor = 217; // range: 0-255; 217 is roughly 85%
-    const Uint32 resize_threshold = (Uint32)((max_load_factor * (Uint64)capacity) >> 8);
+    const Uint32 capacity = table->hash_mask + 1;
 
-    if (ht->num_occupied_slots > resize_threshold) {
-        return resize(ht, capacity * 2);
+    // If a lot of the used slots are just deleted items, rebuilding at the same size is enough
+    if (table->num_items <= max_items_for_capacity(capacity) / 2) {
+        return resize(table, capacity);
     }
 
-    return true;
+    if (capacity >= MAX_HASHTABLE_SIZE) {
+        return SDL_SetError("hash table is full");
+    }
+    return resize(table, capacity * 2);
 }
 
 bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *value, bool replace)
@@ -298,38 +382,26 @@ bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *
 
     bool result = false;
 
-    SDL_LockRWLockForWriting(table->lock);
-
     const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *item = find_first_item(table, key, hash);
-    bool do_insert = true;
 
-    if (item) {
+    SDL_LockRWLockForWriting(table->lock);
+
+    const Sint32 idx = find_item(table, key, hash);
+    if (idx >= 0) {
         if (replace) {
-            delete_item(table, item);
+            // Replace the item in place, its slot and hash stay the same
+            if (table->destroy) {
+                table->destroy(table->userdata, table->items[idx].key, table->items[idx].value);
+            }
+            table->items[idx].key = key;
+            table->items[idx].value = value;
+            result = true;
         } else {
             SDL_SetError("key already exists and replace is disabled");
-            do_insert = false;
-        }
-    }
-
-    if (do_insert) {
-        SDL_HashItem new_item;
-        new_item.key = key;
-        new_item.value = value;
-        new_item.hash = hash;
-        new_item.live = true;
-        new_item.probe_len = 0;
-
-        table->num_occupied_slots++;
-
-        if (!maybe_resize(table)) {
-            table->num_occupied_slots--;
-        } else {
-            // This never returns NULL
-            insert_item(&new_item, table->table, table->hash_mask, &table->max_probe_len);
-            result = true;
         }
+    } else if (maybe_resize(table)) {
+        insert_new_item(table, key, value, hash);
+        result = true;
     }
 
     SDL_UnlockRWLock(table->lock);
@@ -345,16 +417,19 @@ bool SDL_FindInHashTable(const SDL_HashTable *table, const void *key, const void
         return SDL_InvalidParamError("table");
     }
 
+    const Uint32 hash = calc_hash(table, key);
+
     SDL_LockRWLockForReading(table->lock);
 
     bool result = false;
-    const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *i = find_first_item(table, key, hash);
-    if (i) {
+    const Sint32 idx = find_item(table, key, hash);
+    if (idx >= 0) {
         if (value) {
-            *value = i->value;
+            *value = table->items[idx].value;
         }
         result = true;
+    } else if (value) {
+        *value = NULL;
     }
 
     SDL_UnlockRWLock(table->lock);
@@ -368,13 +443,14 @@ bool SDL_RemoveFromHashTable(SDL_HashTable *table, const void *key)
         return SDL_InvalidParamError("table");
     }
 
+    const Uint32 hash = calc_hash(table, key);
+
     SDL_LockRWLockForWriting(table->lock);
 
     bool result = false;
-    const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *item = find_first_item(table, key, hash);
-    if (item) {
-        delete_item(table, item);
+    const Sint32 idx = find_item(table, key, hash);
+    if (idx >= 0) {
+        delete_item(table, (Uint32)idx);
         result = true;
     }
 
@@ -392,15 +468,14 @@ bool SDL_IterateHashTable(const SDL_HashTable *table, SDL_HashTableIterateCallba
     }
 
     SDL_LockRWLockForReading(table->lock);
-    SDL_HashItem *end = table->table + (table->hash_mask + 1);
+    const Uint32 num_buckets = table->hash_mask + 1;
     Uint32 num_iterated = 0;
 
-    for (SDL_HashItem *item = table->table; item < end; item++) {
-        if (item->live) {
-            if (!callback(userdata, table, item->key, item->value)) {
+    for (Uint32 i = 0; i < num_buckets && num_iterated < table->num_items; ++i) {
+        if (!(table->ctrl[i] & CTRL_EMPTY)) {
+            ++num_iterated;
+            if (!callback(userdata, table, table->items[i].key, table->items[i].value)) {
                 break;  // callback requested iteration stop.
-            } else if (++num_iterated >= table->num_occupied_slots) {
-                break;  // we can drop out early because we've seen all the live items.
             }
         }
     }
@@ -416,22 +491,21 @@ bool SDL_HashTableEmpty(SDL_HashTable *table)
     }
 
     SDL_LockRWLockForReading(table->lock);
-    const bool retval = (table->num_occupied_slots == 0);
+    const bool retval = (table->num_items == 0);
     SDL_UnlockRWLock(table->lock);
     return retval;
 }
 
-
 static void destroy_all(SDL_HashTable *table)
 {
     SDL_HashDestroyCallback destroy = table->destroy;
-    if (destroy) {
+    if (destroy && table->ctrl) {
         void *userdata = table->userdata;
-        SDL_HashItem *end = table->table + (table->hash_mask + 1);
-        for (SDL_HashItem *i = table->table; i < end; ++i) {
-            if (i->live) {
-                i->live = false;
-                destroy(userdata, i->key, i->value);
+        const Uint32 num_buckets = table->hash_mask + 1;
+        for (Uint32 i = 0; i < num_buckets; ++i) {
+            if (!(table->ctrl[i] & CTRL_EMPTY)) {
+                set_ctrl(table, i, CTRL_EMPTY);
+                destroy(userdata, table->items[i].key, table->items[i].value);
             }
         }
     }
@@ -442,9 +516,11 @@ void SDL_ClearHashTable(SDL_HashTable *table)
     if (table) {
         SDL_LockRWLockForWriting(table->lock);
         {
+            const Uint32 num_buckets = table->hash_mask + 1;
             destroy_all(table);
-            SDL_memset(table->table, 0, sizeof(*table->table) * (table->hash_mask + 1));
-            table->num_occupied_slots = 0;
+            SDL_memset(table->ctrl, CTRL_EMPTY, num_buckets + GROUP_WIDTH);
+            table->num_items = 0;
+            table->growth_left = max_items_for_capacity(num_buckets);
         }
         SDL_UnlockRWLock(table->lock);
     }
@@ -457,7 +533,7 @@ void SDL_DestroyHashTable(SDL_HashTable *table)
         if (table->lock) {
             SDL_DestroyRWLock(table->lock);
         }
-        SDL_free(table->table);
+        SDL_free(table->items);
         SDL_free(table);
     }
 }
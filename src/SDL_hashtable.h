@@ -60,12 +60,14 @@
  * iterate through all the items in the table (SDL_IterateHashTable).
  *
  * The underlying hash table implementation is always subject to change, but
- * at the time of writing, it uses open addressing and Robin Hood hashing.
- * The technical details are explained [here](https://github.com/libsdl-org/SDL/pull/10897).
- *
- * Hashtables keep an SDL_RWLock internally, so multiple threads can perform
- * hash lookups in parallel, while changes to the table will safely serialize
- * access between threads.
+ * at the time of writing, it uses open addressing with groups of one-byte
+ * control tags that are compared in parallel ("Swiss tables"). The control
+ * tags are kept in their own array, and each key is stored together with its
+ * value.
+ *
+ * Thread-safe hashtables keep an SDL_RWLock internally, so multiple threads
+ * can perform hash lookups in parallel, while changes to the table will
+ * safely serialize access between threads.
  *
  * SDL provides a layer on top of this hash table implementation that might be
  * more pleasant to use. SDL_PropertiesID maps a string to arbitrary data of
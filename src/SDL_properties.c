@@ -23,6 +23,25 @@
 #include "SDL_hints_c.h"
 #include "SDL_properties_c.h"
 
+/* Names passed to SDL_GetPropertyAtom() are interned: each one gets an
+ * atom, a small integer that stays valid until SDL_QuitProperties(), and
+ * each group of properties keeps those in a table keyed by atom. Looking up
+ * a property by atom never touches the name, and looking it up by name only
+ * hashes it once to find the atom. Properties whose names have no atom are
+ * kept in a hash table keyed by name, which is only used under the group's
+ * lock, so apps that make up names at run time don't use up atoms. A
+ * property set before its name got an atom stays under its name until it's
+ * set again, so lookups by atom check there too.
+ *
+ * Lookups by atom don't take a lock. The atom table only ever grows, so a
+ * lookup can only miss a name that is being added at the same time. Each
+ * group has a sequence count that writers keep odd while they hold the
+ * group's lock, and readers copy the property out and then check that the
+ * count didn't change, falling back to the lock if a writer was active. The
+ * table of groups works like the object table in SDL_utils.c. Tables that
+ * have been replaced by bigger ones might still be in use by a reader, so
+ * they are kept until the group or the atom table is freed.
+ */
 
 typedef struct
 {
@@ -36,78 +55,688 @@ typedef struct
         bool boolean_value;
     } value;
 
-    char *string_storage;
+    char *string_storage;  // set under the lock while readers might be looking, so accessed atomically
 
     SDL_CleanupPropertyCallback cleanup;
     void *userdata;
 } SDL_Property;
 
+typedef struct SDL_PropertySlot
+{
+    SDL_PropertyAtom atom;  // 0 if the slot is empty
+    SDL_Property property;
+} SDL_PropertySlot;
+
+typedef struct SDL_PropertyTable
+{
+    Uint32 mask;
+    Uint32 count;
+    struct SDL_PropertyTable *retired;
+    SDL_PropertySlot slots[1];
+} SDL_PropertyTable;
+
 typedef struct
 {
-    SDL_HashTable *props;
+    SDL_PropertyTable *table;
+    SDL_HashTable *named;  // properties whose names have no atom, created when first needed
+    int num_named;  // read without the lock, like the table
+    SDL_AtomicInt sequence;
+    int writers;  // nested write locks held by the thread that owns the lock
     SDL_Mutex *lock;
 } SDL_Properties;
 
+#define SDL_PROPERTY_TABLE_MIN_SIZE 8
+
+typedef struct SDL_PropertiesEntry
+{
+    SDL_AtomicU32 id;
+    SDL_Properties *properties;
+} SDL_PropertiesEntry;
+
+typedef struct SDL_PropertiesRegistry
+{
+    Uint32 mask;
+    Uint32 count;
+    struct SDL_PropertiesRegistry *retired;
+    SDL_PropertiesEntry entries[1];
+} SDL_PropertiesRegistry;
+
+#define SDL_PROPERTIES_REGISTRY_MIN_SIZE 64
+
+typedef struct SDL_PropertyAtomSlot
+{
+    Uint32 hash;
+    SDL_AtomicU32 atom;  // 0 if the slot is empty
+} SDL_PropertyAtomSlot;
+
+typedef struct SDL_PropertyAtomTable
+{
+    Uint32 mask;
+    struct SDL_PropertyAtomTable *retired;
+    SDL_PropertyAtomSlot slots[1];
+} SDL_PropertyAtomTable;
+
+#define SDL_PROPERTY_ATOM_TABLE_MIN_SIZE 256
+
+// Names are stored in chunks that never move, so readers can find them without a lock
+#define SDL_PROPERTY_ATOM_CHUNK_SIZE 256
+#define SDL_PROPERTY_ATOM_CHUNKS 4096
+
 static SDL_InitState SDL_properties_init;
-static SDL_HashTable *SDL_properties;
+static SDL_PropertiesRegistry *SDL_properties;
+static SDL_AtomicInt SDL_properties_sequence;
+static SDL_SpinLock SDL_properties_lock;
 static SDL_AtomicU32 SDL_last_properties_id;
 static SDL_AtomicU32 SDL_global_properties;
+static SDL_PropertyAtomTable *SDL_property_atoms;
+static char **SDL_property_atom_names[SDL_PROPERTY_ATOM_CHUNKS];
+static Uint32 SDL_num_property_atoms;
+static SDL_SpinLock SDL_property_atoms_lock;
+
+
+static SDL_INLINE Uint32 SDL_HashPropertyKey(Uint32 key)
+{
+    return (Uint32)(((Uint64)key * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+static const char *SDL_GetPropertyAtomName(SDL_PropertyAtom atom)
+{
+    const Uint32 index = atom - 1;
+    char **names = (char **)SDL_GetAtomicPointer((void **)&SDL_property_atom_names[index / SDL_PROPERTY_ATOM_CHUNK_SIZE]);
+    return names[index % SDL_PROPERTY_ATOM_CHUNK_SIZE];
+}
+
+static SDL_PropertyAtom SDL_FindPropertyAtom(const char *name, Uint32 hash)
+{
+    const SDL_PropertyAtomTable *table = (const SDL_PropertyAtomTable *)SDL_GetAtomicPointer((void **)&SDL_property_atoms);
+    Uint32 i;
+
+    if (!table) {
+        return 0;
+    }
+
+    for (i = hash & table->mask;; i = (i + 1) & table->mask) {
+        const SDL_PropertyAtomSlot *slot = &table->slots[i];
+        const SDL_PropertyAtom atom = SDL_GetAtomicU32((SDL_AtomicU32 *)&slot->atom);
+        if (!atom) {
+            return 0;
+        }
+        if (slot->hash == hash && SDL_strcmp(SDL_GetPropertyAtomName(atom), name) == 0) {
+            return atom;
+        }
+    }
+}
 
+// There must be at least one empty slot
+static void SDL_InsertPropertyAtomSlot(SDL_PropertyAtomTable *table, Uint32 hash, SDL_PropertyAtom atom)
+{
+    Uint32 i;
+
+    for (i = hash & table->mask;; i = (i + 1) & table->mask) {
+        SDL_PropertyAtomSlot *slot = &table->slots[i];
+        if (!SDL_GetAtomicU32(&slot->atom)) {
+            // Publish the hash before the atom, so readers never see a stale hash
+            slot->hash = hash;
+            SDL_SetAtomicU32(&slot->atom, atom);
+            return;
+        }
+    }
+}
 
-static void SDL_FreePropertyWithCleanup(const void *key, const void *value, void *data, bool cleanup)
+// The atom lock must be held
+static SDL_PropertyAtom SDL_AddPropertyAtom(const char *name, Uint32 hash)
 {
-    SDL_Property *property = (SDL_Property *)value;
-    if (property) {
-        switch (property->type) {
-        case SDL_PROPERTY_TYPE_POINTER:
-            if (property->cleanup && cleanup) {
-                property->cleanup(property->userdata, property->value.pointer_value);
+    SDL_PropertyAtomTable *table = (SDL_PropertyAtomTable *)SDL_GetAtomicPointer((void **)&SDL_property_atoms);
+    const Uint32 index = SDL_num_property_atoms;
+    char **names;
+    Uint32 i;
+
+    if (index >= SDL_PROPERTY_ATOM_CHUNKS * SDL_PROPERTY_ATOM_CHUNK_SIZE) {
+        SDL_SetError("Too many property names");
+        return 0;
+    }
+
+    // Atoms are never removed, so the number of names is also the number of used slots
+    if (!table || !SDL_LinearProbeTableHasRoom(index, table->mask + 1)) {
+        const Uint32 size = table ? (table->mask + 1) * 2 : SDL_PROPERTY_ATOM_TABLE_MIN_SIZE;
+        SDL_PropertyAtomTable *new_table = (SDL_PropertyAtomTable *)SDL_calloc(1, sizeof(*new_table) + (size - 1) * sizeof(new_table->slots[0]));
+        if (!new_table) {
+            return 0;
+        }
+        new_table->mask = size - 1;
+        if (table) {
+            for (i = 0; i <= table->mask; ++i) {
+                const SDL_PropertyAtom atom = SDL_GetAtomicU32(&table->slots[i].atom);
+                if (atom) {
+                    SDL_InsertPropertyAtomSlot(new_table, table->slots[i].hash, atom);
+                }
             }
-            break;
-        case SDL_PROPERTY_TYPE_STRING:
-            SDL_free(property->value.string_value);
-            break;
-        default:
+        }
+        new_table->retired = table;
+        SDL_SetAtomicPointer((void **)&SDL_property_atoms, new_table);
+        table = new_table;
+    }
+
+    names = SDL_property_atom_names[index / SDL_PROPERTY_ATOM_CHUNK_SIZE];
+    if (!names) {
+        names = (char **)SDL_calloc(SDL_PROPERTY_ATOM_CHUNK_SIZE, sizeof(*names));
+        if (!names) {
+            return 0;
+        }
+        SDL_SetAtomicPointer((void **)&SDL_property_atom_names[index / SDL_PROPERTY_ATOM_CHUNK_SIZE], names);
+    }
+    names[index % SDL_PROPERTY_ATOM_CHUNK_SIZE] = SDL_strdup(name);
+    if (!names[index % SDL_PROPERTY_ATOM_CHUNK_SIZE]) {
+        return 0;
+    }
+
+    ++SDL_num_property_atoms;
+    SDL_InsertPropertyAtomSlot(table, hash, index + 1);
+    return index + 1;
+}
+
+// Returns 0 if the name has never been used for a property
+static SDL_PropertyAtom SDL_LookupPropertyAtom(const char *name)
+{
+    if (!name || !*name) {
+        return 0;
+    }
+    return SDL_FindPropertyAtom(name, SDL_HashString(NULL, name));
+}
+
+static SDL_PropertyAtom SDL_InternPropertyName(const char *name)
+{
+    const Uint32 hash = SDL_HashString(NULL, name);
+    SDL_PropertyAtom atom = SDL_FindPropertyAtom(name, hash);
+
+    if (!atom) {
+        SDL_LockSpinlock(&SDL_property_atoms_lock);
+        // Another thread might have added it while we were looking
+        atom = SDL_FindPropertyAtom(name, hash);
+        if (!atom) {
+            atom = SDL_AddPropertyAtom(name, hash);
+        }
+        SDL_UnlockSpinlock(&SDL_property_atoms_lock);
+    }
+    return atom;
+}
+
+static void SDL_FreePropertyAtoms(void)
+{
+    SDL_PropertyAtomTable *table = (SDL_PropertyAtomTable *)SDL_GetAtomicPointer((void **)&SDL_property_atoms);
+    Uint32 i;
+
+    SDL_SetAtomicPointer((void **)&SDL_property_atoms, NULL);
+    while (table) {
+        SDL_PropertyAtomTable *retired = table->retired;
+        SDL_free(table);
+        table = retired;
+    }
+
+    for (i = 0; i < SDL_num_property_atoms; ++i) {
+        SDL_free(SDL_property_atom_names[i / SDL_PROPERTY_ATOM_CHUNK_SIZE][i % SDL_PROPERTY_ATOM_CHUNK_SIZE]);
+    }
+    for (i = 0; i < SDL_PROPERTY_ATOM_CHUNKS && SDL_property_atom_names[i]; ++i) {
+        SDL_free(SDL_property_atom_names[i]);
+        SDL_SetAtomicPointer((void **)&SDL_property_atom_names[i], NULL);
+    }
+    SDL_num_property_atoms = 0;
+}
+
+static void SDL_FreePropertyWithCleanup(SDL_Property *property, bool cleanup)
+{
+    switch (property->type) {
+    case SDL_PROPERTY_TYPE_POINTER:
+        if (property->cleanup && cleanup) {
+            property->cleanup(property->userdata, property->value.pointer_value);
+        }
+        break;
+    case SDL_PROPERTY_TYPE_STRING:
+        SDL_free(property->value.string_value);
+        break;
+    default:
+        break;
+    }
+    SDL_free(property->string_storage);
+}
+
+static SDL_PropertyTable *SDL_CreatePropertyTable(Uint32 size)
+{
+    SDL_PropertyTable *table = (SDL_PropertyTable *)SDL_calloc(1, sizeof(*table) + (size - 1) * sizeof(table->slots[0]));
+    if (table) {
+        table->mask = size - 1;
+    }
+    return table;
+}
+
+// This is also used without the lock, so it gives up if the table changes enough to have no end
+static SDL_PropertySlot *SDL_FindPropertySlot(SDL_PropertyTable *table, SDL_PropertyAtom atom)
+{
+    Uint32 i, n;
+
+    for (i = SDL_HashPropertyKey(atom) & table->mask, n = 0; n <= table->mask; i = (i + 1) & table->mask, ++n) {
+        SDL_PropertySlot *slot = &table->slots[i];
+        if (slot->atom == atom) {
+            return slot;
+        }
+        if (!slot->atom) {
             break;
         }
-        SDL_free(property->string_storage);
     }
-    SDL_free((void *)key);
-    SDL_free((void *)value);
+    return NULL;
 }
 
-static void SDLCALL SDL_FreeProperty(void *data, const void *key, const void *value)
+// There must be at least one empty slot
+static SDL_PropertySlot *SDL_InsertPropertySlot(SDL_PropertyTable *table, SDL_PropertyAtom atom)
 {
-    SDL_FreePropertyWithCleanup(key, value, data, true);
+    Uint32 i;
+
+    for (i = SDL_HashPropertyKey(atom) & table->mask;; i = (i + 1) & table->mask) {
+        SDL_PropertySlot *slot = &table->slots[i];
+        if (!slot->atom) {
+            slot->atom = atom;
+            ++table->count;
+            return slot;
+        }
+    }
+}
+
+// The properties must be locked for writing
+static bool SDL_GrowPropertyTable(SDL_Properties *properties)
+{
+    SDL_PropertyTable *table = properties->table;
+    SDL_PropertyTable *new_table;
+    Uint32 i;
+
+    // Groups usually hold a handful of properties, so they start small and double as needed
+    if (SDL_LinearProbeTableHasRoom(table->count, table->mask + 1)) {
+        return true;
+    }
+
+    new_table = SDL_CreatePropertyTable((table->mask + 1) * 2);
+    if (!new_table) {
+        return false;
+    }
+    for (i = 0; i <= table->mask; ++i) {
+        const SDL_PropertySlot *slot = &table->slots[i];
+        if (slot->atom) {
+            SDL_copyp(&SDL_InsertPropertySlot(new_table, slot->atom)->property, &slot->property);
+        }
+    }
+    new_table->retired = table;
+    SDL_SetAtomicPointer((void **)&properties->table, new_table);
+    return true;
+}
+
+// The properties must be locked for writing
+static void SDL_RemovePropertySlot(SDL_PropertyTable *table, SDL_PropertySlot *removed)
+{
+    Uint32 i = (Uint32)(removed - table->slots);
+    Uint32 j;
+
+    // Shift back any following entries that would no longer be reachable
+    for (j = (i + 1) & table->mask; table->slots[j].atom; j = (j + 1) & table->mask) {
+        const Uint32 home = SDL_HashPropertyKey(table->slots[j].atom) & table->mask;
+        if (((j - home) & table->mask) >= ((j - i) & table->mask)) {
+            SDL_copyp(&table->slots[i], &table->slots[j]);
+            i = j;
+        }
+    }
+    SDL_zero(table->slots[i]);
+    --table->count;
+}
+
+static void SDL_LockPropertiesForWriting(SDL_Properties *properties)
+{
+    SDL_LockMutex(properties->lock);
+    if (properties->writers++ == 0) {
+        // Readers that see an odd count wait for the lock instead
+        SDL_AddAtomicInt(&properties->sequence, 1);
+    }
+}
+
+static void SDL_UnlockPropertiesForWriting(SDL_Properties *properties)
+{
+    if (--properties->writers == 0) {
+        SDL_AddAtomicInt(&properties->sequence, 1);
+    }
+    SDL_UnlockMutex(properties->lock);
+}
+
+/* The properties must be locked. Finds the property stored under `atom`, or
+   under its name if it was set before the name had an atom. If `atom` is 0,
+   `name` has no atom, and if `name` is NULL, it's the name of `atom`. */
+static SDL_Property *SDL_FindLockedProperty(SDL_Properties *properties, SDL_PropertyAtom atom, const char *name)
+{
+    const void *value = NULL;
+
+    if (atom) {
+        SDL_PropertySlot *slot = SDL_FindPropertySlot(properties->table, atom);
+        if (slot) {
+            return &slot->property;
+        }
+    }
+    if (properties->num_named > 0) {
+        SDL_FindInHashTable(properties->named, name ? name : SDL_GetPropertyAtomName(atom), &value);
+    }
+    return (SDL_Property *)value;
+}
+
+/* Copies the type and value of a property, without locking unless a writer
+   is busy with the group or the property might be stored under its name.
+   Strings in the copy can be freed by a writer as soon as this returns, so
+   anything that reads them has to take the lock. `atom` and `name` are as
+   for SDL_FindLockedProperty(). */
+static bool SDL_ReadProperty(SDL_Properties *properties, SDL_PropertyAtom atom, const char *name, SDL_Property *property)
+{
+    const int sequence = SDL_GetAtomicInt(&properties->sequence);
+    const SDL_PropertySlot *slot = NULL;
+    const SDL_Property *found;
+
+    if (!(sequence & 1)) {
+        if (atom) {
+            slot = SDL_FindPropertySlot((SDL_PropertyTable *)SDL_GetAtomicPointer((void **)&properties->table), atom);
+        }
+        if (slot) {
+            property->type = slot->property.type;
+            property->value = slot->property.value;
+            property->string_storage = (char *)SDL_GetAtomicPointer((void **)&slot->property.string_storage);
+        }
+        const bool has_named = (properties->num_named > 0);
+        SDL_MemoryBarrierAcquire();
+        if (SDL_GetAtomicInt(&properties->sequence) == sequence && (slot || !has_named)) {
+            return (slot != NULL);
+        }
+    }
+
+    SDL_LockMutex(properties->lock);
+    {
+        found = SDL_FindLockedProperty(properties, atom, name);
+        if (found) {
+            property->type = found->type;
+            property->value = found->value;
+            property->string_storage = found->string_storage;
+        }
+    }
+    SDL_UnlockMutex(properties->lock);
+
+    return (found != NULL);
+}
+
+/* The properties must be locked for writing. If property is NULL, the
+   property is removed, otherwise the group takes ownership of it. */
+static bool SDL_StoreProperty(SDL_Properties *properties, SDL_PropertyAtom atom, SDL_Property *property)
+{
+    SDL_PropertySlot *slot = SDL_FindPropertySlot(properties->table, atom);
+
+    if (slot) {
+        // Free the old value after it's gone, in case its cleanup looks at the group
+        SDL_Property old_property;
+        SDL_copyp(&old_property, &slot->property);
+        if (property) {
+            SDL_copyp(&slot->property, property);
+        } else {
+            SDL_RemovePropertySlot(properties->table, slot);
+        }
+        SDL_FreePropertyWithCleanup(&old_property, true);
+    } else if (property) {
+        if (!SDL_GrowPropertyTable(properties)) {
+            SDL_FreePropertyWithCleanup(property, true);
+            return false;
+        }
+        SDL_copyp(&SDL_InsertPropertySlot(properties->table, atom)->property, property);
+    }
+    return true;
+}
+
+/* The properties must be locked for writing. Stores a property under a name
+   that has no atom. If property is NULL, the property is removed, otherwise
+   the group takes ownership of it. */
+static bool SDL_StoreNamedProperty(SDL_Properties *properties, const char *name, SDL_Property *property)
+{
+    const void *value = NULL;
+    SDL_Property *stored;
+    char *key;
+
+    if (properties->num_named > 0 && SDL_FindInHashTable(properties->named, name, &value)) {
+        // Free the old value after it's gone, in case its cleanup looks at the group
+        SDL_Property old_property;
+        stored = (SDL_Property *)value;
+        SDL_copyp(&old_property, stored);
+        if (property) {
+            SDL_copyp(stored, property);
+        } else {
+            SDL_RemoveFromHashTable(properties->named, name);
+            --properties->num_named;
+        }
+        SDL_FreePropertyWithCleanup(&old_property, true);
+        return true;
+    }
+
+    if (!property) {
+        return true;
+    }
+
+    if (!properties->named) {
+        properties->named = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, SDL_DestroyHashKeyAndValue, NULL);
+    }
+    stored = (SDL_Property *)SDL_malloc(sizeof(*stored));
+    key = SDL_strdup(name);
+    if (stored) {
+        SDL_copyp(stored, property);
+    }
+    if (!properties->named || !stored || !key || !SDL_InsertIntoHashTable(properties->named, key, stored, false)) {
+        SDL_free(key);
+        SDL_free(stored);
+        SDL_FreePropertyWithCleanup(property, true);
+        return false;
+    }
+    ++properties->num_named;
+    return true;
+}
+
+/* The properties must be locked for writing. Stores a property under its
+   atom if the name has one, otherwise under the name itself. If property is
+   NULL, the property is removed, otherwise the group takes ownership of it. */
+static bool SDL_StorePropertyByName(SDL_Properties *properties, const char *name, SDL_Property *property)
+{
+    // This is looked up under the lock, so a property set before its name
+    //  got an atom can't be left behind when it moves over to the atom.
+    const SDL_PropertyAtom atom = SDL_LookupPropertyAtom(name);
+
+    if (!atom) {
+        return SDL_StoreNamedProperty(properties, name, property);
+    }
+    if (!SDL_StoreProperty(properties, atom, property)) {
+        return false;
+    }
+    if (properties->num_named > 0) {
+        SDL_StoreNamedProperty(properties, name, NULL);
+    }
+    return true;
+}
+
+static bool SDLCALL SDL_FreeNamedProperty(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    SDL_FreePropertyWithCleanup((SDL_Property *)value, true);
+    return true;  // keep iterating.
 }
 
 static void SDL_FreeProperties(SDL_Properties *properties)
 {
     if (properties) {
-        SDL_DestroyHashTable(properties->props);
+        SDL_PropertyTable *table = properties->table;
+        Uint32 i;
+
+        if (properties->named) {
+            SDL_IterateHashTable(properties->named, SDL_FreeNamedProperty, NULL);
+            SDL_DestroyHashTable(properties->named);
+        }
+
+        if (table) {
+            for (i = 0; i <= table->mask; ++i) {
+                if (table->slots[i].atom) {
+                    SDL_FreePropertyWithCleanup(&table->slots[i].property, true);
+                }
+            }
+        }
+        while (table) {
+            SDL_PropertyTable *retired = table->retired;
+            SDL_free(table);
+            table = retired;
+        }
         SDL_DestroyMutex(properties->lock);
         SDL_free(properties);
     }
 }
 
+static SDL_PropertiesRegistry *SDL_CreatePropertiesRegistry(Uint32 size)
+{
+    SDL_PropertiesRegistry *registry = (SDL_PropertiesRegistry *)SDL_calloc(1, sizeof(*registry) + (size - 1) * sizeof(registry->entries[0]));
+    if (registry) {
+        registry->mask = size - 1;
+    }
+    return registry;
+}
+
+// The registry lock must be held, and there must be at least one empty entry
+static void SDL_InsertPropertiesEntry(SDL_PropertiesRegistry *registry, SDL_PropertiesID props, SDL_Properties *properties)
+{
+    Uint32 i;
+
+    for (i = SDL_HashPropertyKey(props) & registry->mask;; i = (i + 1) & registry->mask) {
+        SDL_PropertiesEntry *entry = &registry->entries[i];
+        if (!SDL_GetAtomicU32(&entry->id)) {
+            // Publish the properties before the ID, so readers never see a stale pointer
+            entry->properties = properties;
+            SDL_SetAtomicU32(&entry->id, props);
+            ++registry->count;
+            return;
+        }
+    }
+}
+
+// The registry lock must be held
+static bool SDL_GrowPropertiesRegistry(void)
+{
+    SDL_PropertiesRegistry *registry = (SDL_PropertiesRegistry *)SDL_GetAtomicPointer((void **)&SDL_properties);
+    SDL_PropertiesRegistry *new_registry;
+    Uint32 i;
+
+    if (SDL_LinearProbeTableHasRoom(registry->count, registry->mask + 1)) {
+        return true;
+    }
+
+    new_registry = SDL_CreatePropertiesRegistry((registry->mask + 1) * 2);
+    if (!new_registry) {
+        return false;
+    }
+    for (i = 0; i <= registry->mask; ++i) {
+        const SDL_PropertiesID props = SDL_GetAtomicU32(&registry->entries[i].id);
+        if (props) {
+            SDL_InsertPropertiesEntry(new_registry, props, registry->entries[i].properties);
+        }
+    }
+    new_registry->retired = registry;
+    SDL_SetAtomicPointer((void **)&SDL_properties, new_registry);
+    return true;
+}
+
+// The registry lock must be held
+static SDL_Properties *SDL_RemovePropertiesEntry(SDL_PropertiesRegistry *registry, SDL_PropertiesID props)
+{
+    SDL_Properties *properties;
+    Uint32 i, j;
+
+    for (i = SDL_HashPropertyKey(props) & registry->mask;; i = (i + 1) & registry->mask) {
+        const SDL_PropertiesID id = SDL_GetAtomicU32(&registry->entries[i].id);
+        if (!id) {
+            return NULL;
+        }
+        if (id == props) {
+            break;
+        }
+    }
+    properties = registry->entries[i].properties;
+
+    // Readers that look up anything while entries are moving will retry
+    SDL_AddAtomicInt(&SDL_properties_sequence, 1);
+
+    for (j = (i + 1) & registry->mask;; j = (j + 1) & registry->mask) {
+        SDL_PropertiesEntry *entry = &registry->entries[j];
+        const SDL_PropertiesID id = SDL_GetAtomicU32(&entry->id);
+        Uint32 home;
+
+        if (!id) {
+            break;
+        }
+        home = SDL_HashPropertyKey(id) & registry->mask;
+        if (((j - home) & registry->mask) >= ((j - i) & registry->mask)) {
+            registry->entries[i].properties = entry->properties;
+            SDL_SetAtomicU32(&registry->entries[i].id, id);
+            i = j;
+        }
+    }
+    SDL_SetAtomicU32(&registry->entries[i].id, 0);
+    --registry->count;
+
+    SDL_AddAtomicInt(&SDL_properties_sequence, 1);
+
+    return properties;
+}
+
+static SDL_Properties *SDL_GetProperties(SDL_PropertiesID props)
+{
+    SDL_PropertiesRegistry *registry = (SDL_PropertiesRegistry *)SDL_GetAtomicPointer((void **)&SDL_properties);
+    SDL_Properties *properties;
+    int sequence;
+    Uint32 i;
+
+    if (!registry) {
+        return NULL;
+    }
+
+    for (;;) {
+        sequence = SDL_GetAtomicInt(&SDL_properties_sequence);
+        if (sequence & 1) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+
+        properties = NULL;
+        for (i = SDL_HashPropertyKey(props) & registry->mask;; i = (i + 1) & registry->mask) {
+            const SDL_PropertiesEntry *entry = &registry->entries[i];
+            const SDL_PropertiesID id = SDL_GetAtomicU32((SDL_AtomicU32 *)&entry->id);
+            if (id == props) {
+                properties = entry->properties;
+                break;
+            }
+            if (!id) {
+                break;
+            }
+        }
+
+        SDL_MemoryBarrierAcquire();
+        if (SDL_GetAtomicInt(&SDL_properties_sequence) == sequence) {
+            return properties;
+        }
+        registry = (SDL_PropertiesRegistry *)SDL_GetAtomicPointer((void **)&SDL_properties);
+    }
+}
+
 bool SDL_InitProperties(void)
 {
     if (!SDL_ShouldInit(&SDL_properties_init)) {
         return true;
     }
 
-    SDL_properties = SDL_CreateHashTable(0, true, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
-    const bool initialized = (SDL_properties != NULL);
+    SDL_PropertiesRegistry *registry = SDL_CreatePropertiesRegistry(SDL_PROPERTIES_REGISTRY_MIN_SIZE);
+    SDL_SetAtomicPointer((void **)&SDL_properties, registry);
+    const bool initialized = (registry != NULL);
     SDL_SetInitialized(&SDL_properties_init, initialized);
     return initialized;
 }
 
-static bool SDLCALL FreeOneProperties(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
-{
-    SDL_FreeProperties((SDL_Properties *)value);
-    return true;  // keep iterating.
-}
-
 void SDL_QuitProperties(void)
 {
     if (!SDL_ShouldQuit(&SDL_properties_init)) {
@@ -123,13 +752,22 @@ void SDL_QuitProperties(void)
         SDL_DestroyProperties(props);
     }
 
-    // this can't just DestroyHashTable with SDL_FreeProperties as the destructor, because
-    //  other destructors under this might cause use to attempt a recursive lock on SDL_properties,
-    //  which isn't allowed with rwlocks. So manually iterate and free everything.
-    SDL_HashTable *properties = SDL_properties;
-    SDL_properties = NULL;
-    SDL_IterateHashTable(properties, FreeOneProperties, NULL);
-    SDL_DestroyHashTable(properties);
+    // Cleanup callbacks might call back into here, so take the registry away
+    //  first and then free everything that's left in it.
+    SDL_PropertiesRegistry *registry = (SDL_PropertiesRegistry *)SDL_GetAtomicPointer((void **)&SDL_properties);
+    SDL_SetAtomicPointer((void **)&SDL_properties, NULL);
+    for (Uint32 i = 0; i <= registry->mask; ++i) {
+        if (SDL_GetAtomicU32(&registry->entries[i].id)) {
+            SDL_FreeProperties(registry->entries[i].properties);
+        }
+    }
+    while (registry) {
+        SDL_PropertiesRegistry *retired = registry->retired;
+        SDL_free(registry);
+        registry = retired;
+    }
+
+    SDL_FreePropertyAtoms();
 
     SDL_SetInitialized(&SDL_properties_init, false);
 }
@@ -170,8 +808,8 @@ SDL_PropertiesID SDL_CreateProperties(void)
         return 0;
     }
 
-    properties->props = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, SDL_FreeProperty, NULL);
-    if (!properties->props) {
+    properties->table = SDL_CreatePropertyTable(SDL_PROPERTY_TABLE_MIN_SIZE);
+    if (!properties->table) {
         SDL_DestroyMutex(properties->lock);
         SDL_free(properties);
         return 0;
@@ -187,9 +825,16 @@ SDL_PropertiesID SDL_CreateProperties(void)
         }
     }
 
-    SDL_assert(!SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, NULL));  // should NOT be in the hash table already.
+    SDL_assert(!SDL_GetProperties(props));  // should NOT be in the registry already.
+
+    SDL_LockSpinlock(&SDL_properties_lock);
+    const bool inserted = SDL_GrowPropertiesRegistry();
+    if (inserted) {
+        SDL_InsertPropertiesEntry((SDL_PropertiesRegistry *)SDL_GetAtomicPointer((void **)&SDL_properties), props, properties);
+    }
+    SDL_UnlockSpinlock(&SDL_properties_lock);
 
-    if (!SDL_InsertIntoHashTable(SDL_properties, (const void *)(uintptr_t)props, properties, false)) {
+    if (!inserted) {
         SDL_FreeProperties(properties);
         return 0;
     }
@@ -197,54 +842,40 @@ SDL_PropertiesID SDL_CreateProperties(void)
     return props;  // All done!
 }
 
-typedef struct CopyOnePropertyData
+typedef struct
 {
     SDL_Properties *dst_properties;
     bool result;
-} CopyOnePropertyData;
+} SDL_CopyPropertiesData;
 
-static bool SDLCALL CopyOneProperty(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+// The destination must be locked for writing
+static void SDL_CopyProperty(SDL_CopyPropertiesData *data, const char *name, const SDL_Property *src)
 {
-    const SDL_Property *src_property = (const SDL_Property *)value;
-    if (src_property->cleanup) {
-        // Can't copy properties with cleanup functions, we don't know how to duplicate the data
-        return true;  // keep iterating.
-    }
-
-    CopyOnePropertyData *data = (CopyOnePropertyData *) userdata;
-    SDL_Properties *dst_properties = data->dst_properties;
-    const char *src_name = (const char *)key;
-    SDL_Property *dst_property;
-
-    char *dst_name = SDL_strdup(src_name);
-    if (!dst_name) {
-        data->result = false;
-        return true; // keep iterating (I guess...?)
-    }
+    SDL_Property property;
 
-    dst_property = (SDL_Property *)SDL_malloc(sizeof(*dst_property));
-    if (!dst_property) {
-        SDL_free(dst_name);
-        data->result = false;
-        return true; // keep iterating (I guess...?)
+    if (src->cleanup) {
+        // Can't copy properties with cleanup functions, we don't know how to duplicate the data
+        return;
     }
 
-    SDL_copyp(dst_property, src_property);
-    if (src_property->type == SDL_PROPERTY_TYPE_STRING) {
-        dst_property->value.string_value = SDL_strdup(src_property->value.string_value);
-        if (!dst_property->value.string_value) {
-            SDL_free(dst_name);
-            SDL_free(dst_property);
+    SDL_zero(property);
+    property.type = src->type;
+    property.value = src->value;
+    if (property.type == SDL_PROPERTY_TYPE_STRING) {
+        property.value.string_value = SDL_strdup(src->value.string_value);
+        if (!property.value.string_value) {
             data->result = false;
-            return true; // keep iterating (I guess...?)
+            return;
         }
     }
-
-    if (!SDL_InsertIntoHashTable(dst_properties->props, dst_name, dst_property, true)) {
-        SDL_FreePropertyWithCleanup(dst_name, dst_property, NULL, false);
+    if (!SDL_StorePropertyByName(data->dst_properties, name, &property)) {
         data->result = false;
     }
+}
 
+static bool SDLCALL SDL_CopyNamedProperty(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    SDL_CopyProperty((SDL_CopyPropertiesData *)userdata, (const char *)key, (const SDL_Property *)value);
     return true;  // keep iterating.
 }
 
@@ -257,63 +888,66 @@ bool SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
         return SDL_InvalidParamError("dst");
     }
 
-    SDL_Properties *src_properties = NULL;
-    SDL_Properties *dst_properties = NULL;
-
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)src, (const void **)&src_properties);
+    SDL_Properties *src_properties = SDL_GetProperties(src);
     CHECK_PARAM(!src_properties) {
         return SDL_InvalidParamError("src");
     }
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)dst, (const void **)&dst_properties);
+    SDL_Properties *dst_properties = SDL_GetProperties(dst);
     CHECK_PARAM(!dst_properties) {
         return SDL_InvalidParamError("dst");
     }
 
-    bool result = true;
+    SDL_CopyPropertiesData data;
+    data.dst_properties = dst_properties;
+    data.result = true;
     SDL_LockMutex(src_properties->lock);
-    SDL_LockMutex(dst_properties->lock);
+    SDL_LockPropertiesForWriting(dst_properties);
     {
-        CopyOnePropertyData data = { dst_properties, true };
-        SDL_IterateHashTable(src_properties->props, CopyOneProperty, &data);
-        result = data.result;
+        const SDL_PropertyTable *src_table = src_properties->table;
+        for (Uint32 i = 0; i <= src_table->mask; ++i) {
+            const SDL_PropertySlot *slot = &src_table->slots[i];
+            if (slot->atom) {
+                SDL_CopyProperty(&data, SDL_GetPropertyAtomName(slot->atom), &slot->property);
+            }
+        }
+        if (src_properties->num_named > 0) {
+            SDL_IterateHashTable(src_properties->named, SDL_CopyNamedProperty, &data);
+        }
     }
-    SDL_UnlockMutex(dst_properties->lock);
+    SDL_UnlockPropertiesForWriting(dst_properties);
     SDL_UnlockMutex(src_properties->lock);
 
-    return result;
+    return data.result;
 }
 
 bool SDL_LockProperties(SDL_PropertiesID props)
 {
-    SDL_Properties *properties = NULL;
-
     CHECK_PARAM(!props) {
         return SDL_InvalidParamError("props");
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    SDL_Properties *properties = SDL_GetProperties(props);
     CHECK_PARAM(!properties) {
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(properties->lock);
+    // The app might be changing several properties, so other readers have to wait too
+    SDL_LockPropertiesForWriting(properties);
     return true;
 }
 
 void SDL_UnlockProperties(SDL_PropertiesID props)
 {
-    SDL_Properties *properties = NULL;
-
     if (!props) {
         return;
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    SDL_Properties *properties = SDL_GetProperties(props);
     if (!properties) {
         return;
     }
 
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForWriting(properties);
 }
 
 static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL_Property *property)
@@ -322,39 +956,38 @@ static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL
     bool result = true;
 
     CHECK_PARAM(!props) {
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
+        if (property) {
+            SDL_FreePropertyWithCleanup(property, true);
+        }
         return SDL_InvalidParamError("props");
     }
     CHECK_PARAM(!name || !*name) {
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
+        if (property) {
+            SDL_FreePropertyWithCleanup(property, true);
+        }
         return SDL_InvalidParamError("name");
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    properties = SDL_GetProperties(props);
     CHECK_PARAM(!properties) {
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, true);
+        if (property) {
+            SDL_FreePropertyWithCleanup(property, true);
+        }
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(properties->lock);
+    SDL_LockPropertiesForWriting(properties);
     {
-        SDL_RemoveFromHashTable(properties->props, name);
-        if (property) {
-            char *key = SDL_strdup(name);
-            if (!key || !SDL_InsertIntoHashTable(properties->props, key, property, false)) {
-                SDL_FreePropertyWithCleanup(key, property, NULL, true);
-                result = false;
-            }
-        }
+        result = SDL_StorePropertyByName(properties, name, property);
     }
-    SDL_UnlockMutex(properties->lock);
+    SDL_UnlockPropertiesForWriting(properties);
 
     return result;
 }
 
 bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
 {
-    SDL_Property *property;
+    SDL_Property property;
 
     if (!value) {
         if (cleanup) {
@@ -363,36 +996,26 @@ bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name,
         return SDL_ClearProperty(props, name);
     }
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
-    if (!property) {
-        if (cleanup) {
-            cleanup(userdata, value);
-        }
-        SDL_FreePropertyWithCleanup(NULL, property, NULL, false);
-        return false;
-    }
-    property->type = SDL_PROPERTY_TYPE_POINTER;
-    property->value.pointer_value = value;
-    property->cleanup = cleanup;
-    property->userdata = userdata;
-    return SDL_PrivateSetProperty(props, name, property);
+    SDL_zero(property);
+    property.type = SDL_PROPERTY_TYPE_POINTER;
+    property.value.pointer_value = value;
+    property.cleanup = cleanup;
+    property.userdata = userdata;
+    return SDL_PrivateSetProperty(props, name, &property);
 }
 
 bool SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *value)
 {
-    SDL_Property *property;
+    SDL_Property property;
 
     if (!value) {
         return SDL_ClearProperty(props, name);
     }
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
-    if (!property) {
-        return false;
-    }
-    property->type = SDL_PROPERTY_TYPE_POINTER;
-    property->value.pointer_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    SDL_zero(property);
+    property.type = SDL_PROPERTY_TYPE_POINTER;
+    property.value.pointer_value = value;
+    return SDL_PrivateSetProperty(props, name, &property);
 }
 
 static void SDLCALL CleanupFreeableProperty(void *userdata, void *value)
@@ -419,56 +1042,49 @@ bool SDL_SetSurfaceProperty(SDL_PropertiesID props, const char *name, SDL_Surfac
 
 bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value)
 {
-    SDL_Property *property;
+    SDL_Property property;
 
     if (!value) {
         return SDL_ClearProperty(props, name);
     }
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
-    if (!property) {
-        return false;
-    }
-    property->type = SDL_PROPERTY_TYPE_STRING;
-    property->value.string_value = SDL_strdup(value);
-    if (!property->value.string_value) {
-        SDL_free(property);
+    SDL_zero(property);
+    property.type = SDL_PROPERTY_TYPE_STRING;
+    property.value.string_value = SDL_strdup(value);
+    if (!property.value.string_value) {
         return false;
     }
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, &property);
 }
 
 bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
 {
-    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
-    if (!property) {
-        return false;
-    }
-    property->type = SDL_PROPERTY_TYPE_NUMBER;
-    property->value.number_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    SDL_Property property;
+
+    SDL_zero(property);
+    property.type = SDL_PROPERTY_TYPE_NUMBER;
+    property.value.number_value = value;
+    return SDL_PrivateSetProperty(props, name, &property);
 }
 
 bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
 {
-    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
-    if (!property) {
-        return false;
-    }
-    property->type = SDL_PROPERTY_TYPE_FLOAT;
-    property->value.float_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    SDL_Property property;
+
+    SDL_zero(property);
+    property.type = SDL_PROPERTY_TYPE_FLOAT;
+    property.value.float_value = value;
+    return SDL_PrivateSetProperty(props, name, &property);
 }
 
 bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value)
 {
-    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
-    if (!property) {
-        return false;
-    }
-    property->type = SDL_PROPERTY_TYPE_BOOLEAN;
-    property->value.boolean_value = value ? true : false;
-    return SDL_PrivateSetProperty(props, name, property);
+    SDL_Property property;
+
+    SDL_zero(property);
+    property.type = SDL_PROPERTY_TYPE_BOOLEAN;
+    property.value.boolean_value = value ? true : false;
+    return SDL_PrivateSetProperty(props, name, &property);
 }
 
 bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
@@ -479,274 +1095,350 @@ bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
 SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
 {
     SDL_Properties *properties = NULL;
-    SDL_PropertyType type = SDL_PROPERTY_TYPE_INVALID;
+    SDL_Property property;
 
-    if (!props) {
-        return SDL_PROPERTY_TYPE_INVALID;
-    }
-    if (!name || !*name) {
+    if (!props || !name || !*name) {
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    properties = SDL_GetProperties(props);
     if (!properties) {
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
-    SDL_LockMutex(properties->lock);
-    {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
-            type = property->type;
-        }
+    if (SDL_ReadProperty(properties, SDL_LookupPropertyAtom(name), name, &property)) {
+        return property.type;
+    }
+    return SDL_PROPERTY_TYPE_INVALID;
+}
+
+SDL_PropertyAtom SDL_GetPropertyAtom(const char *name)
+{
+    CHECK_PARAM(!name || !*name) {
+        SDL_InvalidParamError("name");
+        return 0;
     }
-    SDL_UnlockMutex(properties->lock);
 
-    return type;
+    if (!SDL_CheckInitProperties()) {
+        return 0;
+    }
+
+    return SDL_InternPropertyName(name);
 }
 
-void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value)
+// `atom` and `name` are as for SDL_FindLockedProperty()
+static void *SDL_GetPointerPropertyInternal(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, void *default_value)
 {
     SDL_Properties *properties = NULL;
+    SDL_Property property;
     void *value = default_value;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || (!atom && !name)) {
         return value;
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    properties = SDL_GetProperties(props);
     if (!properties) {
         return value;
     }
 
-    // Note that taking the lock here only guarantees that we won't read the
-    // hashtable while it's being modified. The value itself can easily be
-    // freed from another thread after it is returned here.
-    SDL_LockMutex(properties->lock);
-    {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
-            if (property->type == SDL_PROPERTY_TYPE_POINTER) {
-                value = property->value.pointer_value;
-            }
+    // Note that the value can easily be freed from another thread after it
+    // is returned here, holding the lock wouldn't change that.
+    if (SDL_ReadProperty(properties, atom, name, &property)) {
+        if (property.type == SDL_PROPERTY_TYPE_POINTER) {
+            value = property.value.pointer_value;
         }
     }
-    SDL_UnlockMutex(properties->lock);
 
     return value;
 }
 
-const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+void *SDL_GetPointerPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, void *default_value)
+{
+    return SDL_GetPointerPropertyInternal(props, atom, NULL, default_value);
+}
+
+void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value)
+{
+    if (!name || !*name) {
+        return default_value;
+    }
+    return SDL_GetPointerPropertyInternal(props, SDL_LookupPropertyAtom(name), name, default_value);
+}
+
+// `atom` and `name` are as for SDL_FindLockedProperty()
+static const char *SDL_GetStringPropertyInternal(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, const char *default_value)
 {
     SDL_Properties *properties = NULL;
+    SDL_Property property;
     const char *value = default_value;
 
-    if (!props) {
+    if (!props || (!atom && !name)) {
         return value;
     }
-    if (!name || !*name) {
+
+    properties = SDL_GetProperties(props);
+    if (!properties) {
         return value;
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    if (!properties) {
+    if (!SDL_ReadProperty(properties, atom, name, &property)) {
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
-    {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
-            switch (property->type) {
-            case SDL_PROPERTY_TYPE_STRING:
-                value = property->value.string_value;
-                break;
-            case SDL_PROPERTY_TYPE_NUMBER:
-                if (property->string_storage) {
-                    value = property->string_storage;
-                } else {
-                    SDL_asprintf(&property->string_storage, "%" SDL_PRIs64, property->value.number_value);
-                    if (property->string_storage) {
-                        value = property->string_storage;
-                    }
+    switch (property.type) {
+    case SDL_PROPERTY_TYPE_STRING:
+        value = property.value.string_value;
+        break;
+    case SDL_PROPERTY_TYPE_NUMBER:
+    case SDL_PROPERTY_TYPE_FLOAT:
+        if (property.string_storage) {
+            value = property.string_storage;
+            break;
+        }
+
+        // The string is made the first time it's asked for, and kept with the property
+        SDL_LockMutex(properties->lock);
+        {
+            SDL_Property *stored = SDL_FindLockedProperty(properties, atom, name);
+            if (stored && stored->type == SDL_PROPERTY_TYPE_NUMBER) {
+                if (!stored->string_storage) {
+                    char *string_storage = NULL;
+                    SDL_asprintf(&string_storage, "%" SDL_PRIs64, stored->value.number_value);
+                    SDL_SetAtomicPointer((void **)&stored->string_storage, string_storage);
                 }
-                break;
-            case SDL_PROPERTY_TYPE_FLOAT:
-                if (property->string_storage) {
-                    value = property->string_storage;
-                } else {
-                    SDL_asprintf(&property->string_storage, "%f", property->value.float_value);
-                    if (property->string_storage) {
-                        value = property->string_storage;
-                    }
+            } else if (stored && stored->type == SDL_PROPERTY_TYPE_FLOAT) {
+                if (!stored->string_storage) {
+                    char *string_storage = NULL;
+                    SDL_asprintf(&string_storage, "%f", stored->value.float_value);
+                    SDL_SetAtomicPointer((void **)&stored->string_storage, string_storage);
                 }
-                break;
-            case SDL_PROPERTY_TYPE_BOOLEAN:
-                value = property->value.boolean_value ? "true" : "false";
-                break;
-            default:
-                break;
+            }
+            if (stored && stored->string_storage) {
+                value = stored->string_storage;
             }
         }
+        SDL_UnlockMutex(properties->lock);
+        break;
+    case SDL_PROPERTY_TYPE_BOOLEAN:
+        value = property.value.boolean_value ? "true" : "false";
+        break;
+    default:
+        break;
     }
-    SDL_UnlockMutex(properties->lock);
 
     return value;
 }
 
-Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+const char *SDL_GetStringPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *default_value)
+{
+    return SDL_GetStringPropertyInternal(props, atom, NULL, default_value);
+}
+
+const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+{
+    if (!name || !*name) {
+        return default_value;
+    }
+    return SDL_GetStringPropertyInternal(props, SDL_LookupPropertyAtom(name), name, default_value);
+}
+
+static Sint64 SDL_PropertyToNumber(const SDL_Property *property, Sint64 default_value)
+{
+    switch (property->type) {
+    case SDL_PROPERTY_TYPE_STRING:
+        return (Sint64)SDL_strtoll(property->value.string_value, NULL, 0);
+    case SDL_PROPERTY_TYPE_NUMBER:
+        return property->value.number_value;
+    case SDL_PROPERTY_TYPE_FLOAT:
+        return (Sint64)SDL_round((double)property->value.float_value);
+    case SDL_PROPERTY_TYPE_BOOLEAN:
+        return property->value.boolean_value;
+    default:
+        return default_value;
+    }
+}
+
+// `atom` and `name` are as for SDL_FindLockedProperty()
+static Sint64 SDL_GetNumberPropertyInternal(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, Sint64 default_value)
 {
     SDL_Properties *properties = NULL;
+    SDL_Property property;
     Sint64 value = default_value;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || (!atom && !name)) {
         return value;
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    properties = SDL_GetProperties(props);
     if (!properties) {
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
-    {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
-            switch (property->type) {
-            case SDL_PROPERTY_TYPE_STRING:
-                value = (Sint64)SDL_strtoll(property->value.string_value, NULL, 0);
-                break;
-            case SDL_PROPERTY_TYPE_NUMBER:
-                value = property->value.number_value;
-                break;
-            case SDL_PROPERTY_TYPE_FLOAT:
-                value = (Sint64)SDL_round((double)property->value.float_value);
-                break;
-            case SDL_PROPERTY_TYPE_BOOLEAN:
-                value = property->value.boolean_value;
-                break;
-            default:
-                break;
+    if (SDL_ReadProperty(properties, atom, name, &property)) {
+        if (property.type == SDL_PROPERTY_TYPE_STRING) {
+            // A writer could free the string once it's copied out, so parse it under the lock
+            SDL_LockMutex(properties->lock);
+            if (SDL_ReadProperty(properties, atom, name, &property)) {
+                value = SDL_PropertyToNumber(&property, default_value);
             }
+            SDL_UnlockMutex(properties->lock);
+        } else {
+            value = SDL_PropertyToNumber(&property, default_value);
         }
     }
-    SDL_UnlockMutex(properties->lock);
 
     return value;
 }
 
-float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+Sint64 SDL_GetNumberPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, Sint64 default_value)
+{
+    return SDL_GetNumberPropertyInternal(props, atom, NULL, default_value);
+}
+
+Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+{
+    if (!name || !*name) {
+        return default_value;
+    }
+    return SDL_GetNumberPropertyInternal(props, SDL_LookupPropertyAtom(name), name, default_value);
+}
+
+static float SDL_PropertyToFloat(const SDL_Property *property, float default_value)
+{
+    switch (property->type) {
+    case SDL_PROPERTY_TYPE_STRING:
+        return (float)SDL_atof(property->value.string_value);
+    case SDL_PROPERTY_TYPE_NUMBER:
+        return (float)property->value.number_value;
+    case SDL_PROPERTY_TYPE_FLOAT:
+        return property->value.float_value;
+    case SDL_PROPERTY_TYPE_BOOLEAN:
+        return (float)property->value.boolean_value;
+    default:
+        return default_value;
+    }
+}
+
+// `atom` and `name` are as for SDL_FindLockedProperty()
+static float SDL_GetFloatPropertyInternal(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, float default_value)
 {
     SDL_Properties *properties = NULL;
+    SDL_Property property;
     float value = default_value;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || (!atom && !name)) {
         return value;
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    properties = SDL_GetProperties(props);
     if (!properties) {
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
-    {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
-            switch (property->type) {
-            case SDL_PROPERTY_TYPE_STRING:
-                value = (float)SDL_atof(property->value.string_value);
-                break;
-            case SDL_PROPERTY_TYPE_NUMBER:
-                value = (float)property->value.number_value;
-                break;
-            case SDL_PROPERTY_TYPE_FLOAT:
-                value = property->value.float_value;
-                break;
-            case SDL_PROPERTY_TYPE_BOOLEAN:
-                value = (float)property->value.boolean_value;
-                break;
-            default:
-                break;
+    if (SDL_ReadProperty(properties, atom, name, &property)) {
+        if (property.type == SDL_PROPERTY_TYPE_STRING) {
+            SDL_LockMutex(properties->lock);
+            if (SDL_ReadProperty(properties, atom, name, &property)) {
+                value = SDL_PropertyToFloat(&property, default_value);
             }
+            SDL_UnlockMutex(properties->lock);
+        } else {
+            value = SDL_PropertyToFloat(&property, default_value);
         }
     }
-    SDL_UnlockMutex(properties->lock);
 
     return value;
 }
 
-bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
+float SDL_GetFloatPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, float default_value)
+{
+    return SDL_GetFloatPropertyInternal(props, atom, NULL, default_value);
+}
+
+float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+{
+    if (!name || !*name) {
+        return default_value;
+    }
+    return SDL_GetFloatPropertyInternal(props, SDL_LookupPropertyAtom(name), name, default_value);
+}
+
+static bool SDL_PropertyToBoolean(const SDL_Property *property, bool default_value)
+{
+    switch (property->type) {
+    case SDL_PROPERTY_TYPE_STRING:
+        return SDL_GetStringBoolean(property->value.string_value, default_value);
+    case SDL_PROPERTY_TYPE_NUMBER:
+        return (property->value.number_value != 0);
+    case SDL_PROPERTY_TYPE_FLOAT:
+        return (property->value.float_value != 0.0f);
+    case SDL_PROPERTY_TYPE_BOOLEAN:
+        return property->value.boolean_value;
+    default:
+        return default_value;
+    }
+}
+
+// `atom` and `name` are as for SDL_FindLockedProperty()
+static bool SDL_GetBooleanPropertyInternal(SDL_PropertiesID props, SDL_PropertyAtom atom, const char *name, bool default_value)
 {
     SDL_Properties *properties = NULL;
+    SDL_Property property;
     bool value = default_value ? true : false;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
+    if (!props || (!atom && !name)) {
         return value;
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    properties = SDL_GetProperties(props);
     if (!properties) {
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
-    {
-        SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
-            switch (property->type) {
-            case SDL_PROPERTY_TYPE_STRING:
-                value = SDL_GetStringBoolean(property->value.string_value, default_value);
-                break;
-            case SDL_PROPERTY_TYPE_NUMBER:
-                value = (property->value.number_value != 0);
-                break;
-            case SDL_PROPERTY_TYPE_FLOAT:
-                value = (property->value.float_value != 0.0f);
-                break;
-            case SDL_PROPERTY_TYPE_BOOLEAN:
-                value = property->value.boolean_value;
-                break;
-            default:
-                break;
+    if (SDL_ReadProperty(properties, atom, name, &property)) {
+        if (property.type == SDL_PROPERTY_TYPE_STRING) {
+            SDL_LockMutex(properties->lock);
+            if (SDL_ReadProperty(properties, atom, name, &property)) {
+                value = SDL_PropertyToBoolean(&property, value);
             }
+            SDL_UnlockMutex(properties->lock);
+        } else {
+            value = SDL_PropertyToBoolean(&property, value);
         }
     }
-    SDL_UnlockMutex(properties->lock);
 
     return value;
 }
 
+bool SDL_GetBooleanPropertyByAtom(SDL_PropertiesID props, SDL_PropertyAtom atom, bool default_value)
+{
+    return SDL_GetBooleanPropertyInternal(props, atom, NULL, default_value);
+}
+
+bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
+{
+    if (!name || !*name) {
+        return default_value;
+    }
+    return SDL_GetBooleanPropertyInternal(props, SDL_LookupPropertyAtom(name), name, default_value);
+}
+
 bool SDL_ClearProperty(SDL_PropertiesID props, const char *name)
 {
     return SDL_PrivateSetProperty(props, name, NULL);
 }
 
-typedef struct EnumerateOnePropertyData
+typedef struct
 {
+    SDL_PropertiesID props;
     SDL_EnumeratePropertiesCallback callback;
     void *userdata;
-    SDL_PropertiesID props;
-} EnumerateOnePropertyData;
-
+} SDL_EnumeratePropertiesData;
 
-static bool SDLCALL EnumerateOneProperty(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+static bool SDLCALL SDL_EnumerateNamedProperty(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
 {
-    (void) table;
-    (void) value;
-    const EnumerateOnePropertyData *data = (const EnumerateOnePropertyData *) userdata;
+    const SDL_EnumeratePropertiesData *data = (const SDL_EnumeratePropertiesData *)userdata;
     data->callback(data->userdata, data->props, (const char *)key);
     return true;  // keep iterating.
 }
@@ -762,15 +1454,26 @@ bool SDL_EnumerateProperties(SDL_PropertiesID props, SDL_EnumeratePropertiesCall
         return SDL_InvalidParamError("callback");
     }
 
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    properties = SDL_GetProperties(props);
     CHECK_PARAM(!properties) {
         return SDL_InvalidParamError("props");
     }
 
     SDL_LockMutex(properties->lock);
     {
-        EnumerateOnePropertyData data = { callback, userdata, props };
-        SDL_IterateHashTable(properties->props, EnumerateOneProperty, &data);
+        const SDL_PropertyTable *table = properties->table;
+        for (Uint32 i = 0; i <= table->mask; ++i) {
+            if (table->slots[i].atom) {
+                callback(userdata, props, SDL_GetPropertyAtomName(table->slots[i].atom));
+            }
+        }
+        if (properties->num_named > 0) {
+            SDL_EnumeratePropertiesData data;
+            data.props = props;
+            data.callback = callback;
+            data.userdata = userdata;
+            SDL_IterateHashTable(properties->named, SDL_EnumerateNamedProperty, &data);
+        }
     }
     SDL_UnlockMutex(properties->lock);
 
@@ -812,13 +1515,16 @@ bool SDL_DumpProperties(SDL_PropertiesID props)
 void SDL_DestroyProperties(SDL_PropertiesID props)
 {
     if (props) {
-        // this can't just use RemoveFromHashTable with SDL_FreeProperties as the destructor, because
-        //  other destructors under this might cause use to attempt a recursive lock on SDL_properties,
-        //  which isn't allowed with rwlocks. So manually look it up and remove/free it.
+        // Take it out of the registry before freeing it, since cleanup callbacks
+        //  might create or destroy other properties.
         SDL_Properties *properties = NULL;
-        if (SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties)) {
-            SDL_FreeProperties(properties);
-            SDL_RemoveFromHashTable(SDL_properties, (const void *)(uintptr_t)props);
+        SDL_LockSpinlock(&SDL_properties_lock);
+        SDL_PropertiesRegistry *registry = (SDL_PropertiesRegistry *)SDL_GetAtomicPointer((void **)&SDL_properties);
+        if (registry) {
+            properties = SDL_RemovePropertiesEntry(registry, props);
         }
+        SDL_UnlockSpinlock(&SDL_properties_lock);
+
+        SDL_FreeProperties(properties);
     }
 }
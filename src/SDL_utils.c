@@ -54,6 +54,11 @@ int SDL_powerof2(int x)
     return value;
 }
 
+bool SDL_LinearProbeTableHasRoom(Uint32 count, Uint32 size)
+{
+    return ((Uint64)count + 1) * 4 <= (Uint64)size * 3;
+}
+
 Uint32 SDL_CalculateGCD(Uint32 a, Uint32 b)
 {
     if (b == 0) {
@@ -135,8 +140,37 @@ Uint32 SDL_GetNextObjectID(void)
     return id;
 }
 
+/* Valid objects are kept in an open addressed table of atomic slots, so
+ * looking one up is a few atomic loads and never takes a lock, no matter how
+ * many threads are validating handles at once.
+ *
+ * Adding and removing objects is serialized by a spinlock. Removing an object
+ * shifts the entries after it back, so lookups recheck a sequence count
+ * before trusting a hit or a miss, to make sure nothing moved under them.
+ * When the table grows, readers might still be probing the old one, so it is
+ * kept until all the objects are invalidated at shutdown. Tables only grow, so
+ * this is bounded by the size of the largest table.
+ */
+typedef struct SDL_ObjectSlot
+{
+    void *object;
+    SDL_AtomicInt type;
+} SDL_ObjectSlot;
+
+typedef struct SDL_ObjectTable
+{
+    Uint32 mask;
+    Uint32 count;
+    struct SDL_ObjectTable *retired;
+    SDL_ObjectSlot slots[1];
+} SDL_ObjectTable;
+
+#define SDL_OBJECT_TABLE_MIN_SIZE 64
+
 static SDL_InitState SDL_objects_init;
-static SDL_HashTable *SDL_objects;
+static SDL_ObjectTable *SDL_objects;
+static SDL_AtomicInt SDL_objects_sequence;
+static SDL_SpinLock SDL_objects_lock;
 bool SDL_object_validation = false;
 
 static void SDLCALL SDL_InvalidParamChecksChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
@@ -164,14 +198,107 @@ static void SDLCALL SDL_InvalidParamChecksChanged(void *userdata, const char *na
     SDL_object_validation = validation_enabled;
 }
 
-static Uint32 SDLCALL SDL_HashObject(void *unused, const void *key)
+static SDL_INLINE Uint32 SDL_HashObject(const void *object)
+{
+    return (Uint32)(((Uint64)(uintptr_t)object * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+static SDL_ObjectTable *SDL_CreateObjectTable(Uint32 size)
 {
-    return (Uint32)(uintptr_t)key;
+    SDL_ObjectTable *table = (SDL_ObjectTable *)SDL_calloc(1, sizeof(*table) + (size - 1) * sizeof(table->slots[0]));
+    if (table) {
+        table->mask = size - 1;
+    }
+    return table;
 }
 
-static bool SDL_KeyMatchObject(void *unused, const void *a, const void *b)
+// The lock must be held, and there must be at least one empty slot
+static void SDL_InsertObjectSlot(SDL_ObjectTable *table, void *object, SDL_ObjectType type)
 {
-    return (a == b);
+    Uint32 i;
+
+    for (i = SDL_HashObject(object) & table->mask;; i = (i + 1) & table->mask) {
+        SDL_ObjectSlot *slot = &table->slots[i];
+        void *slot_object = SDL_GetAtomicPointer(&slot->object);
+        if (slot_object == object) {
+            SDL_SetAtomicInt(&slot->type, type);
+            return;
+        }
+        if (!slot_object) {
+            // Publish the type before the object, so readers never see a stale type
+            SDL_SetAtomicInt(&slot->type, type);
+            SDL_SetAtomicPointer(&slot->object, object);
+            ++table->count;
+            return;
+        }
+    }
+}
+
+// The lock must be held
+static bool SDL_GrowObjectTable(void)
+{
+    SDL_ObjectTable *table = (SDL_ObjectTable *)SDL_GetAtomicPointer((void **)&SDL_objects);
+    SDL_ObjectTable *new_table;
+    Uint32 i;
+
+    if (SDL_LinearProbeTableHasRoom(table->count, table->mask + 1)) {
+        return true;
+    }
+
+    new_table = SDL_CreateObjectTable((table->mask + 1) * 2);
+    if (!new_table) {
+        return false;
+    }
+    for (i = 0; i <= table->mask; ++i) {
+        void *object = SDL_GetAtomicPointer(&table->slots[i].object);
+        if (object) {
+            SDL_InsertObjectSlot(new_table, object, (SDL_ObjectType)SDL_GetAtomicInt(&table->slots[i].type));
+        }
+    }
+    // Readers may still be probing the old table, so it's retired rather than freed
+    new_table->retired = table;
+    SDL_SetAtomicPointer((void **)&SDL_objects, new_table);
+    return true;
+}
+
+// The lock must be held
+static void SDL_RemoveObjectSlot(SDL_ObjectTable *table, void *object)
+{
+    Uint32 i, j;
+
+    for (i = SDL_HashObject(object) & table->mask;; i = (i + 1) & table->mask) {
+        void *slot_object = SDL_GetAtomicPointer(&table->slots[i].object);
+        if (!slot_object) {
+            return;
+        }
+        if (slot_object == object) {
+            break;
+        }
+    }
+
+    // Readers that miss while entries are moving will retry
+    SDL_AddAtomicInt(&SDL_objects_sequence, 1);
+
+    // Shift back any following entries that would no longer be reachable
+    for (j = (i + 1) & table->mask;; j = (j + 1) & table->mask) {
+        SDL_ObjectSlot *slot = &table->slots[j];
+        void *slot_object = SDL_GetAtomicPointer(&slot->object);
+        Uint32 home;
+
+        if (!slot_object) {
+            break;
+        }
+        home = SDL_HashObject(slot_object) & table->mask;
+        if (((j - home) & table->mask) >= ((j - i) & table->mask)) {
+            SDL_SetAtomicInt(&table->slots[i].type, SDL_GetAtomicInt(&slot->type));
+            SDL_SetAtomicPointer(&table->slots[i].object, slot_object);
+            i = j;
+        }
+    }
+    SDL_SetAtomicPointer(&table->slots[i].object, NULL);
+    --table->count;
+
+    SDL_AddAtomicInt(&SDL_objects_sequence, 1);
 }
 
 void SDL_SetObjectValid(void *object, SDL_ObjectType type, bool valid)
@@ -179,8 +306,9 @@ void SDL_SetObjectValid(void *object, SDL_ObjectType type, bool valid)
     SDL_assert(object != NULL);
 
     if (SDL_ShouldInit(&SDL_objects_init)) {
-        SDL_objects = SDL_CreateHashTable(0, true, SDL_HashObject, SDL_KeyMatchObject, NULL, NULL);
-        const bool initialized = (SDL_objects != NULL);
+        SDL_ObjectTable *table = SDL_CreateObjectTable(SDL_OBJECT_TABLE_MIN_SIZE);
+        const bool initialized = (table != NULL);
+        SDL_SetAtomicPointer((void **)&SDL_objects, table);
         SDL_SetInitialized(&SDL_objects_init, initialized);
         if (!initialized) {
             return;
@@ -188,55 +316,87 @@ void SDL_SetObjectValid(void *object, SDL_ObjectType type, bool valid)
         SDL_AddHintCallback(SDL_HINT_INVALID_PARAM_CHECKS, SDL_InvalidParamChecksChanged, NULL);
     }
 
+    SDL_LockSpinlock(&SDL_objects_lock);
     if (valid) {
-        SDL_InsertIntoHashTable(SDL_objects, object, (void *)(uintptr_t)type, true);
+        if (SDL_GrowObjectTable()) {
+            SDL_InsertObjectSlot((SDL_ObjectTable *)SDL_GetAtomicPointer((void **)&SDL_objects), object, type);
+        }
     } else {
-        SDL_RemoveFromHashTable(SDL_objects, object);
+        SDL_RemoveObjectSlot((SDL_ObjectTable *)SDL_GetAtomicPointer((void **)&SDL_objects), object);
     }
+    SDL_UnlockSpinlock(&SDL_objects_lock);
 }
 
 bool SDL_FindObject(void *object, SDL_ObjectType type)
 {
-    const void *object_type;
-    if (!SDL_FindInHashTable(SDL_objects, object, &object_type)) {
+    SDL_ObjectTable *table = (SDL_ObjectTable *)SDL_GetAtomicPointer((void **)&SDL_objects);
+    int sequence;
+    Uint32 i;
+
+    if (!table) {
         return false;
     }
 
-    return (((SDL_ObjectType)(uintptr_t)object_type) == type);
-}
+    for (;;) {
+        sequence = SDL_GetAtomicInt(&SDL_objects_sequence);
+        if (sequence & 1) {
+            SDL_CPUPauseInstruction();
+            continue;
+        }
 
-typedef struct GetOneObjectData
-{
-    const SDL_ObjectType type;
-    void **objects;
-    const int count;
-    int num_objects;
-} GetOneObjectData;
+        for (i = SDL_HashObject(object) & table->mask;; i = (i + 1) & table->mask) {
+            const SDL_ObjectSlot *slot = &table->slots[i];
+            void *slot_object = SDL_GetAtomicPointer((void **)&slot->object);
+            if (slot_object == object) {
+                const int slot_type = SDL_GetAtomicInt((SDL_AtomicInt *)&slot->type);
 
-static bool SDLCALL GetOneObject(void *userdata, const SDL_HashTable *table, const void *object, const void *object_type)
-{
-    GetOneObjectData *data = (GetOneObjectData *) userdata;
-    if ((SDL_ObjectType)(uintptr_t)object_type == data->type) {
-        if (data->num_objects < data->count) {
-            data->objects[data->num_objects] = (void *)object;
+                // A removal may have shifted another entry's type into this slot ahead of its pointer
+                if (SDL_GetAtomicPointer((void **)&slot->object) == object &&
+                    SDL_GetAtomicInt(&SDL_objects_sequence) == sequence) {
+                    return (slot_type == (int)type);
+                }
+                break;
+            }
+            if (!slot_object) {
+                if (SDL_GetAtomicInt(&SDL_objects_sequence) == sequence) {
+                    return false;
+                }
+                break;
+            }
         }
-        ++data->num_objects;
+
+        // Entries moved while we were looking, try again
+        table = (SDL_ObjectTable *)SDL_GetAtomicPointer((void **)&SDL_objects);
     }
-    return true;  // keep iterating.
 }
 
-
 int SDL_GetObjects(SDL_ObjectType type, void **objects, int count)
 {
-    GetOneObjectData data = { type, objects, count, 0 };
-    SDL_IterateHashTable(SDL_objects, GetOneObject, &data);
-    return data.num_objects;
+    SDL_ObjectTable *table;
+    int num_objects = 0;
+    Uint32 i;
+
+    SDL_LockSpinlock(&SDL_objects_lock);
+    table = (SDL_ObjectTable *)SDL_GetAtomicPointer((void **)&SDL_objects);
+    if (table) {
+        for (i = 0; i <= table->mask; ++i) {
+            void *object = SDL_GetAtomicPointer(&table->slots[i].object);
+            if (object && (SDL_ObjectType)SDL_GetAtomicInt(&table->slots[i].type) == type) {
+                if (num_objects < count) {
+                    objects[num_objects] = object;
+                }
+                ++num_objects;
+            }
+        }
+    }
+    SDL_UnlockSpinlock(&SDL_objects_lock);
+    return num_objects;
 }
 
-static bool SDLCALL LogOneLeakedObject(void *userdata, const SDL_HashTable *table, const void *object, const void *object_type)
+static void LogOneLeakedObject(const void *object, SDL_ObjectType object_type)
 {
     const char *type = "unknown object";
-    switch ((SDL_ObjectType)(uintptr_t)object_type) {
+    switch (object_type) {
         #define SDLOBJTYPECASE(typ, name) case SDL_OBJECT_TYPE_##typ: type = name; break
         SDLOBJTYPECASE(WINDOW, "SDL_Window");
         SDLOBJTYPECASE(RENDERER, "SDL_Renderer");
@@ -253,17 +413,29 @@ static bool SDLCALL LogOneLeakedObject(void *userdata, const SDL_HashTable *tabl
         default: break;
     }
     SDL_Log("Leaked %s (%p)", type, object);
-    return true;  // keep iterating.
 }
 
 void SDL_SetObjectsInvalid(void)
 {
     if (SDL_ShouldQuit(&SDL_objects_init)) {
+        SDL_ObjectTable *table = (SDL_ObjectTable *)SDL_GetAtomicPointer((void **)&SDL_objects);
+        Uint32 i;
+
         // Log any leaked objects
-        SDL_IterateHashTable(SDL_objects, LogOneLeakedObject, NULL);
-        SDL_assert(SDL_HashTableEmpty(SDL_objects));
-        SDL_DestroyHashTable(SDL_objects);
-        SDL_objects = NULL;
+        for (i = 0; i <= table->mask; ++i) {
+            void *object = SDL_GetAtomicPointer(&table->slots[i].object);
+            if (object) {
+                LogOneLeakedObject(object, (SDL_ObjectType)SDL_GetAtomicInt(&table->slots[i].type));
+            }
+        }
+        SDL_assert(table->count == 0);
+
+        SDL_SetAtomicPointer((void **)&SDL_objects, NULL);
+        while (table) {
+            SDL_ObjectTable *retired = table->retired;
+            SDL_free(table);
+            table = retired;
+        }
         SDL_SetInitialized(&SDL_objects_init, false);
         SDL_RemoveHintCallback(SDL_HINT_INVALID_PARAM_CHECKS, SDL_InvalidParamChecksChanged, NULL);
     }
@@ -29,6 +29,12 @@
 // Return the smallest power of 2 greater than or equal to 'x'
 extern int SDL_powerof2(int x);
 
+/* Return true if a linear probing table with 'size' slots, 'count' of them
+   in use, can take one more entry. The lock-free tables for objects and
+   properties are kept at most 3/4 full, so lookups that run without a lock
+   stay short and always reach an empty slot. */
+extern bool SDL_LinearProbeTableHasRoom(Uint32 count, Uint32 size);
+
 extern Uint32 SDL_CalculateGCD(Uint32 a, Uint32 b);
 extern void SDL_CalculateFraction(float x, int *numerator, int *denominator);
 
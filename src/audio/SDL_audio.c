@@ -1150,13 +1150,171 @@ void SDL_AudioThreadFinalize(SDL_AudioDevice *device)
 {
 }
 
-static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
+// The device chmap to swizzle a bound stream's output through while mixing, or NULL if they already line up.
+static const int *GetMixChannelMap(SDL_AudioDevice *device, SDL_AudioStream *stream)
 {
-    if (!SDL_MixAudio((Uint8 *) dst, (const Uint8 *) src, SDL_AUDIO_F32, buffer_size, 1.0f)) {
-        SDL_assert(!"This shouldn't happen.");
+    return SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap) ? NULL : device->chmap;
+}
+
+
+// Parallel mixing: with enough streams bound to a logical device, each stream is pulled and mixed on a worker,
+//  into that worker's own buffer, and the per-worker buffers are summed pairwise at the end.
+//  The device lock is held by the device thread for the whole time, so the binding lists can't change under the
+//  workers, and each stream's own lock is still taken in SDL_MixAudioStreamData.
+
+#define MIN_STREAMS_FOR_PARALLEL_MIX 4
+
+typedef struct ParallelMixState
+{
+    SDL_AudioDevice *device;
+    SDL_LogicalAudioDevice *logdev;
+    int work_buffer_size;
+    int reduce_stride;
+    int num_workers;
+    bool accumulated[SDL_MAX_AUDIO_MIX_WORKERS];
+    SDL_AtomicInt failed;
+} ParallelMixState;
+
+static float *GetMixWorkerAccumulator(SDL_AudioDevice *device, int worker)
+{
+    return (float *) (device->mix_pool_buffers + (worker * device->mix_pool_buffer_size));
+}
+
+static void ParallelMixStream(void *userdata, int task, int worker)
+{
+    ParallelMixState *state = (ParallelMixState *) userdata;
+    SDL_AudioDevice *device = state->device;
+    SDL_AudioStream *stream = device->mix_pool_streams[task];
+    float *accum = GetMixWorkerAccumulator(device, worker);
+
+    if (!state->accumulated[worker]) {  // first thing this worker mixed this period, start with silence.
+        SDL_memset(accum, '\0', state->work_buffer_size);
+        state->accumulated[worker] = true;
+    }
+
+    const int br = SDL_MixAudioStreamData(stream, accum, state->work_buffer_size, state->logdev->gain, GetMixChannelMap(device, stream));
+    if (br < 0) {
+        SDL_SetAtomicInt(&state->failed, 1);
     }
 }
 
+static void ParallelMixReduce(void *userdata, int task, int worker)
+{
+    ParallelMixState *state = (ParallelMixState *) userdata;
+    SDL_AudioDevice *device = state->device;
+    const int dst = task * state->reduce_stride * 2;
+    const int src = dst + state->reduce_stride;
+
+    if ((src < state->num_workers) && state->accumulated[src]) {
+        if (state->accumulated[dst]) {
+            MixFloat32Audio(GetMixWorkerAccumulator(device, dst), GetMixWorkerAccumulator(device, src), state->work_buffer_size / sizeof (float), 1.0f);
+        } else {
+            SDL_memcpy(GetMixWorkerAccumulator(device, dst), GetMixWorkerAccumulator(device, src), state->work_buffer_size);
+            state->accumulated[dst] = true;
+        }
+    }
+}
+
+// Returns false if there's no parallel mix available (or worthwhile) for this logical device, in which case the caller should mix serially.
+static bool ParallelMixLogicalDevice(SDL_AudioDevice *device, SDL_LogicalAudioDevice *logdev, float *mix_buffer, int work_buffer_size, bool *failed)
+{
+    if (!device->mix_pool) {
+        return false;
+    }
+
+    int num_streams = 0;
+    for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+        num_streams++;
+    }
+
+    if (num_streams < MIN_STREAMS_FOR_PARALLEL_MIX) {
+        return false;
+    }
+
+    const int num_workers = SDL_GetWorkerPoolThreadCount(device->mix_pool) + 1;
+    SDL_assert(num_workers <= SDL_MAX_AUDIO_MIX_WORKERS);
+
+    if (device->mix_pool_buffer_size < work_buffer_size) {
+        SDL_aligned_free(device->mix_pool_buffers);
+        device->mix_pool_buffer_size = 0;
+        device->mix_pool_buffers = (Uint8 *) SDL_aligned_alloc(SDL_GetSIMDAlignment(), ((size_t) device->work_buffer_size) * num_workers);
+        if (!device->mix_pool_buffers) {
+            return false;
+        }
+        device->mix_pool_buffer_size = device->work_buffer_size;
+    }
+
+    if (device->mix_pool_streams_allocated < num_streams) {
+        SDL_AudioStream **ptr = (SDL_AudioStream **) SDL_realloc(device->mix_pool_streams, sizeof (*ptr) * num_streams);
+        if (!ptr) {
+            return false;
+        }
+        device->mix_pool_streams = ptr;
+        device->mix_pool_streams_allocated = num_streams;
+    }
+
+    int i = 0;
+    for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+        // We should have updated this elsewhere if the format changed!
+        SDL_assert(stream->src_spec.format != SDL_AUDIO_UNKNOWN);
+        device->mix_pool_streams[i++] = stream;
+    }
+
+    ParallelMixState state;
+    SDL_zero(state);
+    state.device = device;
+    state.logdev = logdev;
+    state.work_buffer_size = work_buffer_size;
+    state.num_workers = num_workers;
+
+    SDL_RunWorkerPool(device->mix_pool, num_streams, ParallelMixStream, &state);
+
+    // tree reduction: fold worker 1 into 0, 3 into 2, etc, then 2 into 0, and so on.
+    for (state.reduce_stride = 1; state.reduce_stride < num_workers; state.reduce_stride *= 2) {
+        const int pairs = (num_workers + (state.reduce_stride * 2) - 1) / (state.reduce_stride * 2);
+        SDL_RunWorkerPool(device->mix_pool, pairs, ParallelMixReduce, &state);
+    }
+
+    if (state.accumulated[0]) {
+        MixFloat32Audio(mix_buffer, GetMixWorkerAccumulator(device, 0), work_buffer_size / sizeof (float), 1.0f);
+    }
+
+    if (SDL_GetAtomicInt(&state.failed)) {
+        *failed = true;
+    }
+
+    return true;
+}
+
+static void CreateAudioMixPool(SDL_AudioDevice *device)
+{
+    SDL_assert(!device->mix_pool);
+
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+    int threads = hint ? SDL_atoi(hint) : 0;
+    threads = SDL_min(threads, SDL_GetNumLogicalCPUCores());
+    threads = SDL_min(threads, SDL_MAX_AUDIO_MIX_WORKERS);
+    if (threads > 1) {
+        char threadname[64];
+        SDL_GetAudioThreadName(device, threadname, sizeof (threadname));
+        SDL_strlcat(threadname, "Mix", sizeof (threadname));
+        device->mix_pool = SDL_CreateWorkerPool(threadname, threads - 1, SDL_THREAD_PRIORITY_TIME_CRITICAL);  // the device thread is a worker, too.
+        // if this failed, we just mix serially.
+    }
+}
+
+static void DestroyAudioMixPool(SDL_AudioDevice *device)
+{
+    SDL_DestroyWorkerPool(device->mix_pool);
+    device->mix_pool = NULL;
+    SDL_aligned_free(device->mix_pool_buffers);
+    device->mix_pool_buffers = NULL;
+    device->mix_pool_buffer_size = 0;
+    SDL_free(device->mix_pool_streams);
+    device->mix_pool_streams = NULL;
+    device->mix_pool_streams_allocated = 0;
+}
+
 
 // Playback device thread. This is split into chunks, so backends that need to control this directly can use the pieces they need without duplicating effort.
 
@@ -1235,7 +1393,8 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                     SDL_memset(mix_buffer, '\0', work_buffer_size);  // start with silence.
                 }
 
-                for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                const bool mixed_in_parallel = ParallelMixLogicalDevice(device, logdev, mix_buffer, work_buffer_size, &failed);
+                for (SDL_AudioStream *stream = mixed_in_parallel ? NULL : logdev->bound_streams; stream; stream = stream->next_binding) {
                     // We should have updated this elsewhere if the format changed!
                     SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, &outspec, NULL, NULL));
 
@@ -1244,28 +1403,29 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                     /* this will hold a lock on `stream` while getting. We don't explicitly lock the streams
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
-                       the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamDataAdjustGain(stream, device->work_buffer, work_buffer_size, logdev->gain);
+                       the same stream to different devices at the same time, though.)
+                       The stream's output is converted a piece at a time and added (with gain) straight into the mix;
+                       it's okay if we get less than requested, we mix what we have. */
+                    const int br = SDL_MixAudioStreamData(stream, mix_buffer, work_buffer_size, logdev->gain, GetMixChannelMap(device, stream));
                     if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                         failed = true;
                         break;
-                    } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
-                        // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
-                        if (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
-                            ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device->work_buffer, device->spec.format, device->spec.channels, NULL,
-                                         device->work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
-                        }
-                        MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
                     }
                 }
 
                 if (postmix) {
                     SDL_assert(mix_buffer == device->postmix_buffer);
+                    ClampFloat32Audio(mix_buffer, needed_samples);  // postmix callbacks are promised samples from -1.0f to 1.0f
                     postmix(logdev->postmix_userdata, &outspec, mix_buffer, work_buffer_size);
-                    MixFloat32Audio(final_mix_buffer, mix_buffer, work_buffer_size);
+                    MixFloat32Audio(final_mix_buffer, mix_buffer, needed_samples, 1.0f);
                 }
             }
 
+            // Streams are summed unclamped, so clamp the final mix once here. Converting to an integer format clamps anyhow.
+            if (SDL_AUDIO_ISFLOAT(device->spec.format)) {
+                ClampFloat32Audio(final_mix_buffer, needed_samples);
+            }
+
             if (((Uint8 *) final_mix_buffer) != device_buffer) {
                 // !!! FIXME: we can't promise the device buf is aligned/padded for SIMD.
                 //ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, NULL, device_buffer, device->spec.format, device->spec.channels, NULL, NULL, 1.0f);
@@ -1678,6 +1838,8 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
     SDL_aligned_free(device->postmix_buffer);
     device->postmix_buffer = NULL;
 
+    DestroyAudioMixPool(device);
+
     SDL_copyp(&device->spec, &device->default_spec);
     device->sample_frames = 0;
     device->silence_value = SDL_GetSilenceValueForFormat(device->spec.format);
@@ -1833,6 +1995,10 @@ static bool OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
         }
     }
 
+    if (!device->recording) {
+        CreateAudioMixPool(device);
+    }
+
     // Start the audio thread if necessary
     if (!current_audio.impl.ProvidesOwnCallbackThread) {
         char threadname[64];
@@ -413,6 +413,19 @@ static Sint64 GetAudioStreamResampleRate(SDL_AudioStream *stream, int src_freq,
     return resample_rate;
 }
 
+// Only called with stream->lock held, so the quality can't change halfway through working out how much data is available.
+static void UpdateAudioStreamResampleQuality(SDL_AudioStream *stream)
+{
+    Sint64 quality = SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM;
+
+    if (stream->props) {
+        quality = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, quality);
+        quality = SDL_clamp(quality, SDL_AUDIO_RESAMPLE_QUALITY_LOW, SDL_AUDIO_RESAMPLE_QUALITY_HIGH);
+    }
+
+    stream->resample_quality = (SDL_AudioResampleQuality)quality;
+}
+
 static bool UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec, const int *chmap)
 {
     if (SDL_AudioSpecsEqual(&stream->input_spec, spec, stream->input_chmap, chmap)) {
@@ -448,6 +461,7 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
 
     result->freq_ratio = 1.0f;
     result->gain = 1.0f;
+    result->resample_quality = SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM;
     result->queue = SDL_CreateAudioQueue(8192);
 
     if (!result->queue) {
@@ -782,6 +796,30 @@ bool SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain)
     return true;
 }
 
+bool SDL_SetAudioStreamSingleProducer(SDL_AudioStream *stream, int buffer_size)
+{
+    CHECK_PARAM(!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    CHECK_PARAM(buffer_size <= 0) {
+        return SDL_InvalidParamError("buffer_size");
+    }
+
+    SDL_LockMutex(stream->lock);
+
+    bool retval;
+    if (stream->single_producer) {
+        retval = SDL_SetError("Audio stream already has a single producer");
+    } else {
+        retval = SDL_CreateAudioQueueRing(stream->queue, (size_t)buffer_size);
+        stream->single_producer = retval;
+    }
+
+    SDL_UnlockMutex(stream->lock);
+
+    return retval;
+}
+
 static bool CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
 {
     if (stream->src_spec.format == SDL_AUDIO_UNKNOWN) {
@@ -825,12 +863,39 @@ static bool PutAudioStreamBufferInternal(SDL_AudioStream *stream, const SDL_Audi
     return retval;
 }
 
+// Only the producer thread calls this, and it's the only one that changes the input format, so it doesn't need `stream->lock`.
+static bool PutAudioStreamRing(SDL_AudioStream *stream, const SDL_AudioSpec *spec, const int *chmap, const void *buf, int len, SDL_ReleaseAudioBufferCallback callback, void *userdata)
+{
+    if (spec->format == SDL_AUDIO_UNKNOWN) {
+        return SDL_SetError("Stream has no source format");
+    }
+
+    if ((len % SDL_AUDIO_FRAMESIZE(*spec)) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    if (!SDL_WriteToAudioQueueRing(stream->queue, spec, chmap, (const Uint8 *)buf, len, false)) {
+        return false;
+    }
+
+    // The data was copied, so the buffer can be released straight away.
+    if (callback) {
+        callback(userdata, buf, len);
+    }
+
+    return true;
+}
+
 static bool PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, SDL_ReleaseAudioBufferCallback callback, void *userdata)
 {
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: wants to put %d bytes", len);
 #endif
 
+    if (stream->single_producer) {
+        return PutAudioStreamRing(stream, &stream->src_spec, stream->src_chmap, buf, len, callback, userdata);
+    }
+
     SDL_LockMutex(stream->lock);
 
     if (!CheckAudioStreamIsFullySetup(stream)) {
@@ -875,7 +940,8 @@ bool SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 64 * 1024;
 
-    if (len >= large_input_thresh) {
+    // This doesn't apply to a single producer, which never holds the lock.
+    if (len >= large_input_thresh && !stream->single_producer) {
         void *data = SDL_malloc(len);
 
         if (!data) {
@@ -995,20 +1061,28 @@ bool SDL_PutAudioStreamPlanarData(SDL_AudioStream *stream, const void * const *c
 
     // we do the interleaving up front without the lock held, so the audio device doesn't starve while we work.
     //  but we _do_ need to know the current input spec.
+    //  (a single producer is the only thread that changes the input spec, so it doesn't need the lock for this.)
     SDL_AudioSpec spec;
     int chmap_copy[SDL_MAX_CHANNELMAP_CHANNELS];
     int *chmap = NULL;
-    SDL_LockMutex(stream->lock);
-    if (!CheckAudioStreamIsFullySetup(stream)) {
-        SDL_UnlockMutex(stream->lock);
-        return false;
+    const bool single_producer = stream->single_producer;
+    if (!single_producer) {
+        SDL_LockMutex(stream->lock);
+        if (!CheckAudioStreamIsFullySetup(stream)) {
+            SDL_UnlockMutex(stream->lock);
+            return false;
+        }
+    } else if (stream->src_spec.format == SDL_AUDIO_UNKNOWN) {
+        return SDL_SetError("Stream has no source format");
     }
     SDL_copyp(&spec, &stream->src_spec);
     if (stream->src_chmap) {
         chmap = chmap_copy;
         SDL_memcpy(chmap, stream->src_chmap, sizeof (*chmap) * spec.channels);
     }
-    SDL_UnlockMutex(stream->lock);
+    if (!single_producer) {
+        SDL_UnlockMutex(stream->lock);
+    }
 
     if (spec.channels == 1) {  // nothing to interleave, just use the usual function.
         return SDL_PutAudioStreamData(stream, channel_buffers[0], SDL_AUDIO_FRAMESIZE(spec) * num_samples);
@@ -1039,6 +1113,14 @@ bool SDL_PutAudioStreamPlanarData(SDL_AudioStream *stream, const void * const *c
 
     InterleaveAudioChannels(data, channel_buffers, num_channels, num_samples, &spec);
 
+    if (single_producer) {
+        retval = PutAudioStreamRing(stream, &spec, chmap, data, len, NULL, NULL);
+        if (callback) {
+            SDL_free(data);
+        }
+        return retval;
+    }
+
     // it's okay if the stream format changed on another thread while we didn't hold the lock; PutAudioStreamBufferInternal will notice
     //  and set up a new track with the right format, and the next SDL_PutAudioStreamData will notice that stream->src_spec doesn't
     //  match the new track and set up a new one again. It's a bad idea to change the format on another thread while putting here,
@@ -1083,6 +1165,10 @@ bool SDL_FlushAudioStream(SDL_AudioStream *stream)
         return SDL_InvalidParamError("stream");
     }
 
+    if (stream->single_producer) {
+        return SDL_FlushAudioQueueRing(stream->queue);
+    }
+
     SDL_LockMutex(stream->lock);
     SDL_FlushAudioQueue(stream->queue);
     SDL_UnlockMutex(stream->lock);
@@ -1145,7 +1231,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream *stream, void **inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -1204,7 +1290,8 @@ static Sint64 GetAudioStreamHead(SDL_AudioStream *stream, SDL_AudioSpec *out_spe
 
 // You must hold stream->lock and validate your parameters before calling this!
 // Enough input data MUST be available!
-static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain)
+// If `mix` is true, the output must be float32, and it's added to `buf` (after swizzling through `device_chmap`, if not NULL) instead of replacing it.
+static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain, bool mix, const int *device_chmap)
 {
     const SDL_AudioSpec *src_spec = &stream->input_spec;
     const SDL_AudioSpec *dst_spec = &stream->dst_spec;
@@ -1225,10 +1312,31 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
 
     SDL_assert(output_frames > 0);
 
+    SDL_assert(!mix || (dst_format == SDL_AUDIO_F32));
+
     // Not resampling? It's an easy conversion (and maybe not even that!)
     if (resample_rate == 0) {
         Uint8 *work_buffer = NULL;
 
+        if (mix) {
+            // Gain is applied while mixing. If nothing needs converting or swizzling (by the track's or the stream's channel
+            //  maps), this mixes straight out of the queue. The device's channel map is applied here, so that needs a copy.
+            work_buffer = EnsureAudioStreamWorkBufferSize(stream, output_frames * max_frame_size);
+            if (!work_buffer) {
+                return false;
+            }
+
+            const float *mixed = (const float *) SDL_ReadFromAudioQueue(stream->queue, device_chmap ? work_buffer : NULL, dst_format, dst_channels, dst_map, 0, output_frames, 0, work_buffer, 1.0f);
+            if (!mixed) {
+                return SDL_SetError("Not enough data in queue");
+            }
+            if (device_chmap) {
+                SwizzleAudio(output_frames, work_buffer, work_buffer, dst_channels, device_chmap, dst_format);
+            }
+            MixFloat32Audio((float *) buf, mixed, output_frames * dst_channels, gain);
+            return true;
+        }
+
         // Ensure we have enough scratch space for any conversions
         if ((src_format != dst_format) || (src_channels != dst_channels) || (gain != 1.0f)) {
             work_buffer = EnsureAudioStreamWorkBufferSize(stream, output_frames * max_frame_size);
@@ -1252,7 +1360,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // In fact, input_frames can sometimes even be zero when upsampling.
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
 
-    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
 
     const SDL_AudioFormat resample_format = SDL_AUDIO_F32;
 
@@ -1281,7 +1389,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // Check if we can resample directly into the output buffer.
     // Note, this is just to avoid extra copies.
     // Some other formats may fit directly into the output buffer, but i'd rather process data in a SIMD-aligned buffer.
-    if ((dst_format != resample_format) || (dst_channels != resample_channels)) {
+    if (mix || (dst_format != resample_format) || (dst_channels != resample_channels)) {
         // Allocate space for converting the resampled output to the destination format
         int resample_convert_bytes = output_frames * max_frame_size;
         work_buffer_capacity = SDL_max(work_buffer_capacity, resample_convert_bytes);
@@ -1325,7 +1433,21 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     SDL_ResampleAudio(resample_channels,
                   (const float *)input_buffer, input_frames,
                   (float *)resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset, stream->resample_quality);
+
+    if (mix) {
+        // The input is used up, so the start of the work buffer is free to convert into.
+        const float *mixed = (const float *) resample_buffer;
+        if ((dst_channels != resample_channels) || dst_map) {
+            ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, work_buffer, dst_format, dst_channels, dst_map, work_buffer, 1.0f);
+            mixed = (const float *) work_buffer;
+        }
+        if (device_chmap) {
+            SwizzleAudio(output_frames, (void *) mixed, mixed, dst_channels, device_chmap, dst_format);
+        }
+        MixFloat32Audio((float *) buf, mixed, output_frames * dst_channels, postresample_gain);
+        return true;
+    }
 
     // Convert to the final format, if necessary (src channel map is NULL because SDL_ReadFromAudioQueue already handled this).
     ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, buf, dst_format, dst_channels, dst_map, work_buffer, postresample_gain);
@@ -1333,8 +1455,8 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     return true;
 }
 
-// get converted/resampled data from the stream
-int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain)
+// get converted/resampled data from the stream, or mix it into the buffer.
+static int GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, bool mix, const int *device_chmap)
 {
     Uint8 *buf = (Uint8 *) voidbuf;
 
@@ -1366,6 +1488,15 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         return -1;
     }
 
+    if (mix && (stream->dst_spec.format != SDL_AUDIO_F32)) {
+        SDL_UnlockMutex(stream->lock);
+        SDL_SetError("Can only mix float32 audio streams");
+        return -1;
+    }
+
+    UpdateAudioStreamResampleQuality(stream);
+    SDL_DrainAudioQueueRing(stream->queue);
+
     const float gain = stream->gain * extra_gain;
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
@@ -1391,6 +1522,9 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         total_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         additional_request *= SDL_AUDIO_FRAMESIZE(stream->src_spec);  // convert sample frames to bytes.
         stream->get_callback(stream->get_callback_userdata, stream, (int) SDL_min(additional_request, SDL_INT_MAX), (int) SDL_min(total_request, SDL_INT_MAX));
+
+        // The callback might have put data through the ring.
+        SDL_DrainAudioQueueRing(stream->queue);
     }
 
     // Process the data in chunks to avoid allocating too much memory (and potential integer overflows)
@@ -1428,7 +1562,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         output_frames = SDL_min(output_frames, chunk_size);
         output_frames = (int) SDL_min(output_frames, available_frames);
 
-        if (!GetAudioStreamDataInternal(stream, &buf[total], output_frames, gain)) {
+        if (!GetAudioStreamDataInternal(stream, &buf[total], output_frames, gain, mix, device_chmap)) {
             total = total ? total : -1;
             break;
         }
@@ -1445,6 +1579,16 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
     return total;
 }
 
+int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain)
+{
+    return GetAudioStreamData(stream, voidbuf, len, extra_gain, false, NULL);
+}
+
+int SDL_MixAudioStreamData(SDL_AudioStream *stream, float *mix_buffer, int len, float extra_gain, const int *device_chmap)
+{
+    return GetAudioStreamData(stream, mix_buffer, len, extra_gain, true, device_chmap);
+}
+
 int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
 {
     return SDL_GetAudioStreamDataAdjustGain(stream, voidbuf, len, 1.0f);
@@ -1465,6 +1609,9 @@ int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
         return 0;
     }
 
+    UpdateAudioStreamResampleQuality(stream);
+    SDL_DrainAudioQueueRing(stream->queue);
+
     Sint64 count = GetAudioStreamAvailableFrames(stream, NULL);
 
     // convert from sample frames to bytes in destination format.
@@ -1486,6 +1633,7 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    SDL_DrainAudioQueueRing(stream->queue);
     size_t total = SDL_GetAudioQueueQueued(stream->queue);
 
     SDL_UnlockMutex(stream->lock);
@@ -1502,6 +1650,8 @@ bool SDL_ClearAudioStream(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    // Clear out anything the producer has written so far, too, so its chunks can be reused.
+    SDL_DrainAudioQueueRing(stream->queue);
     SDL_ClearAudioQueue(stream->queue);
     SDL_zero(stream->input_spec);
     stream->input_chmap = NULL;
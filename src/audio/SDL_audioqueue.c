@@ -51,6 +51,41 @@ struct SDL_AudioTrack
     int chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];  // !!! FIXME: this needs to grow if SDL ever supports more channels. But if it grows, we should probably be more clever about allocations.
 };
 
+// A piece of data written by the producer, waiting to be added to the queue by the consumer.
+// The spec travels with the data, so format changes happen at the right point in the queue.
+typedef struct SDL_AudioRingSlot
+{
+    SDL_AudioSpec spec;
+    int *chmap;
+    bool flushed;
+    Uint8 *data;
+    size_t len;
+    Uint32 end;  // The ring's `written` count after this data, so its space can be reused once it's released.
+
+    int chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];
+} SDL_AudioRingSlot;
+
+// Single-producer, single-consumer ring, for adding data to a queue without a lock.
+// Data is copied into one contiguous buffer, and each piece of it is described by a slot.
+// Both sizes are powers of two, so the counters can wrap around.
+// Each counter only ever increases, and is only written by one side:
+// - `write` (slots) and `written` (bytes): by the producer, once a slot is filled in.
+// - `read`: by the consumer, once a slot has been added to the queue as a track.
+// - `released` and `released_bytes`: by the consumer, once that track has been read and destroyed.
+typedef struct SDL_AudioRing
+{
+    SDL_AudioRingSlot *slots;
+    Uint32 num_slots;
+    Uint8 *buffer;
+    Uint32 buffer_size;
+
+    SDL_AtomicU32 write;
+    Uint32 written;
+    Uint32 read;
+    SDL_AtomicU32 released;
+    SDL_AtomicU32 released_bytes;
+} SDL_AudioRing;
+
 struct SDL_AudioQueue
 {
     SDL_AudioTrack *head;
@@ -62,6 +97,8 @@ struct SDL_AudioQueue
 
     SDL_MemoryPool track_pool;
     SDL_MemoryPool chunk_pool;
+
+    SDL_AudioRing *ring;
 };
 
 // Allocate a new block, avoiding checking for ones already in the pool
@@ -138,9 +175,12 @@ static bool ReserveMemoryPoolBlocks(SDL_MemoryPool *pool, size_t num_blocks)
     return true;
 }
 
+static void DestroyAudioRing(SDL_AudioQueue *queue);
+
 void SDL_DestroyAudioQueue(SDL_AudioQueue *queue)
 {
     SDL_ClearAudioQueue(queue);
+    DestroyAudioRing(queue);
 
     DestroyMemoryPool(&queue->track_pool);
     DestroyMemoryPool(&queue->chunk_pool);
@@ -365,6 +405,200 @@ bool SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, con
     return true;
 }
 
+static void DestroyAudioRing(SDL_AudioQueue *queue)
+{
+    SDL_AudioRing *ring = queue->ring;
+
+    if (ring) {
+        SDL_free(ring->buffer);
+        SDL_free(ring->slots);
+        SDL_free(ring);
+        queue->ring = NULL;
+    }
+}
+
+bool SDL_CreateAudioQueueRing(SDL_AudioQueue *queue, size_t buffer_size)
+{
+    SDL_assert(!queue->ring);
+
+    if (buffer_size > (1u << 30)) {
+        return SDL_InvalidParamError("buffer_size");
+    }
+
+    // Round up to a power of two, and have a slot for every couple of hundred bytes.
+    Uint32 size = 4096;
+    while (size < buffer_size) {
+        size *= 2;
+    }
+
+    SDL_AudioRing *ring = (SDL_AudioRing *)SDL_calloc(1, sizeof(*ring));
+    if (!ring) {
+        return false;
+    }
+
+    queue->ring = ring;
+    ring->buffer_size = size;
+    ring->num_slots = size / 256;
+    ring->buffer = (Uint8 *)SDL_malloc(ring->buffer_size);
+    ring->slots = (SDL_AudioRingSlot *)SDL_calloc(ring->num_slots, sizeof(*ring->slots));
+
+    if (!ring->buffer || !ring->slots) {
+        DestroyAudioRing(queue);
+        return false;
+    }
+
+    // The consumer makes a track for each slot, so keep enough of those around that it never allocates.
+    queue->track_pool.max_free += ring->num_slots;
+
+    if (!ReserveMemoryPoolBlocks(&queue->track_pool, ring->num_slots)) {
+        queue->track_pool.max_free -= ring->num_slots;
+        DestroyAudioRing(queue);
+        return false;
+    }
+
+    return true;
+}
+
+bool SDL_WriteToAudioQueueRing(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const int *chmap, const Uint8 *data, size_t len, bool flush)
+{
+    SDL_AudioRing *ring = queue->ring;
+    const Uint32 frame_size = SDL_AUDIO_FRAMESIZE(*spec);
+
+    // Data that wraps around the end of the buffer is split in two, wasting less than a frame.
+    if (len > ring->buffer_size - frame_size) {
+        return SDL_SetError("Too much data for the audio stream's buffer");
+    }
+
+    const Uint32 write = SDL_GetAtomicU32(&ring->write);
+    const Uint32 free_slots = ring->num_slots - (write - SDL_GetAtomicU32(&ring->released));
+    const Uint32 free_bytes = ring->buffer_size - (ring->written - SDL_GetAtomicU32(&ring->released_bytes));
+
+    // All or nothing, so the data never gets split up by a failed write.
+    if (free_slots < 2 || (len && (len + frame_size > free_bytes))) {
+        return SDL_SetError("Audio stream is full");
+    }
+
+    Uint32 num_written = 0;
+
+    for (;;) {
+        const Uint32 pos = ring->written & (ring->buffer_size - 1);
+        Uint32 space = ring->buffer_size - pos;
+        space -= space % frame_size;
+
+        if (space == 0 && len) {
+            // Not even a frame left before the end of the buffer, so start again from the beginning.
+            ring->written += ring->buffer_size - pos;
+            continue;
+        }
+
+        SDL_AudioRingSlot *slot = &ring->slots[(write + num_written) & (ring->num_slots - 1)];
+        const size_t amount = SDL_min(len, space);
+
+        SDL_copyp(&slot->spec, spec);
+        slot->chmap = NULL;
+        if (chmap) {
+            SDL_memcpy(slot->chmap_storage, chmap, sizeof(*chmap) * spec->channels);
+            slot->chmap = slot->chmap_storage;
+        }
+
+        slot->data = &ring->buffer[pos];
+        slot->len = amount;
+        if (amount) {
+            SDL_memcpy(slot->data, data, amount);
+        }
+
+        ring->written += (Uint32)amount;
+        slot->end = ring->written;
+        data += amount;
+        len -= amount;
+        ++num_written;
+
+        if (len == 0) {
+            slot->flushed = flush;
+            break;
+        }
+
+        slot->flushed = false;
+    }
+
+    // Publish the slots to the consumer.
+    SDL_SetAtomicU32(&ring->write, write + num_written);
+
+    return true;
+}
+
+bool SDL_FlushAudioQueueRing(SDL_AudioQueue *queue)
+{
+    SDL_AudioRing *ring = queue->ring;
+    const Uint32 write = SDL_GetAtomicU32(&ring->write);
+
+    if (write == 0) {
+        return true;  // Nothing has been written, so there's nothing to flush.
+    }
+
+    // Only the producer writes to slots, so the last one is still intact, even if it's been released.
+    const SDL_AudioRingSlot *last = &ring->slots[(write - 1) & (ring->num_slots - 1)];
+    if (last->flushed) {
+        return true;
+    }
+
+    SDL_AudioSpec spec;
+    int chmap[SDL_MAX_CHANNELMAP_CHANNELS];
+    SDL_copyp(&spec, &last->spec);
+    if (last->chmap) {
+        SDL_memcpy(chmap, last->chmap_storage, sizeof(*chmap) * spec.channels);
+    }
+
+    return SDL_WriteToAudioQueueRing(queue, &spec, last->chmap ? chmap : NULL, NULL, 0, true);
+}
+
+static void SDLCALL ReleaseAudioRingSlot(void *userdata, const void *buf, int len)
+{
+    SDL_AudioRing *ring = (SDL_AudioRing *)userdata;
+    const Uint32 released = SDL_GetAtomicU32(&ring->released);
+    const SDL_AudioRingSlot *slot = &ring->slots[released & (ring->num_slots - 1)];
+
+    (void)buf;
+    (void)len;
+
+    // Tracks are always destroyed in the order they were queued.
+    SDL_assert(buf == slot->data);
+
+    // The producer can reuse the slot as soon as it sees it released, so finish with it first.
+    SDL_SetAtomicU32(&ring->released_bytes, slot->end);
+    SDL_SetAtomicU32(&ring->released, released + 1);
+}
+
+void SDL_DrainAudioQueueRing(SDL_AudioQueue *queue)
+{
+    SDL_AudioRing *ring = queue->ring;
+
+    if (!ring) {
+        return;
+    }
+
+    const Uint32 write = SDL_GetAtomicU32(&ring->write);
+
+    while (ring->read != write) {
+        SDL_AudioRingSlot *slot = &ring->slots[ring->read & (ring->num_slots - 1)];
+
+        // The track can't be written to, there's other data right after it.
+        SDL_AudioTrack *track = SDL_CreateAudioTrack(queue, &slot->spec, slot->chmap, slot->data, slot->len, slot->len, ReleaseAudioRingSlot, ring);
+
+        if (!track) {
+            break;  // Try again next time.
+        }
+
+        SDL_AddTrackToAudioQueue(queue, track);
+
+        if (slot->flushed) {
+            FlushAudioTrack(track);
+        }
+
+        ++ring->read;
+    }
+}
+
 void *SDL_BeginAudioQueueIter(SDL_AudioQueue *queue)
 {
     return queue->head;
@@ -548,7 +782,8 @@ const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
     size_t dst_present_bytes = present_frames * dst_frame_size;
     size_t dst_future_bytes = future_frames * dst_frame_size;
 
-    const bool convert = (src_format != dst_format) || (src_channels != dst_channels) || (gain != 1.0f);
+    // A channel map on either side means the data can't be handed back untouched, even if the formats match.
+    const bool convert = (src_format != dst_format) || (src_channels != dst_channels) || (gain != 1.0f) || src_map || dst_map;
 
     if (convert && !dst) {
         // The user didn't ask for the data to be copied, but we need to convert it, so store it in the scratch buffer
@@ -76,4 +76,19 @@ extern size_t SDL_GetAudioQueueQueued(SDL_AudioQueue *queue);
 
 extern bool SDL_ResetAudioQueueHistory(SDL_AudioQueue *queue, int num_frames);
 
+// Preallocate a ring buffer of at least `buffer_size` bytes, so one thread can add data without locking or allocating.
+// The ring is kept until the queue is destroyed.
+extern bool SDL_CreateAudioQueueRing(SDL_AudioQueue *queue, size_t buffer_size);
+
+// Copy data into the ring (producer side). Doesn't need to hold the lock used for everything else.
+// Fails without writing anything if there isn't room for all of it.
+// If `flush` is true, the data ends the track.
+extern bool SDL_WriteToAudioQueueRing(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const int *chmap, const Uint8 *data, size_t len, bool flush);
+
+// Mark the end of the data written to the ring so far (producer side).
+extern bool SDL_FlushAudioQueueRing(SDL_AudioQueue *queue);
+
+// Add everything written to the ring so far to the end of the queue (consumer side).
+extern void SDL_DrainAudioQueueRing(SDL_AudioQueue *queue);
+
 #endif // SDL_audioqueue_h_
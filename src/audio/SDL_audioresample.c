@@ -48,6 +48,24 @@
 #define RESAMPLER_FILTER_INTERP_BITS        (32 - RESAMPLER_BITS_PER_ZERO_CROSSING)
 #define RESAMPLER_FILTER_INTERP_RANGE       (1 << RESAMPLER_FILTER_INTERP_BITS)
 
+// SDL_AUDIO_RESAMPLE_QUALITY_LOW interpolates linearly between the two nearest frames.
+#define LINEAR_PADDING_FRAMES 1
+
+// SDL_AUDIO_RESAMPLE_QUALITY_HIGH uses a longer filter, which is stretched when downsampling so that
+// it also removes everything above the new Nyquist frequency (up to HIGH_MAX_DOWNSAMPLE, after that it aliases).
+// With 64 taps and a 110dB Kaiser window, the transition band is ~22% of the Nyquist frequency wide,
+// so the cutoff is placed such that the stopband starts at the Nyquist frequency.
+#define HIGH_ZERO_CROSSINGS 32
+#define HIGH_MAX_DOWNSAMPLE 3
+#define HIGH_STOPBAND_DB    110.0
+#define HIGH_CUTOFF         0.89
+#define HIGH_MAX_HALF_TAPS  (HIGH_ZERO_CROSSINGS * HIGH_MAX_DOWNSAMPLE)
+#define HIGH_MAX_TAPS       (HIGH_MAX_HALF_TAPS * 2)
+
+// The filter is tabulated over one wing, and linearly interpolated.
+// 512 points per zero crossing keeps the interpolation error below -100dB.
+#define HIGH_TABLE_SIZE (HIGH_ZERO_CROSSINGS * 512)
+
 // ResampleFrame is just a vector/matrix/matrix multiplication.
 // It performs cubic interpolation of the filter, then multiplies that with the input.
 // dst = [1, frac, frac^2, frac^3] * filter * src
@@ -414,12 +432,12 @@ static void CubicLeastSquares(Cubic *coeffs, float y0, float y1, float y2, float
 
 // Zeroth-order modified Bessel function of the first kind
 // https://mathworld.wolfram.com/ModifiedBesselFunctionoftheFirstKind.html
-static float BesselI0(float x)
+static double BesselI0(double x)
 {
-    float sum = 0.0f;
-    float i = 1.0f;
-    float t = 1.0f;
-    x *= x * 0.25f;
+    double sum = 0.0;
+    double i = 1.0;
+    double t = 1.0;
+    x *= x * 0.25;
 
     while (t >= sum * SDL_FLT_EPSILON) {
         sum += t;
@@ -465,7 +483,7 @@ static void GenerateResamplerFilter(void)
     // if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab.
     const float dB = 80.0f;
     const float beta = 0.1102f * (dB - 8.7f);
-    const float bessel_beta = BesselI0(beta);
+    const float bessel_beta = (float)BesselI0(beta);
     const float lensqr = TABLE_SIZE * TABLE_SIZE;
 
     int i, j;
@@ -480,7 +498,7 @@ static void GenerateResamplerFilter(void)
     filter[0] = 1.0f;
 
     for (i = 1; i <= TABLE_SIZE; ++i) {
-        float b = BesselI0(beta * SDL_sqrtf((lensqr - (i * i)) / lensqr)) / bessel_beta;
+        float b = (float)BesselI0(beta * SDL_sqrtf((lensqr - (i * i)) / lensqr)) / bessel_beta;
         float s = Sinc(sinc, i, TABLE_SAMPLES_PER_ZERO_CROSSING);
         filter[i] = b * s;
     }
@@ -513,6 +531,369 @@ static void GenerateResamplerFilter(void)
     }
 }
 
+// The other filters are applied with explicit taps: either precomputed for each phase of a rational
+// resampling ratio, or calculated for each output frame.
+// dst = taps * src, where src points at the frame for the first tap.
+typedef void (*ConvolveFrameFunc)(const float *src, float *dst, const float *taps, int num_taps, int chans);
+static ConvolveFrameFunc ConvolveFrame;
+
+static void ConvolveFrame_Scalar(const float *src, float *dst, const float *taps, int num_taps, int chans)
+{
+    int i, chan;
+
+    if (chans == 1) {
+        float out = 0.0f;
+
+        for (i = 0; i < num_taps; ++i) {
+            out += src[i] * taps[i];
+        }
+
+        dst[0] = out;
+        return;
+    }
+
+    if (chans == 2) {
+        float out0 = 0.0f;
+        float out1 = 0.0f;
+
+        for (i = 0; i < num_taps; ++i) {
+            out0 += src[i * 2 + 0] * taps[i];
+            out1 += src[i * 2 + 1] * taps[i];
+        }
+
+        dst[0] = out0;
+        dst[1] = out1;
+        return;
+    }
+
+    for (chan = 0; chan < chans; ++chan) {
+        float out = 0.0f;
+
+        for (i = 0; i < num_taps; ++i) {
+            out += src[i * chans + chan] * taps[i];
+        }
+
+        dst[chan] = out;
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+// REQUIRES: num_taps is a multiple of 4
+static void SDL_TARGETING("sse") ConvolveFrame_SSE(const float *src, float *dst, const float *taps, int num_taps, int chans)
+{
+    int i, chan;
+
+    if (chans == 1) {
+        __m128 out0 = _mm_setzero_ps();
+
+        for (i = 0; i < num_taps; i += 4) {
+            out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_loadu_ps(src + i), _mm_loadu_ps(taps + i)));
+        }
+
+        // Horizontal sum
+        __m128 shuf = _mm_shuffle_ps(out0, out0, _MM_SHUFFLE(2, 3, 0, 1));
+        out0 = _mm_add_ps(out0, shuf);
+        out0 = _mm_add_ss(out0, _mm_movehl_ps(shuf, out0));
+
+        _mm_store_ss(dst, out0);
+        return;
+    }
+
+    if (chans == 2) {
+        __m128 out0 = _mm_setzero_ps();
+        __m128 out1 = _mm_setzero_ps();
+
+        for (i = 0; i < num_taps; i += 4) {
+            // Duplicate each of the taps and multiply by the input
+            const __m128 t = _mm_loadu_ps(taps + i);
+            out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_loadu_ps(src + i * 2 + 0), _mm_unpacklo_ps(t, t)));
+            out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_loadu_ps(src + i * 2 + 4), _mm_unpackhi_ps(t, t)));
+        }
+
+        // Add the accumulators, then the lower and upper pairs together
+        __m128 out = _mm_add_ps(out0, out1);
+        out = _mm_add_ps(out, _mm_movehl_ps(out, out));
+
+        _mm_storel_pi((__m64 *)dst, out);
+        return;
+    }
+
+    // Process 4 channels at once
+    for (chan = 0; chan + 4 <= chans; chan += 4) {
+        const float *in = &src[chan];
+        __m128 out = _mm_setzero_ps();
+
+        for (i = 0; i < num_taps; ++i, in += chans) {
+            out = _mm_add_ps(out, _mm_mul_ps(_mm_loadu_ps(in), _mm_set1_ps(taps[i])));
+        }
+
+        _mm_storeu_ps(&dst[chan], out);
+    }
+
+    // Process the remaining channels one at a time
+    for (; chan < chans; ++chan) {
+        float out = 0.0f;
+
+        for (i = 0; i < num_taps; ++i) {
+            out += src[i * chans + chan] * taps[i];
+        }
+
+        dst[chan] = out;
+    }
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+// REQUIRES: num_taps is a multiple of 4
+static void ConvolveFrame_NEON(const float *src, float *dst, const float *taps, int num_taps, int chans)
+{
+    int i, chan;
+
+    if (chans == 1) {
+        float32x4_t out0 = vdupq_n_f32(0);
+
+        for (i = 0; i < num_taps; i += 4) {
+            out0 = vmlaq_f32(out0, vld1q_f32(src + i), vld1q_f32(taps + i));
+        }
+
+        // Horizontal sum
+        float32x2_t sum = vadd_f32(vget_low_f32(out0), vget_high_f32(out0));
+        sum = vpadd_f32(sum, sum);
+
+        vst1_lane_f32(dst, sum, 0);
+        return;
+    }
+
+    if (chans == 2) {
+        float32x4_t out0 = vdupq_n_f32(0);
+        float32x4_t out1 = vdupq_n_f32(0);
+
+        for (i = 0; i < num_taps; i += 4) {
+            // Duplicate each of the taps and multiply by the input
+            const float32x4_t t = vld1q_f32(taps + i);
+            const float32x4x2_t g = vzipq_f32(t, t);
+            out0 = vmlaq_f32(out0, vld1q_f32(src + i * 2 + 0), g.val[0]);
+            out1 = vmlaq_f32(out1, vld1q_f32(src + i * 2 + 4), g.val[1]);
+        }
+
+        // Add the accumulators, then the lower and upper pairs together
+        out0 = vaddq_f32(out0, out1);
+        float32x2_t out = vadd_f32(vget_low_f32(out0), vget_high_f32(out0));
+
+        vst1_f32(dst, out);
+        return;
+    }
+
+    // Process 4 channels at once
+    for (chan = 0; chan + 4 <= chans; chan += 4) {
+        const float *in = &src[chan];
+        float32x4_t out = vdupq_n_f32(0);
+
+        for (i = 0; i < num_taps; ++i, in += chans) {
+            out = vmlaq_n_f32(out, vld1q_f32(in), taps[i]);
+        }
+
+        vst1q_f32(&dst[chan], out);
+    }
+
+    // Process the remaining channels one at a time
+    for (; chan < chans; ++chan) {
+        float out = 0.0f;
+
+        for (i = 0; i < num_taps; ++i) {
+            out += src[i * chans + chan] * taps[i];
+        }
+
+        dst[chan] = out;
+    }
+}
+#endif
+
+// Kaiser-windowed sinc, with the given cutoff (as a fraction of the input Nyquist frequency),
+// which is zero at and beyond `half_width` input frames from the center.
+static double WindowedSinc(double x, double cutoff, double half_width, double beta, double bessel_beta)
+{
+    const double r = x / half_width;
+
+    if (r <= -1.0 || r >= 1.0) {
+        return 0.0;
+    }
+
+    double s = cutoff;
+    if (x != 0.0) {
+        s = SDL_sin(SDL_PI_D * cutoff * x) / (SDL_PI_D * x);
+    }
+
+    return s * BesselI0(beta * SDL_sqrt(1.0 - (r * r))) / bessel_beta;
+}
+
+// One wing of the high quality filter, over [0, 1] of its half width.
+// Stretching it by the downsampling ratio gives the filter for that ratio.
+static float HighFilter[HIGH_TABLE_SIZE + 1];
+
+static double GetHighBeta(void)
+{
+    return 0.1102 * (HIGH_STOPBAND_DB - 8.7);
+}
+
+static void GenerateHighFilter(void)
+{
+    const double beta = GetHighBeta();
+    const double bessel_beta = BesselI0(beta);
+    int i;
+
+    for (i = 0; i <= HIGH_TABLE_SIZE; ++i) {
+        const double x = (double)i * HIGH_ZERO_CROSSINGS / HIGH_TABLE_SIZE;
+        HighFilter[i] = (float)WindowedSinc(x, HIGH_CUTOFF, HIGH_ZERO_CROSSINGS, beta, bessel_beta);
+    }
+}
+
+// Number of input frames on each side of the current position used by the high quality filter.
+// This is kept even, so that the total number of taps is a multiple of 4.
+static int GetHighHalfTaps(Sint64 resample_rate)
+{
+    int half = HIGH_ZERO_CROSSINGS;
+
+    if (resample_rate > 0x100000000) {
+        // ceil(HIGH_ZERO_CROSSINGS * src_rate / dst_rate)
+        const Sint64 stretched = ((HIGH_ZERO_CROSSINGS * resample_rate) + 0xFFFFFFFF) >> 32;
+        half = (int)SDL_min(stretched, HIGH_MAX_HALF_TAPS);
+    }
+
+    return (half + 1) & ~1;
+}
+
+// How much the high quality filter is stretched by. This is the downsampling ratio, up to HIGH_MAX_DOWNSAMPLE.
+static float GetHighStretch(Sint64 resample_rate)
+{
+    const float ratio = (float)resample_rate * (1.0f / 4294967296.0f);
+    return SDL_clamp(ratio, 1.0f, (float)HIGH_MAX_DOWNSAMPLE);
+}
+
+// Fill in the high quality filter taps for a position `frac` frames past the frame at `half_taps - 1`
+static void CalculateHighTaps(float *taps, int half_taps, float stretch, float frac)
+{
+    const float scale = (float)HIGH_TABLE_SIZE / (HIGH_ZERO_CROSSINGS * stretch);
+    // Stretching the filter also scales its DC gain, by the same amount
+    const float gain = 1.0f / stretch;
+    const int num_taps = half_taps * 2;
+    int i;
+
+    for (i = 0; i < num_taps; ++i) {
+        const float pos = SDL_fabsf((float)(i - (half_taps - 1)) - frac) * scale;
+        const int index = (int)pos;
+        float tap = 0.0f;
+
+        if (index < HIGH_TABLE_SIZE) {
+            const float t = pos - (float)index;
+            tap = (HighFilter[index] + (HighFilter[index + 1] - HighFilter[index]) * t) * gain;
+        }
+
+        taps[i] = tap;
+    }
+}
+
+// Common sample rate conversions get their own polyphase filters. The ratio is `dst:src = phases:step`,
+// so every output frame lands exactly on one of `phases` positions between two input frames, and the
+// taps for each position are calculated once, instead of interpolated for every output frame.
+typedef struct PolyphaseFilter
+{
+    int phases;
+    int step;
+    Sint64 resample_rate;   // SDL_GetResampleRate() for this ratio, to find the filter by
+    int half_taps[2];       // for SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM and SDL_AUDIO_RESAMPLE_QUALITY_HIGH
+    float *taps[2];         // phases * half_taps * 2 taps
+} PolyphaseFilter;
+
+static PolyphaseFilter PolyphaseFilters[] = {
+    { 160, 147 }, // 44100 -> 48000
+    { 147, 160 }, // 48000 -> 44100
+    { 3, 1 },     // 16000 -> 48000
+    { 1, 3 },     // 48000 -> 16000
+    { 6, 1 },     // 8000 -> 48000
+    { 1, 6 },     // 48000 -> 8000
+    { 2, 1 },     // 22050 -> 44100, 24000 -> 48000
+    { 1, 2 },     // 44100 -> 22050, 48000 -> 24000
+    { 3, 2 },     // 32000 -> 48000
+    { 2, 3 }      // 48000 -> 32000
+};
+
+// Large enough for all of the above
+#define POLYPHASE_TAPS_SIZE 27000
+static float PolyphaseTaps[POLYPHASE_TAPS_SIZE];
+
+static void GeneratePolyphaseFilters(void)
+{
+    const double medium_beta = 0.1102 * (80.0 - 8.7);  // Same as GenerateResamplerFilter
+    const double medium_bessel_beta = BesselI0(medium_beta);
+    const double high_beta = GetHighBeta();
+    const double high_bessel_beta = BesselI0(high_beta);
+    float *next = PolyphaseTaps;
+    int i, quality, phase, tap;
+
+    for (i = 0; i < (int)SDL_arraysize(PolyphaseFilters); ++i) {
+        PolyphaseFilter *filter = &PolyphaseFilters[i];
+        filter->resample_rate = SDL_GetResampleRate(filter->step, filter->phases);
+        filter->half_taps[0] = RESAMPLER_ZERO_CROSSINGS;
+        filter->half_taps[1] = GetHighHalfTaps(filter->resample_rate);
+
+        for (quality = 0; quality < 2; ++quality) {
+            const int half_taps = filter->half_taps[quality];
+            const int num_taps = half_taps * 2;
+
+            if ((next + (filter->phases * num_taps)) > (PolyphaseTaps + POLYPHASE_TAPS_SIZE)) {
+                SDL_assert(!"POLYPHASE_TAPS_SIZE is too small");
+                filter->taps[quality] = NULL;  // Use the generic resampler instead
+                continue;
+            }
+
+            filter->taps[quality] = next;
+
+            for (phase = 0; phase < filter->phases; ++phase) {
+                const double frac = (double)phase / filter->phases;
+                double sum = 0.0;
+
+                for (tap = 0; tap < num_taps; ++tap) {
+                    const double x = (double)(tap - (half_taps - 1)) - frac;
+                    double value;
+
+                    if (quality == 0) {
+                        // The same response as the interpolated filter
+                        value = WindowedSinc(x, 1.0, RESAMPLER_ZERO_CROSSINGS, medium_beta, medium_bessel_beta);
+                    } else {
+                        const double stretch = SDL_clamp((double)filter->step / filter->phases, 1.0, (double)HIGH_MAX_DOWNSAMPLE);
+                        value = WindowedSinc(x, HIGH_CUTOFF / stretch, HIGH_ZERO_CROSSINGS * stretch, high_beta, high_bessel_beta);
+                        sum += value;
+                    }
+
+                    next[tap] = (float)value;
+                }
+
+                if (quality == 1) {
+                    for (tap = 0; tap < num_taps; ++tap) {
+                        next[tap] = (float)(next[tap] / sum);
+                    }
+                }
+
+                next += num_taps;
+            }
+        }
+    }
+}
+
+static const PolyphaseFilter *FindPolyphaseFilter(Sint64 resample_rate)
+{
+    int i;
+
+    for (i = 0; i < (int)SDL_arraysize(PolyphaseFilters); ++i) {
+        if (PolyphaseFilters[i].resample_rate == resample_rate) {
+            return &PolyphaseFilters[i];
+        }
+    }
+
+    return NULL;
+}
+
 typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans);
 static ResampleFrameFunc ResampleFrame[8];
 
@@ -536,12 +917,15 @@ static void SetupAudioResampler(void)
     bool transpose = false;
 
     GenerateResamplerFilter();
+    GenerateHighFilter();
+    GeneratePolyphaseFilters();
 
 #ifdef SDL_SSE_INTRINSICS
     if (SDL_HasSSE()) {
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_SSE;
         }
+        ConvolveFrame = ConvolveFrame_SSE;
         transpose = true;
     } else
 #endif
@@ -550,6 +934,7 @@ static void SetupAudioResampler(void)
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_NEON;
         }
+        ConvolveFrame = ConvolveFrame_NEON;
         transpose = true;
     } else
 #endif
@@ -557,6 +942,7 @@ static void SetupAudioResampler(void)
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic;
         }
+        ConvolveFrame = ConvolveFrame_Scalar;
 
         ResampleFrame[0] = ResampleFrame_Mono;
         ResampleFrame[1] = ResampleFrame_Stereo;
@@ -607,15 +993,27 @@ Sint64 SDL_GetResampleRate(int src_rate, int dst_rate)
 int SDL_GetResamplerHistoryFrames(void)
 {
     // Even if we aren't currently resampling, make sure to keep enough history in case we need to later.
+    // This also covers the quality being raised later.
 
-    return RESAMPLER_MAX_PADDING_FRAMES;
+    return HIGH_MAX_HALF_TAPS + 1;
 }
 
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate)
+int SDL_GetResamplerPaddingFrames(Sint64 resample_rate, SDL_AudioResampleQuality quality)
 {
     // This must always be <= SDL_GetResamplerHistoryFrames()
 
-    return resample_rate ? RESAMPLER_MAX_PADDING_FRAMES : 0;
+    if (!resample_rate) {
+        return 0;
+    }
+
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_QUALITY_LOW:
+        return LINEAR_PADDING_FRAMES;
+    case SDL_AUDIO_RESAMPLE_QUALITY_HIGH:
+        return GetHighHalfTaps(resample_rate) + 1;
+    default:
+        return RESAMPLER_MAX_PADDING_FRAMES;
+    }
 }
 
 // These are not general purpose. They do not check for all possible underflow/overflow
@@ -675,8 +1073,104 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
     return output_frames;
 }
 
+static void ResampleAudio_Linear(int chans, const float *src, int inframes, float *dst, int outframes,
+                                 Sint64 resample_rate, Sint64 *inout_resample_offset)
+{
+    int i, chan;
+    Sint64 srcpos = *inout_resample_offset;
+
+    for (i = 0; i < outframes; ++i) {
+        int srcindex = (int)(Sint32)(srcpos >> 32);
+        Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float frac = (float)(srcfraction >> 8) * (1.0f / 16777216.0f);
+        const float *frame = &src[srcindex * chans];
+
+        for (chan = 0; chan < chans; ++chan) {
+            const float a = frame[chan];
+            const float b = frame[chans + chan];
+            dst[chan] = a + ((b - a) * frac);
+        }
+
+        dst += chans;
+    }
+
+    *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
+}
+
+static void ResampleAudio_Polyphase(int chans, const float *src, int inframes, float *dst, int outframes,
+                                    const PolyphaseFilter *filter, int quality_index, Sint64 *inout_resample_offset)
+{
+    const int phases = filter->phases;
+    const int half_taps = filter->half_taps[quality_index];
+    const int num_taps = half_taps * 2;
+    const float *taps = filter->taps[quality_index];
+    const int step_frames = filter->step / phases;
+    const int step_phases = filter->step % phases;
+
+    // The 32:32 position is rounded up to the next representable value when it's stored (see below),
+    // so rounding it down here gets back the exact phase. From here on, the position is tracked exactly.
+    Sint64 srcpos = *inout_resample_offset;
+    int srcindex = (int)(Sint32)(srcpos >> 32);
+    int phase = (int)(((Uint64)(srcpos & 0xFFFFFFFF) * phases) >> 32);
+    int i;
+
+    src -= (half_taps - 1) * chans;
+
+    for (i = 0; i < outframes; ++i) {
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        ConvolveFrame(&src[srcindex * chans], dst, &taps[phase * num_taps], num_taps, chans);
+
+        srcindex += step_frames;
+        phase += step_phases;
+        if (phase >= phases) {
+            phase -= phases;
+            ++srcindex;
+        }
+
+        dst += chans;
+    }
+
+    // This is slightly behind where the 32:32 resample rate would have got to, which is fine,
+    // since it was rounded up, and the input frames were calculated with it.
+    const Sint64 fraction = (((Sint64)phase << 32) + phases - 1) / phases;
+    *inout_resample_offset = ((Sint64)(srcindex - inframes) * 0x100000000) + fraction;
+}
+
+static void ResampleAudio_High(int chans, const float *src, int inframes, float *dst, int outframes,
+                               Sint64 resample_rate, Sint64 *inout_resample_offset)
+{
+    const int half_taps = GetHighHalfTaps(resample_rate);
+    const float stretch = GetHighStretch(resample_rate);
+    float taps[HIGH_MAX_TAPS];
+    Sint64 srcpos = *inout_resample_offset;
+    int i;
+
+    src -= (half_taps - 1) * chans;
+
+    for (i = 0; i < outframes; ++i) {
+        int srcindex = (int)(Sint32)(srcpos >> 32);
+        Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float frac = (float)(srcfraction >> 8) * (1.0f / 16777216.0f);
+        CalculateHighTaps(taps, half_taps, stretch, frac);
+        ConvolveFrame(&src[srcindex * chans], dst, taps, half_taps * 2, chans);
+
+        dst += chans;
+    }
+
+    *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
+}
+
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, SDL_AudioResampleQuality quality)
 {
     int i;
     Sint64 srcpos = *inout_resample_offset;
@@ -684,6 +1178,23 @@ void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, in
 
     SDL_assert(resample_rate > 0);
 
+    if (quality == SDL_AUDIO_RESAMPLE_QUALITY_LOW) {
+        ResampleAudio_Linear(chans, src, inframes, dst, outframes, resample_rate, inout_resample_offset);
+        return;
+    }
+
+    const int quality_index = (quality == SDL_AUDIO_RESAMPLE_QUALITY_HIGH) ? 1 : 0;
+    const PolyphaseFilter *polyphase = FindPolyphaseFilter(resample_rate);
+    if (polyphase && polyphase->taps[quality_index]) {
+        ResampleAudio_Polyphase(chans, src, inframes, dst, outframes, polyphase, quality_index, inout_resample_offset);
+        return;
+    }
+
+    if (quality == SDL_AUDIO_RESAMPLE_QUALITY_HIGH) {
+        ResampleAudio_High(chans, src, inframes, dst, outframes, resample_rate, inout_resample_offset);
+        return;
+    }
+
     src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
 
     for (i = 0; i < outframes; ++i) {
@@ -833,6 +833,101 @@ static void SDL_Convert_Swap32_NEON(Uint32 *dst, const Uint32 *src, int num_samp
 #undef CONVERT_16_FWD
 #undef CONVERT_16_REV
 
+// Accumulating streams into a float32 mix buffer. These don't clamp: a mix is summed in full and clamped
+//  once at the end, so the result doesn't depend on the order the streams were added in.
+
+static void SDL_Mix_F32_Scalar(float *dst, const float *src, int num_samples, float gain)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+static void SDL_Clamp_F32_Scalar(float *dst, int num_samples)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        const float sample = dst[i];
+        dst[i] = (sample < -1.0f) ? -1.0f : ((sample > 1.0f) ? 1.0f : sample);
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") SDL_Mix_F32_SSE(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m128 vgain = _mm_set1_ps(gain);
+    int i = 0;
+
+    for (; i + 8 <= num_samples; i += 8) {
+        const __m128 src0 = _mm_mul_ps(_mm_loadu_ps(&src[i]), vgain);
+        const __m128 src1 = _mm_mul_ps(_mm_loadu_ps(&src[i + 4]), vgain);
+        _mm_storeu_ps(&dst[i], _mm_add_ps(_mm_loadu_ps(&dst[i]), src0));
+        _mm_storeu_ps(&dst[i + 4], _mm_add_ps(_mm_loadu_ps(&dst[i + 4]), src1));
+    }
+    SDL_Mix_F32_Scalar(&dst[i], &src[i], num_samples - i, gain);
+}
+
+static void SDL_TARGETING("sse") SDL_Clamp_F32_SSE(float *dst, int num_samples)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minus_one = _mm_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; i + 4 <= num_samples; i += 4) {
+        _mm_storeu_ps(&dst[i], _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&dst[i]), minus_one), one));
+    }
+    SDL_Clamp_F32_Scalar(&dst[i], num_samples - i);
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") SDL_Mix_F32_AVX2(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m256 vgain = _mm256_set1_ps(gain);
+    int i = 0;
+
+    // No FMA here, so the result is the same whichever version runs.
+    for (; i + 16 <= num_samples; i += 16) {
+        const __m256 src0 = _mm256_mul_ps(_mm256_loadu_ps(&src[i]), vgain);
+        const __m256 src1 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), vgain);
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_loadu_ps(&dst[i]), src0));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_add_ps(_mm256_loadu_ps(&dst[i + 8]), src1));
+    }
+    SDL_Mix_F32_Scalar(&dst[i], &src[i], num_samples - i, gain);
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_Mix_F32_NEON(float *dst, const float *src, int num_samples, float gain)
+{
+    const float32x4_t vgain = vdupq_n_f32(gain);
+    int i = 0;
+
+    for (; i + 8 <= num_samples; i += 8) {
+        const float32x4_t src0 = vmulq_f32(vld1q_f32(&src[i]), vgain);
+        const float32x4_t src1 = vmulq_f32(vld1q_f32(&src[i + 4]), vgain);
+        vst1q_f32(&dst[i], vaddq_f32(vld1q_f32(&dst[i]), src0));
+        vst1q_f32(&dst[i + 4], vaddq_f32(vld1q_f32(&dst[i + 4]), src1));
+    }
+    SDL_Mix_F32_Scalar(&dst[i], &src[i], num_samples - i, gain);
+}
+
+static void SDL_Clamp_F32_NEON(float *dst, int num_samples)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minus_one = vdupq_n_f32(-1.0f);
+    int i = 0;
+
+    for (; i + 4 <= num_samples; i += 4) {
+        vst1q_f32(&dst[i], vminq_f32(vmaxq_f32(vld1q_f32(&dst[i]), minus_one), one));
+    }
+    SDL_Clamp_F32_Scalar(&dst[i], num_samples - i);
+}
+#endif
+
 // Function pointers set to a CPU-specific implementation.
 static void (*SDL_Convert_S8_to_F32)(float *dst, const Sint8 *src, int num_samples) = NULL;
 static void (*SDL_Convert_U8_to_F32)(float *dst, const Uint8 *src, int num_samples) = NULL;
@@ -846,6 +941,9 @@ static void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_sam
 static void (*SDL_Convert_Swap16)(Uint16 *dst, const Uint16 *src, int num_samples) = NULL;
 static void (*SDL_Convert_Swap32)(Uint32 *dst, const Uint32 *src, int num_samples) = NULL;
 
+static void (*SDL_Mix_F32)(float *dst, const float *src, int num_samples, float gain) = NULL;
+static void (*SDL_Clamp_F32)(float *dst, int num_samples) = NULL;
+
 void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt)
 {
     switch (src_fmt) {
@@ -929,6 +1027,16 @@ void ConvertAudioSwapEndian(void *dst, const void *src, int num_samples, int bit
     }
 }
 
+void MixFloat32Audio(float *dst, const float *src, int num_samples, float gain)
+{
+    SDL_Mix_F32(dst, src, num_samples, gain);
+}
+
+void ClampFloat32Audio(float *dst, int num_samples)
+{
+    SDL_Clamp_F32(dst, num_samples);
+}
+
 void SDL_ChooseAudioConverters(void)
 {
     static bool converters_chosen = false;
@@ -982,5 +1090,38 @@ void SDL_ChooseAudioConverters(void)
 
 #undef SET_CONVERTER_FUNCS
 
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SDL_Mix_F32 = SDL_Mix_F32_AVX2;
+    } else
+#endif
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        SDL_Mix_F32 = SDL_Mix_F32_SSE;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_Mix_F32 = SDL_Mix_F32_NEON;
+    } else
+#endif
+    {
+        SDL_Mix_F32 = SDL_Mix_F32_Scalar;
+    }
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        SDL_Clamp_F32 = SDL_Clamp_F32_SSE;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_Clamp_F32 = SDL_Clamp_F32_NEON;
+    } else
+#endif
+    {
+        SDL_Clamp_F32 = SDL_Clamp_F32_Scalar;
+    }
+
     converters_chosen = true;
 }
@@ -82,7 +82,373 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(type, s, v) ((s) = (type)(((s) * (v)) / MIX_MAXVOLUME))
 #define ADJUST_VOLUME_U8(s, v)    ((s) = (Uint8)(((((s) - 128) * (v)) / MIX_MAXVOLUME) + 128))
 
-// !!! FIXME: This needs some SIMD magic.
+/* The SIMD versions below give exactly the same results as the scalar code. For the
+ * integer formats they only handle volumes from 1 to MIX_MAXVOLUME, where the scaled
+ * sample can't overflow, so it's rounded toward zero and added with saturation just
+ * like the scalar code does. They return the number of samples they mixed, and the
+ * scalar code mixes whatever is left. */
+
+#ifdef SDL_SSE2_INTRINSICS
+static __m128i SDL_TARGETING("sse2") SDL_MixSwap16_SSE2(__m128i x)
+{
+    return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+static __m128i SDL_TARGETING("sse2") SDL_MixSwap32_SSE2(__m128i x)
+{
+    x = SDL_MixSwap16_SSE2(x);
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+/* (s * v) / MIX_MAXVOLUME, rounded toward zero. The sample is split into
+ * (hi * MIX_MAXVOLUME + lo), so neither product can overflow a lane. */
+static __m128i SDL_TARGETING("sse2") SDL_MixScaleS16_SSE2(__m128i s, __m128i v)
+{
+    const __m128i mask = _mm_set1_epi16(MIX_MAXVOLUME - 1);
+    const __m128i hi = _mm_mullo_epi16(_mm_srai_epi16(s, 7), v);
+    const __m128i lo = _mm_mullo_epi16(_mm_and_si128(s, mask), v);
+    // Negative samples with a remainder were rounded down, so round them back up
+    const __m128i round = _mm_andnot_si128(_mm_cmpeq_epi16(_mm_and_si128(lo, mask), _mm_setzero_si128()), _mm_srli_epi16(s, 15));
+    return _mm_add_epi16(_mm_add_epi16(hi, _mm_srli_epi16(lo, 7)), round);
+}
+
+static __m128i SDL_TARGETING("sse2") SDL_MixScaleS32_SSE2(__m128i s, __m128i v)
+{
+    const __m128i mask = _mm_set1_epi32(MIX_MAXVOLUME - 1);
+    const __m128i shi = _mm_srai_epi32(s, 7);
+    // There's no 32-bit multiply in SSE2, but the low half of an unsigned product is the same
+    const __m128i even = _mm_mul_epu32(shi, v);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(shi, 32), v);
+    const __m128i hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    const __m128i lo = _mm_madd_epi16(_mm_and_si128(s, mask), v);
+    const __m128i round = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(lo, mask), _mm_setzero_si128()), _mm_srli_epi32(s, 31));
+    return _mm_add_epi32(_mm_add_epi32(hi, _mm_srli_epi32(lo, 7)), round);
+}
+
+static __m128i SDL_TARGETING("sse2") SDL_MixAddSaturateS32_SSE2(__m128i a, __m128i b)
+{
+    const __m128i sum = _mm_add_epi32(a, b);
+    // It overflowed if both inputs have the same sign and the sum doesn't
+    const __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(a, sum), _mm_xor_si128(b, sum)), 31);
+    const __m128i saturated = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(SDL_MAX_SINT32));
+    return _mm_or_si128(_mm_and_si128(overflow, saturated), _mm_andnot_si128(overflow, sum));
+}
+
+static Uint32 SDL_TARGETING("sse2") SDL_MixAudio_SSE2(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 num_samples, int volume, float fvolume)
+{
+    Uint32 i = 0;
+
+    switch (format) {
+    case SDL_AUDIO_S16LE:
+    case SDL_AUDIO_S16BE:
+    {
+        const bool swap = (format != SDL_AUDIO_S16);
+        const __m128i v = _mm_set1_epi16((Sint16)volume);
+
+        for (; i + 8 <= num_samples; i += 8) {
+            __m128i s = _mm_loadu_si128((const __m128i *)&src[i * 2]);
+            __m128i d = _mm_loadu_si128((const __m128i *)&dst[i * 2]);
+            if (swap) {
+                s = SDL_MixSwap16_SSE2(s);
+                d = SDL_MixSwap16_SSE2(d);
+            }
+            d = _mm_adds_epi16(SDL_MixScaleS16_SSE2(s, v), d);
+            if (swap) {
+                d = SDL_MixSwap16_SSE2(d);
+            }
+            _mm_storeu_si128((__m128i *)&dst[i * 2], d);
+        }
+    } break;
+
+    case SDL_AUDIO_S32LE:
+    case SDL_AUDIO_S32BE:
+    {
+        const bool swap = (format != SDL_AUDIO_S32);
+        const __m128i v = _mm_set1_epi32(volume);
+
+        for (; i + 4 <= num_samples; i += 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *)&src[i * 4]);
+            __m128i d = _mm_loadu_si128((const __m128i *)&dst[i * 4]);
+            if (swap) {
+                s = SDL_MixSwap32_SSE2(s);
+                d = SDL_MixSwap32_SSE2(d);
+            }
+            d = SDL_MixAddSaturateS32_SSE2(SDL_MixScaleS32_SSE2(s, v), d);
+            if (swap) {
+                d = SDL_MixSwap32_SSE2(d);
+            }
+            _mm_storeu_si128((__m128i *)&dst[i * 4], d);
+        }
+    } break;
+
+    case SDL_AUDIO_F32LE:
+    case SDL_AUDIO_F32BE:
+    {
+        const bool swap = (format != SDL_AUDIO_F32);
+        const __m128 v = _mm_set1_ps(fvolume);
+        const __m128 max_audioval = _mm_set1_ps(1.0f);
+        const __m128 min_audioval = _mm_set1_ps(-1.0f);
+
+        for (; i + 4 <= num_samples; i += 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *)&src[i * 4]);
+            __m128i d = _mm_loadu_si128((const __m128i *)&dst[i * 4]);
+            __m128 mixed;
+            if (swap) {
+                s = SDL_MixSwap32_SSE2(s);
+                d = SDL_MixSwap32_SSE2(d);
+            }
+            // No FMA, and the clamp takes its operands in this order so NaN passes through like it does in the scalar code
+            mixed = _mm_add_ps(_mm_mul_ps(_mm_castsi128_ps(s), v), _mm_castsi128_ps(d));
+            d = _mm_castps_si128(_mm_min_ps(max_audioval, _mm_max_ps(min_audioval, mixed)));
+            if (swap) {
+                d = SDL_MixSwap32_SSE2(d);
+            }
+            _mm_storeu_si128((__m128i *)&dst[i * 4], d);
+        }
+    } break;
+
+    default:
+        break;
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static __m256i SDL_TARGETING("avx2") SDL_MixScaleS16_AVX2(__m256i s, __m256i v)
+{
+    const __m256i mask = _mm256_set1_epi16(MIX_MAXVOLUME - 1);
+    const __m256i hi = _mm256_mullo_epi16(_mm256_srai_epi16(s, 7), v);
+    const __m256i lo = _mm256_mullo_epi16(_mm256_and_si256(s, mask), v);
+    const __m256i round = _mm256_andnot_si256(_mm256_cmpeq_epi16(_mm256_and_si256(lo, mask), _mm256_setzero_si256()), _mm256_srli_epi16(s, 15));
+    return _mm256_add_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(lo, 7)), round);
+}
+
+static __m256i SDL_TARGETING("avx2") SDL_MixScaleS32_AVX2(__m256i s, __m256i v)
+{
+    const __m256i mask = _mm256_set1_epi32(MIX_MAXVOLUME - 1);
+    const __m256i hi = _mm256_mullo_epi32(_mm256_srai_epi32(s, 7), v);
+    const __m256i lo = _mm256_mullo_epi32(_mm256_and_si256(s, mask), v);
+    const __m256i round = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(lo, mask), _mm256_setzero_si256()), _mm256_srli_epi32(s, 31));
+    return _mm256_add_epi32(_mm256_add_epi32(hi, _mm256_srli_epi32(lo, 7)), round);
+}
+
+static __m256i SDL_TARGETING("avx2") SDL_MixAddSaturateS32_AVX2(__m256i a, __m256i b)
+{
+    const __m256i sum = _mm256_add_epi32(a, b);
+    const __m256i overflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(a, sum), _mm256_xor_si256(b, sum)), 31);
+    const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(SDL_MAX_SINT32));
+    return _mm256_blendv_epi8(sum, saturated, overflow);
+}
+
+static Uint32 SDL_TARGETING("avx2") SDL_MixAudio_AVX2(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 num_samples, int volume, float fvolume)
+{
+    const __m256i swap16 = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                            1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m256i swap32 = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                            3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    Uint32 i = 0;
+
+    switch (format) {
+    case SDL_AUDIO_S16LE:
+    case SDL_AUDIO_S16BE:
+    {
+        const bool swap = (format != SDL_AUDIO_S16);
+        const __m256i v = _mm256_set1_epi16((Sint16)volume);
+
+        for (; i + 16 <= num_samples; i += 16) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)&src[i * 2]);
+            __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i * 2]);
+            if (swap) {
+                s = _mm256_shuffle_epi8(s, swap16);
+                d = _mm256_shuffle_epi8(d, swap16);
+            }
+            d = _mm256_adds_epi16(SDL_MixScaleS16_AVX2(s, v), d);
+            if (swap) {
+                d = _mm256_shuffle_epi8(d, swap16);
+            }
+            _mm256_storeu_si256((__m256i *)&dst[i * 2], d);
+        }
+    } break;
+
+    case SDL_AUDIO_S32LE:
+    case SDL_AUDIO_S32BE:
+    {
+        const bool swap = (format != SDL_AUDIO_S32);
+        const __m256i v = _mm256_set1_epi32(volume);
+
+        for (; i + 8 <= num_samples; i += 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)&src[i * 4]);
+            __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i * 4]);
+            if (swap) {
+                s = _mm256_shuffle_epi8(s, swap32);
+                d = _mm256_shuffle_epi8(d, swap32);
+            }
+            d = SDL_MixAddSaturateS32_AVX2(SDL_MixScaleS32_AVX2(s, v), d);
+            if (swap) {
+                d = _mm256_shuffle_epi8(d, swap32);
+            }
+            _mm256_storeu_si256((__m256i *)&dst[i * 4], d);
+        }
+    } break;
+
+    case SDL_AUDIO_F32LE:
+    case SDL_AUDIO_F32BE:
+    {
+        const bool swap = (format != SDL_AUDIO_F32);
+        const __m256 v = _mm256_set1_ps(fvolume);
+        const __m256 max_audioval = _mm256_set1_ps(1.0f);
+        const __m256 min_audioval = _mm256_set1_ps(-1.0f);
+
+        for (; i + 8 <= num_samples; i += 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *)&src[i * 4]);
+            __m256i d = _mm256_loadu_si256((const __m256i *)&dst[i * 4]);
+            __m256 mixed;
+            if (swap) {
+                s = _mm256_shuffle_epi8(s, swap32);
+                d = _mm256_shuffle_epi8(d, swap32);
+            }
+            mixed = _mm256_add_ps(_mm256_mul_ps(_mm256_castsi256_ps(s), v), _mm256_castsi256_ps(d));
+            d = _mm256_castps_si256(_mm256_min_ps(max_audioval, _mm256_max_ps(min_audioval, mixed)));
+            if (swap) {
+                d = _mm256_shuffle_epi8(d, swap32);
+            }
+            _mm256_storeu_si256((__m256i *)&dst[i * 4], d);
+        }
+    } break;
+
+    default:
+        break;
+    }
+
+    return i;
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static int16x8_t SDL_MixScaleS16_NEON(int16x8_t s, int16x8_t v)
+{
+    const int16x8_t mask = vdupq_n_s16(MIX_MAXVOLUME - 1);
+    const int16x8_t hi = vmulq_s16(vshrq_n_s16(s, 7), v);
+    const int16x8_t lo = vmulq_s16(vandq_s16(s, mask), v);
+    const int16x8_t round = vandq_s16(vreinterpretq_s16_u16(vtstq_s16(lo, mask)), vreinterpretq_s16_u16(vshrq_n_u16(vreinterpretq_u16_s16(s), 15)));
+    return vaddq_s16(vaddq_s16(hi, vshrq_n_s16(lo, 7)), round);
+}
+
+static int32x4_t SDL_MixScaleS32_NEON(int32x4_t s, int32x4_t v)
+{
+    const int32x4_t mask = vdupq_n_s32(MIX_MAXVOLUME - 1);
+    const int32x4_t hi = vmulq_s32(vshrq_n_s32(s, 7), v);
+    const int32x4_t lo = vmulq_s32(vandq_s32(s, mask), v);
+    const int32x4_t round = vandq_s32(vreinterpretq_s32_u32(vtstq_s32(lo, mask)), vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(s), 31)));
+    return vaddq_s32(vaddq_s32(hi, vshrq_n_s32(lo, 7)), round);
+}
+
+static Uint32 SDL_MixAudio_NEON(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 num_samples, int volume, float fvolume)
+{
+    Uint32 i = 0;
+
+    switch (format) {
+    case SDL_AUDIO_S16LE:
+    case SDL_AUDIO_S16BE:
+    {
+        const bool swap = (format != SDL_AUDIO_S16);
+        const int16x8_t v = vdupq_n_s16((Sint16)volume);
+
+        for (; i + 8 <= num_samples; i += 8) {
+            uint8x16_t s = vld1q_u8(&src[i * 2]);
+            uint8x16_t d = vld1q_u8(&dst[i * 2]);
+            if (swap) {
+                s = vrev16q_u8(s);
+                d = vrev16q_u8(d);
+            }
+            d = vreinterpretq_u8_s16(vqaddq_s16(SDL_MixScaleS16_NEON(vreinterpretq_s16_u8(s), v), vreinterpretq_s16_u8(d)));
+            if (swap) {
+                d = vrev16q_u8(d);
+            }
+            vst1q_u8(&dst[i * 2], d);
+        }
+    } break;
+
+    case SDL_AUDIO_S32LE:
+    case SDL_AUDIO_S32BE:
+    {
+        const bool swap = (format != SDL_AUDIO_S32);
+        const int32x4_t v = vdupq_n_s32(volume);
+
+        for (; i + 4 <= num_samples; i += 4) {
+            uint8x16_t s = vld1q_u8(&src[i * 4]);
+            uint8x16_t d = vld1q_u8(&dst[i * 4]);
+            if (swap) {
+                s = vrev32q_u8(s);
+                d = vrev32q_u8(d);
+            }
+            d = vreinterpretq_u8_s32(vqaddq_s32(SDL_MixScaleS32_NEON(vreinterpretq_s32_u8(s), v), vreinterpretq_s32_u8(d)));
+            if (swap) {
+                d = vrev32q_u8(d);
+            }
+            vst1q_u8(&dst[i * 4], d);
+        }
+    } break;
+
+    case SDL_AUDIO_F32LE:
+    case SDL_AUDIO_F32BE:
+    {
+        const bool swap = (format != SDL_AUDIO_F32);
+        const float32x4_t v = vdupq_n_f32(fvolume);
+        const float32x4_t max_audioval = vdupq_n_f32(1.0f);
+        const float32x4_t min_audioval = vdupq_n_f32(-1.0f);
+
+        for (; i + 4 <= num_samples; i += 4) {
+            uint8x16_t s = vld1q_u8(&src[i * 4]);
+            uint8x16_t d = vld1q_u8(&dst[i * 4]);
+            float32x4_t mixed;
+            if (swap) {
+                s = vrev32q_u8(s);
+                d = vrev32q_u8(d);
+            }
+            mixed = vaddq_f32(vmulq_f32(vreinterpretq_f32_u8(s), v), vreinterpretq_f32_u8(d));
+            d = vreinterpretq_u8_f32(vminq_f32(vmaxq_f32(mixed, min_audioval), max_audioval));
+            if (swap) {
+                d = vrev32q_u8(d);
+            }
+            vst1q_u8(&dst[i * 4], d);
+        }
+    } break;
+
+    default:
+        break;
+    }
+
+    return i;
+}
+#endif
+
+static Uint32 SDL_MixAudio_SIMD(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 num_samples, int volume, float fvolume)
+{
+    if (!SDL_AUDIO_ISFLOAT(format) && (volume < 0 || volume > MIX_MAXVOLUME)) {
+        return 0;
+    }
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return SDL_MixAudio_AVX2(dst, src, format, num_samples, volume, fvolume);
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return SDL_MixAudio_SSE2(dst, src, format, num_samples, volume, fvolume);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return SDL_MixAudio_NEON(dst, src, format, num_samples, volume, fvolume);
+    }
+#endif
+    return 0;
+}
+
 // !!! FIXME: Add fast-path for volume = 1
 // !!! FIXME: Use larger scales for 16-bit/32-bit integers
 
@@ -94,6 +460,13 @@ bool SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 l
         return true;
     }
 
+    if (SDL_AUDIO_BITSIZE(format) >= 16) {
+        const Uint32 mixed = SDL_MixAudio_SIMD(dst, src, format, len / SDL_AUDIO_BYTESIZE(format), volume, fvolume) * SDL_AUDIO_BYTESIZE(format);
+        dst += mixed;
+        src += mixed;
+        len -= mixed;
+    }
+
     switch (format) {
 
     case SDL_AUDIO_U8:
@@ -24,6 +24,8 @@
 #ifndef SDL_sysaudio_h_
 #define SDL_sysaudio_h_
 
+#include "../thread/SDL_workerpool_c.h"
+
 #define DEBUG_AUDIOSTREAM 0
 #define DEBUG_AUDIO_CONVERT 0
 
@@ -48,6 +50,8 @@
 
 #define SDL_MAX_CHANNELMAP_CHANNELS 8  // !!! FIXME: if SDL ever supports more channels, clean this out and make those parts dynamic.
 
+#define SDL_MAX_AUDIO_MIX_WORKERS 16  // upper limit on SDL_HINT_AUDIO_DEVICE_MIX_THREADS, including the device thread itself.
+
 typedef struct SDL_AudioDevice SDL_AudioDevice;
 typedef struct SDL_LogicalAudioDevice SDL_LogicalAudioDevice;
 
@@ -114,6 +118,10 @@ extern void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SD
 extern void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_AudioFormat dst_fmt);
 extern void ConvertAudioSwapEndian(void *dst, const void *src, int num_samples, int bitsize);
 
+// dst += src * gain, without clamping. Clamp the finished mix with ClampFloat32Audio.
+extern void MixFloat32Audio(float *dst, const float *src, int num_samples, float gain);
+extern void ClampFloat32Audio(float *dst, int num_samples);
+
 extern bool SDL_ChannelMapIsDefault(const int *map, int channels);
 extern bool SDL_ChannelMapIsBogus(const int *map, int channels);
 
@@ -142,6 +150,11 @@ extern void OnAudioStreamDestroy(SDL_AudioStream *stream);
 // This just lets audio playback apply logical device gain at the same time as audiostream gain, so it's one multiplication instead of thousands.
 extern int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain);
 
+// This is SDL_GetAudioStreamDataAdjustGain for a stream with float32 output, but it adds the data to `mix_buffer` instead
+//  of replacing what's there, so the device doesn't need another buffer and pass over it for each stream.
+//  The output is swizzled through `device_chmap` first, unless it's NULL. Returns the number of bytes mixed in.
+extern int SDL_MixAudioStreamData(SDL_AudioStream *stream, float *mix_buffer, int len, float extra_gain, const int *device_chmap);
+
 // This is the bulk of `SDL_SetAudioStream*putChannelMap`'s work, but it lets you skip the check about changing the device end of a stream if isinput==-1.
 extern bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec, int **stream_chmap, const int *chmap, int channels, int isinput);
 
@@ -217,6 +230,8 @@ struct SDL_AudioStream
     int *dst_chmap;
     float freq_ratio;
     float gain;
+    SDL_AudioResampleQuality resample_quality;  // from SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, updated when the stream is read from
+    bool single_producer;  // true if data is put through the queue's lock-free ring, see SDL_SetAudioStreamSingleProducer
 
     struct SDL_AudioQueue *queue;
 
@@ -342,6 +357,17 @@ struct SDL_AudioDevice
     // Size of work_buffer (and mix_buffer) in bytes.
     int work_buffer_size;
 
+    // Optional helper threads that convert bound streams in parallel. See SDL_HINT_AUDIO_DEVICE_MIX_THREADS.
+    SDL_WorkerPool *mix_pool;
+
+    // Per-worker accumulation buffers for mix_pool, each mix_pool_buffer_size bytes.
+    Uint8 *mix_pool_buffers;
+    int mix_pool_buffer_size;
+
+    // Bound streams gathered for a parallel mix, so workers can index them.
+    SDL_AudioStream **mix_pool_streams;
+    int mix_pool_streams_allocated;
+
     // A thread to feed the audio device
     SDL_Thread *thread;
 
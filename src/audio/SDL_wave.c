@@ -1159,7 +1159,10 @@ static bool LAW_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* Expands companded samples to 16 bits. Works backwards, so `src` and `dst`
+ * can point to the same memory.
+ */
+static bool LAW_DecodeSamples(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1199,54 +1202,10 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
     };
 #endif
+    size_t i;
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return false;
-        }
-    }
-
-    // Nothing to decode, nothing to return.
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return true;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    // 1 to avoid allocating zero bytes, to keep static analysis happy.
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!src) {
-        return false;
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
-
-    /* Work backwards, since we're expanding in-place. `format` will
-     * inform the caller about the byte order.
-     */
     i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1291,10 +1250,61 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return true;
+}
+
+static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return false;
+        }
+    }
+
+    // Nothing to decode, nothing to return.
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return true;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    // 1 to avoid allocating zero bytes, to keep static analysis happy.
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!src) {
+        return false;
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    /* Expanding in-place. `format` will inform the caller about the byte
+     * order.
+     */
+    if (!LAW_DecodeSamples(file->format.encoding, src, (Sint16 *)src, sample_count)) {
+        SDL_free(src);
+        return false;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1344,11 +1354,33 @@ static bool PCM_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+// Shifts 24-bit samples to 32 bits in-place. `ptr` must have room for the expanded samples.
+static void PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    // work from end to start, since we're expanding in-place.
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1376,21 +1408,7 @@ static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    // work from end to start, since we're expanding in-place.
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return true;
 }
@@ -1770,7 +1788,11 @@ static bool WaveCheckFormat(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Finds the fmt and data chunks and checks the format. This leaves the data
+ * chunk in file->chunk, without reading its data, and sets `spec` to the
+ * format the data gets decoded to.
+ */
+static bool WaveLoadHeader(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1990,9 +2012,69 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
 
     WaveFreeChunkData(chunk);
 
-    // Process data chunk.
+    // The data chunk is processed by the caller.
     *chunk = datachunk;
 
+    /* Setting up the specs. All unsupported formats were filtered out
+     * by checks earlier in this function.
+     */
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = SDL_AUDIO_UNKNOWN;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        // These can be easily stored in the byte order of the system.
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: // Has been shifted to 32 bits.
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            // Just in case something unexpected happened in the checks.
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
+    // Save the end position, so the caller can seek past the file when done.
+    if (RIFFlengthknown) {
+        file->endposition = RIFFend;
+    } else {
+        file->endposition = lastchunkpos;
+    }
+
+    return true;
+}
+
+static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (!WaveLoadHeader(src, file, spec)) {
+        return false;
+    }
+
+    // Process data chunk.
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result < 0) {
@@ -2036,51 +2118,8 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = SDL_AUDIO_UNKNOWN;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        // These can be easily stored in the byte order of the system.
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: // Has been shifted to 32 bits.
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            // Just in case something unexpected happened in the checks.
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
-    }
-
     // Report the end position back to the cleanup code.
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = file->endposition;
 
     return true;
 }
@@ -2161,3 +2200,324 @@ bool SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint3
     return SDL_LoadWAV_IO(stream, true, spec, audio_buf, audio_len);
 }
 
+
+/* Streaming WAVE decoding. The header is only parsed once, then the data chunk
+ * is read and decoded a block at a time, whenever the audio stream asks for
+ * more. Only one block of input and output is kept in memory.
+ */
+
+// Sample frames read at a time from PCM and companded data. ADPCM is read a block at a time.
+#define WAVE_STREAM_FRAMES 1024
+
+#define WAVE_STREAM_PROPERTY "SDL.audiostream.wave.internal"
+
+typedef struct WaveStream
+{
+    SDL_AudioStream *stream;
+    SDL_IOStream *src;
+    bool closeio;
+
+    WaveFile file;
+    SDL_AudioSpec spec; // Format of the decoded data.
+    bool adpcm;
+    size_t readsize;    // Most input bytes read at a time.
+    size_t framesize;   // Size of a decoded sample frame in bytes.
+
+    Sint64 frame;       // Next sample frame to decode.
+    Sint64 skipframes;  // Sample frames to drop from the next read, after seeking into the middle of an ADPCM block.
+    Sint64 dataleft;    // Bytes left to read from the data chunk.
+    bool flushed;       // Everything was decoded and the audio stream was flushed.
+
+    Uint8 *input;       // ADPCM block. Other formats are read straight into the output and expanded in-place.
+    Uint8 *output;
+
+    ADPCM_DecoderState state;
+    MS_ADPCM_ChannelState ms_cstate[2];
+    Sint8 *ima_cstate;
+} WaveStream;
+
+static void WaveStreamFree(WaveStream *ws)
+{
+    if (ws) {
+        SDL_free(ws->file.decoderdata);
+        SDL_free(ws->ima_cstate);
+        SDL_free(ws->input);
+        SDL_free(ws->output);
+        SDL_free(ws);
+    }
+}
+
+static bool WaveStreamSeek(WaveStream *ws, Sint64 frame)
+{
+    const WaveFormat *format = &ws->file.format;
+    Sint64 readframe, offset, position;
+
+    frame = SDL_clamp(frame, 0, ws->file.sampleframes);
+
+    // ADPCM can only start decoding at the beginning of a block.
+    if (ws->adpcm) {
+        readframe = frame - (frame % format->samplesperblock);
+        offset = (readframe / format->samplesperblock) * format->blockalign;
+    } else {
+        readframe = frame;
+        offset = frame * format->blockalign;
+    }
+
+    offset = SDL_min(offset, (Sint64)ws->file.chunk.length);
+    position = ws->file.chunk.position + offset;
+    if (SDL_SeekIO(ws->src, position, SDL_IO_SEEK_SET) != position) {
+        return SDL_SetError("Could not seek in WAVE data chunk");
+    }
+
+    ws->frame = readframe;
+    ws->skipframes = frame - readframe;
+    ws->dataleft = (Sint64)ws->file.chunk.length - offset;
+    ws->flushed = false;
+
+    return true;
+}
+
+/* Reads and decodes the next block of sample frames. Returns the number of
+ * decoded bytes in `*data`, or 0 at the end of the data or on an I/O error.
+ */
+static size_t WaveStreamDecode(WaveStream *ws, const Uint8 **data)
+{
+    const WaveFormat *format = &ws->file.format;
+    const Sint64 framesleft = ws->file.sampleframes - ws->frame;
+    size_t toread, length;
+    Sint64 frames;
+
+    if (framesleft <= 0 || ws->dataleft <= 0) {
+        return 0;
+    }
+
+    if (ws->adpcm) {
+        toread = (size_t)SDL_min((Sint64)ws->readsize, ws->dataleft);
+        length = SDL_ReadIO(ws->src, ws->input, toread);
+        if (length < ws->state.blockheadersize) {
+            return 0;
+        }
+
+        ws->state.block.data = ws->input;
+        ws->state.block.size = length;
+        ws->state.block.pos = 0;
+        ws->state.output.data = (Sint16 *)ws->output;
+        ws->state.output.pos = 0;
+        ws->state.framesleft = framesleft;
+
+        // A truncated block still gives us whatever full sample frames it had.
+        if (format->encoding == MS_ADPCM_CODE) {
+            if (MS_ADPCM_DecodeBlockHeader(&ws->state)) {
+                MS_ADPCM_DecodeBlockData(&ws->state);
+            }
+        } else {
+            if (IMA_ADPCM_DecodeBlockHeader(&ws->state)) {
+                IMA_ADPCM_DecodeBlockData(&ws->state);
+            }
+        }
+        frames = ws->state.output.pos / ws->state.channels;
+    } else {
+        toread = (size_t)SDL_min(SDL_min(framesleft, WAVE_STREAM_FRAMES) * format->blockalign, ws->dataleft);
+        length = SDL_ReadIO(ws->src, ws->output, toread);
+        frames = length / format->blockalign;
+
+        if (format->encoding == ALAW_CODE || format->encoding == MULAW_CODE) {
+            LAW_DecodeSamples(format->encoding, ws->output, (Sint16 *)ws->output, (size_t)frames * format->channels);
+        } else if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            PCM_ExpandSint24ToSint32(ws->output, (size_t)frames * format->channels);
+        }
+    }
+
+    ws->dataleft -= length;
+    frames = SDL_min(frames, framesleft);
+    ws->frame += frames;
+
+    *data = ws->output;
+    if (ws->skipframes > 0) {
+        const Sint64 skip = SDL_min(ws->skipframes, frames);
+        *data += skip * ws->framesize;
+        frames -= skip;
+        ws->skipframes = 0;
+    }
+
+    return (size_t)frames * ws->framesize;
+}
+
+static void SDLCALL WaveStreamCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    WaveStream *ws = (WaveStream *)userdata;
+
+    while (additional_amount > 0 && !ws->flushed) {
+        const Uint8 *data = NULL;
+        const size_t length = WaveStreamDecode(ws, &data);
+
+        if (length == 0) {
+            // There's nowhere to report an I/O error from here, so it just ends the audio.
+            SDL_FlushAudioStream(stream);
+            ws->flushed = true;
+        } else if (!SDL_PutAudioStreamData(stream, data, (int)length)) {
+            break;
+        }
+
+        additional_amount -= (int)length;
+    }
+}
+
+static void SDLCALL WaveStreamCleanup(void *userdata, void *value)
+{
+    WaveStream *ws = (WaveStream *)value;
+
+    // The audio stream is being destroyed, make sure nothing asks for more data.
+    SDL_SetAudioStreamGetCallback(ws->stream, NULL, NULL);
+
+    if (ws->closeio) {
+        SDL_CloseIO(ws->src);
+    }
+    WaveStreamFree(ws);
+}
+
+static bool WaveStreamInit(WaveStream *ws)
+{
+    WaveFile *file = &ws->file;
+    const WaveFormat *format = &file->format;
+    size_t outputsize;
+
+    ws->framesize = SDL_AUDIO_FRAMESIZE(ws->spec);
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        ws->adpcm = true;
+        ws->readsize = format->blockalign;
+        outputsize = (size_t)format->samplesperblock * ws->framesize;
+
+        ws->state.channels = format->channels;
+        ws->state.blocksize = format->blockalign;
+        ws->state.samplesperblock = format->samplesperblock;
+        ws->state.framesize = ws->framesize;
+        ws->state.ddata = file->decoderdata;
+        ws->state.framestotal = file->sampleframes;
+        ws->state.output.size = outputsize / sizeof(Sint16);
+
+        if (format->encoding == MS_ADPCM_CODE) {
+            ws->state.blockheadersize = (size_t)format->channels * 7;
+            ws->state.cstate = ws->ms_cstate;
+        } else {
+            ws->state.blockheadersize = (size_t)format->channels * 4;
+            ws->ima_cstate = (Sint8 *)SDL_calloc(format->channels, sizeof(Sint8));
+            if (!ws->ima_cstate) {
+                return false;
+            }
+            ws->state.cstate = ws->ima_cstate;
+        }
+
+        ws->input = (Uint8 *)SDL_malloc(ws->readsize);
+        if (!ws->input) {
+            return false;
+        }
+        break;
+    default:
+        // Decoded in-place, so make room for whichever is bigger.
+        ws->readsize = (size_t)WAVE_STREAM_FRAMES * format->blockalign;
+        outputsize = SDL_max(ws->readsize, WAVE_STREAM_FRAMES * ws->framesize);
+        break;
+    }
+
+    ws->output = (Uint8 *)SDL_malloc(outputsize);
+    if (!ws->output) {
+        return false;
+    }
+
+    return true;
+}
+
+SDL_AudioStream *SDL_OpenWAVStream_IO(SDL_IOStream *src, bool closeio, const SDL_AudioSpec *dst_spec)
+{
+    WaveStream *ws = NULL;
+    SDL_AudioStream *stream = NULL;
+    SDL_PropertiesID props;
+
+    // Make sure we are passed a valid data source
+    CHECK_PARAM(!src) {
+        SDL_InvalidParamError("src");
+        return NULL;
+    }
+
+    ws = (WaveStream *)SDL_calloc(1, sizeof(*ws));
+    if (!ws) {
+        goto failed;
+    }
+
+    ws->src = src;
+    ws->closeio = closeio;
+    ws->file.riffhint = WaveGetRiffSizeHint();
+    ws->file.trunchint = WaveGetTruncationHint();
+    ws->file.facthint = WaveGetFactChunkHint();
+
+    if (!WaveLoadHeader(src, &ws->file, &ws->spec) || !WaveStreamInit(ws) || !WaveStreamSeek(ws, 0)) {
+        goto failed;
+    }
+
+    stream = SDL_CreateAudioStream(&ws->spec, dst_spec ? dst_spec : &ws->spec);
+    if (!stream) {
+        goto failed;
+    }
+    ws->stream = stream;
+
+    props = SDL_GetAudioStreamProperties(stream);
+    if (!props || !SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER, ws->file.sampleframes)) {
+        goto failed;
+    }
+
+    // From here on, the stream owns the decoder (and `src`, if closeio is true).
+    if (!SDL_SetPointerPropertyWithCleanup(props, WAVE_STREAM_PROPERTY, ws, WaveStreamCleanup, NULL)) {
+        SDL_DestroyAudioStream(stream);
+        return NULL;
+    }
+
+    if (!SDL_SetAudioStreamGetCallback(stream, WaveStreamCallback, ws)) {
+        SDL_DestroyAudioStream(stream);
+        return NULL;
+    }
+
+    return stream;
+
+failed:
+    SDL_DestroyAudioStream(stream);
+    WaveStreamFree(ws);
+    if (closeio) {
+        SDL_CloseIO(src);
+    }
+    return NULL;
+}
+
+SDL_AudioStream *SDL_OpenWAVStream(const char *path, const SDL_AudioSpec *dst_spec)
+{
+    SDL_IOStream *stream = SDL_IOFromFile(path, "rb");
+    if (!stream) {
+        return NULL;
+    }
+    return SDL_OpenWAVStream_IO(stream, true, dst_spec);
+}
+
+bool SDL_SeekWAVStream(SDL_AudioStream *stream, Sint64 frame)
+{
+    CHECK_PARAM(!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    WaveStream *ws = (WaveStream *)SDL_GetPointerProperty(SDL_GetAudioStreamProperties(stream), WAVE_STREAM_PROPERTY, NULL);
+    if (!ws) {
+        return SDL_SetError("Audio stream wasn't opened with SDL_OpenWAVStream");
+    }
+
+    // The get callback runs with the stream locked, so this keeps it from decoding while we move.
+    SDL_LockAudioStream(stream);
+    const bool result = WaveStreamSeek(ws, frame);
+    if (result) {
+        SDL_ClearAudioStream(stream);
+    }
+    SDL_UnlockAudioStream(stream);
+
+    return result;
+}
@@ -145,6 +145,8 @@ typedef struct WaveFile
 
     void *decoderdata; // Some decoders require extra data for a state.
 
+    Sint64 endposition; // Position after the RIFF chunk, or after the last chunk read if its size isn't known.
+
     WaveRiffSizeHint riffhint;
     WaveTruncationHint trunchint;
     WaveFactChunkHint facthint;
@@ -24,4 +24,8 @@
 
 extern void SDL_QuitCPUInfo(void);
 
+// These features aren't exposed in the public API, but SDL uses them internally.
+extern bool SDL_HasPCLMUL(void);
+extern bool SDL_HasARMCRC32(void);
+
 #endif // SDL_cpuinfo_c_h_
@@ -1282,3 +1282,25 @@
 #define SDL_hid_get_properties SDL_hid_get_properties_REAL
 #define SDL_GetPixelFormatFromGPUTextureFormat SDL_GetPixelFormatFromGPUTextureFormat_REAL
 #define SDL_GetGPUTextureFormatFromPixelFormat SDL_GetGPUTextureFormatFromPixelFormat_REAL
+#define SDL_PushEvents SDL_PushEvents_REAL
+#define SDL_GetPropertyAtom SDL_GetPropertyAtom_REAL
+#define SDL_GetPointerPropertyByAtom SDL_GetPointerPropertyByAtom_REAL
+#define SDL_GetStringPropertyByAtom SDL_GetStringPropertyByAtom_REAL
+#define SDL_GetNumberPropertyByAtom SDL_GetNumberPropertyByAtom_REAL
+#define SDL_GetFloatPropertyByAtom SDL_GetFloatPropertyByAtom_REAL
+#define SDL_GetBooleanPropertyByAtom SDL_GetBooleanPropertyByAtom_REAL
+#define SDL_SetAudioStreamSingleProducer SDL_SetAudioStreamSingleProducer_REAL
+#define SDL_OpenWAVStream_IO SDL_OpenWAVStream_IO_REAL
+#define SDL_OpenWAVStream SDL_OpenWAVStream_REAL
+#define SDL_SeekWAVStream SDL_SeekWAVStream_REAL
+#define SDL_GetGPUPipelineCacheData SDL_GetGPUPipelineCacheData_REAL
+#define SDL_RenderTextureBatch SDL_RenderTextureBatch_REAL
+#define SDL_CreateRenderCommandList SDL_CreateRenderCommandList_REAL
+#define SDL_ResetRenderCommandList SDL_ResetRenderCommandList_REAL
+#define SDL_SetRenderCommandListDrawColorFloat SDL_SetRenderCommandListDrawColorFloat_REAL
+#define SDL_SetRenderCommandListDrawBlendMode SDL_SetRenderCommandListDrawBlendMode_REAL
+#define SDL_RecordRenderFillRects SDL_RecordRenderFillRects_REAL
+#define SDL_RecordRenderTexture SDL_RecordRenderTexture_REAL
+#define SDL_RecordRenderGeometry SDL_RecordRenderGeometry_REAL
+#define SDL_SubmitRenderCommandList SDL_SubmitRenderCommandList_REAL
+#define SDL_DestroyRenderCommandList SDL_DestroyRenderCommandList_REAL
@@ -1290,3 +1290,25 @@ SDL_DYNAPI_PROC(Uint32,SDL_AddAtomicU32,(SDL_AtomicU32 *a,int b),(a,b),return)
 SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_hid_get_properties,(SDL_hid_device *a),(a),return)
 SDL_DYNAPI_PROC(SDL_PixelFormat,SDL_GetPixelFormatFromGPUTextureFormat,(SDL_GPUTextureFormat a),(a),return)
 SDL_DYNAPI_PROC(SDL_GPUTextureFormat,SDL_GetGPUTextureFormatFromPixelFormat,(SDL_PixelFormat a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_PushEvents,(SDL_Event *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_PropertyAtom,SDL_GetPropertyAtom,(const char *a),(a),return)
+SDL_DYNAPI_PROC(void*,SDL_GetPointerPropertyByAtom,(SDL_PropertiesID a, SDL_PropertyAtom b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetStringPropertyByAtom,(SDL_PropertiesID a, SDL_PropertyAtom b, const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetNumberPropertyByAtom,(SDL_PropertiesID a, SDL_PropertyAtom b, Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(float,SDL_GetFloatPropertyByAtom,(SDL_PropertiesID a, SDL_PropertyAtom b, float c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_GetBooleanPropertyByAtom,(SDL_PropertiesID a, SDL_PropertyAtom b, bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetAudioStreamSingleProducer,(SDL_AudioStream *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_OpenWAVStream_IO,(SDL_IOStream *a, bool b, const SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_OpenWAVStream,(const char *a, const SDL_AudioSpec *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SeekWAVStream,(SDL_AudioStream *a, Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_GetGPUPipelineCacheData,(SDL_GPUDevice *a, size_t *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_RenderTextureBatch,(SDL_Renderer *a, SDL_Texture *b, const SDL_FRect *c, const SDL_FRect *d, const SDL_FColor *e, const double *f, const SDL_FlipMode *g, int h),(a,b,c,d,e,f,g,h),return)
+SDL_DYNAPI_PROC(SDL_RenderCommandList*,SDL_CreateRenderCommandList,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_ResetRenderCommandList,(SDL_RenderCommandList *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetRenderCommandListDrawColorFloat,(SDL_RenderCommandList *a, float b, float c, float d, float e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_SetRenderCommandListDrawBlendMode,(SDL_RenderCommandList *a, SDL_BlendMode b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_RecordRenderFillRects,(SDL_RenderCommandList *a, const SDL_FRect *b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_RecordRenderTexture,(SDL_RenderCommandList *a, SDL_Texture *b, const SDL_FRect *c, const SDL_FRect *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_RecordRenderGeometry,(SDL_RenderCommandList *a, SDL_Texture *b, const SDL_Vertex *c, int d, const int *e, int f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(bool,SDL_SubmitRenderCommandList,(SDL_RenderCommandList *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyRenderCommandList,(SDL_RenderCommandList *a),(a),)
@@ -46,6 +46,9 @@
 // An arbitrary limit so we don't have unbounded growth
 #define SDL_MAX_QUEUED_EVENTS 65535
 
+// The number of events the lock-free ring can hold before falling back to the list, must be a power of two
+#define SDL_EVENT_RING_SIZE 4096
+
 // Determines how often we pump events if joystick or sensor subsystems are active
 #define ENUMERATION_POLL_INTERVAL_NS (3 * SDL_NS_PER_SECOND)
 
@@ -113,17 +116,44 @@ typedef struct
 static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static SDL_AtomicInt SDL_userevents;
 
+/* Temporary memory is carved out of per-thread chunks with a bump pointer.
+
+   Every allocation starts with an SDL_TemporaryMemory header, which links it
+   into the thread's list (or an event's list, while the event is queued) and
+   holds a reference on the chunk it came from. Freeing temporary memory just
+   drops those references, and once nothing in a chunk is in use any more the
+   owning thread starts again from the beginning of it. Allocations can end
+   up being freed on another thread along with their event, so the chunk
+   reference count is atomic. Blocks too big for a chunk get their own heap
+   allocation, with the header in front. */
+#define SDL_TEMPORARY_MEMORY_CHUNK_SIZE  (16 * 1024)
+#define SDL_TEMPORARY_MEMORY_MAX_IN_CHUNK (SDL_TEMPORARY_MEMORY_CHUNK_SIZE / 4)
+#define SDL_TEMPORARY_MEMORY_ALIGN(size) (((size) + 15) & ~(size_t)15)
+
+typedef struct SDL_TemporaryMemoryChunk
+{
+    SDL_AtomicInt refcount;    // one for each allocation, plus one while the owner is allocating from it
+    size_t used;
+} SDL_TemporaryMemoryChunk;
+
+#define SDL_TEMPORARY_MEMORY_CHUNK_HEADER SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemoryChunk))
+
 typedef struct SDL_TemporaryMemory
 {
-    void *memory;
+    SDL_TemporaryMemoryChunk *chunk;    // NULL if this block was allocated on its own
+    size_t size;
     struct SDL_TemporaryMemory *prev;
     struct SDL_TemporaryMemory *next;
 } SDL_TemporaryMemory;
 
+#define SDL_TEMPORARY_MEMORY_HEADER SDL_TEMPORARY_MEMORY_ALIGN(sizeof(SDL_TemporaryMemory))
+#define SDL_TemporaryMemoryData(entry) ((void *)((Uint8 *)(entry) + SDL_TEMPORARY_MEMORY_HEADER))
+
 typedef struct SDL_TemporaryMemoryState
 {
     SDL_TemporaryMemory *head;
     SDL_TemporaryMemory *tail;
+    SDL_TemporaryMemoryChunk *chunk;
 } SDL_TemporaryMemoryState;
 
 static SDL_TLSID SDL_temporary_memory;
@@ -136,23 +166,68 @@ typedef struct SDL_EventEntry
     struct SDL_EventEntry *next;
 } SDL_EventEntry;
 
+/* The optional lock-free front end of the queue (SDL_HINT_EVENT_QUEUE_LOCKFREE)
+
+   This is a bounded multi-producer ring: producers claim a position by
+   advancing `tail` and publish the event by bumping the slot's sequence
+   number, without ever taking the queue lock. Everything that reads the
+   queue already holds SDL_EventQ.lock, so that is the single consumer.
+
+   Events in the ring are always newer than events in the list. Anything
+   that can't go in the ring (a full ring, or events that own temporary
+   memory) takes the lock, moves the ring into the list and appends there,
+   and every reader except the common "get the next events" case does the
+   same before walking the list, so filtering works exactly as before.
+
+   Producers count themselves in `ring_users` while they hold the ring
+   pointer, so SDL_StopEventLoop() can take the ring away and wait for them
+   to finish before freeing it. */
+typedef struct SDL_EventRingSlot
+{
+    SDL_AtomicU32 sequence;
+    SDL_Event event;
+} SDL_EventRingSlot;
+
+typedef struct SDL_EventRing
+{
+    SDL_AtomicU32 tail;
+    Uint8 padding[64 - sizeof(SDL_AtomicU32)]; // keep the producers off the consumer's cache line
+    Uint32 head;    // only used with the queue locked
+    SDL_EventRingSlot slots[SDL_EVENT_RING_SIZE];
+} SDL_EventRing;
+
 static struct
 {
     SDL_Mutex *lock;
     bool active;
     SDL_AtomicInt count;
-    int max_events_seen;
+    SDL_AtomicInt max_events_seen;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
-} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL };
+    SDL_EventRing *ring;
+    SDL_AtomicInt ring_users;
+} SDL_EventQ = { NULL, false, { 0 }, { 0 }, NULL, NULL, NULL, NULL, { 0 } };
+
+static void SDL_MoveEventRingToList(SDL_EventRing *ring);
+static void SDL_DrainEventRing(void);
 
 
+static void SDL_ReleaseTemporaryMemoryChunk(SDL_TemporaryMemoryChunk *chunk)
+{
+    if (SDL_AtomicDecRef(&chunk->refcount)) {
+        SDL_free(chunk);
+    }
+}
+
 static void SDL_CleanupTemporaryMemory(void *data)
 {
     SDL_TemporaryMemoryState *state = (SDL_TemporaryMemoryState *)data;
 
     SDL_FreeTemporaryMemory();
+    if (state->chunk) {
+        SDL_ReleaseTemporaryMemoryChunk(state->chunk);
+    }
     SDL_free(state);
 }
 
@@ -185,7 +260,7 @@ static SDL_TemporaryMemory *SDL_GetTemporaryMemoryEntry(SDL_TemporaryMemoryState
 
     // Start from the end, it's likely to have been recently allocated
     for (entry = state->tail; entry; entry = entry->prev) {
-        if (mem == entry->memory) {
+        if (mem == SDL_TemporaryMemoryData(entry)) {
             return entry;
         }
     }
@@ -225,12 +300,13 @@ static void SDL_UnlinkTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_
     entry->next = NULL;
 }
 
-static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_TemporaryMemory *entry, bool free_data)
+static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemory *entry)
 {
-    if (free_data) {
-        SDL_free(entry->memory);
+    if (entry->chunk) {
+        SDL_ReleaseTemporaryMemoryChunk(entry->chunk);
+    } else {
+        SDL_free(entry);
     }
-    SDL_free(entry);
 }
 
 static void SDL_LinkTemporaryMemoryToEvent(SDL_EventEntry *event, const void *mem)
@@ -238,6 +314,10 @@ static void SDL_LinkTemporaryMemoryToEvent(SDL_EventEntry *event, const void *me
     SDL_TemporaryMemoryState *state;
     SDL_TemporaryMemory *entry;
 
+    if (!event) {
+        return;
+    }
+
     state = SDL_GetTemporaryMemoryState(false);
     if (!state) {
         return;
@@ -262,36 +342,41 @@ static void SDL_TransferSysWMMemoryToEvent(SDL_EventEntry *event)
     }
 }
 
-// Transfer the event memory from the thread-local event memory list to the event
-static void SDL_TransferTemporaryMemoryToEvent(SDL_EventEntry *event)
+/* Transfer the event memory from the thread-local event memory list to the
+   event, and return whether the event type carries any. If `entry` is NULL,
+   nothing is transferred, which tells whether an event can be queued without
+   an entry to hold its memory. */
+static bool SDL_TransferTemporaryMemoryToEvent(const SDL_Event *event, SDL_EventEntry *entry)
 {
-    switch (event->event.type) {
+    switch (event->type) {
     case SDL_EVENT_TEXT_EDITING:
-        SDL_LinkTemporaryMemoryToEvent(event, event->event.edit.text);
-        break;
+        SDL_LinkTemporaryMemoryToEvent(entry, event->edit.text);
+        return true;
     case SDL_EVENT_TEXT_EDITING_CANDIDATES:
-        SDL_LinkTemporaryMemoryToEvent(event, event->event.edit_candidates.candidates);
-        break;
+        SDL_LinkTemporaryMemoryToEvent(entry, event->edit_candidates.candidates);
+        return true;
     case SDL_EVENT_TEXT_INPUT:
-        SDL_LinkTemporaryMemoryToEvent(event, event->event.text.text);
-        break;
+        SDL_LinkTemporaryMemoryToEvent(entry, event->text.text);
+        return true;
     case SDL_EVENT_DROP_BEGIN:
     case SDL_EVENT_DROP_FILE:
     case SDL_EVENT_DROP_TEXT:
     case SDL_EVENT_DROP_COMPLETE:
     case SDL_EVENT_DROP_POSITION:
-        SDL_LinkTemporaryMemoryToEvent(event, event->event.drop.source);
-        SDL_LinkTemporaryMemoryToEvent(event, event->event.drop.data);
-        break;
+        SDL_LinkTemporaryMemoryToEvent(entry, event->drop.source);
+        SDL_LinkTemporaryMemoryToEvent(entry, event->drop.data);
+        return true;
     case SDL_EVENT_CLIPBOARD_UPDATE:
-        SDL_LinkTemporaryMemoryToEvent(event, event->event.clipboard.mime_types);
-        break;
+        SDL_LinkTemporaryMemoryToEvent(entry, event->clipboard.mime_types);
+        return true;
     case SDL2_SYSWMEVENT:
         // We need to copy the stack pointer into temporary memory
-        SDL_TransferSysWMMemoryToEvent(event);
-        break;
+        if (entry) {
+            SDL_TransferSysWMMemoryToEvent(entry);
+        }
+        return true;
     default:
-        break;
+        return false;
     }
 }
 
@@ -317,47 +402,85 @@ static void SDL_TransferTemporaryMemoryFromEvent(SDL_EventEntry *event)
     event->memory = NULL;
 }
 
-static void *SDL_FreeLater(void *memory)
+static SDL_TemporaryMemory *SDL_AllocateTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, size_t size)
 {
-    SDL_TemporaryMemoryState *state;
+    SDL_TemporaryMemoryChunk *chunk = state->chunk;
+    SDL_TemporaryMemory *entry;
+    const size_t needed = SDL_TEMPORARY_MEMORY_HEADER + SDL_TEMPORARY_MEMORY_ALIGN(size);
 
-    if (memory == NULL) {
-        return NULL;
+    if (size > SDL_TEMPORARY_MEMORY_MAX_IN_CHUNK) {
+        if (size > SDL_SIZE_MAX - SDL_TEMPORARY_MEMORY_HEADER) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        entry = (SDL_TemporaryMemory *)SDL_malloc(SDL_TEMPORARY_MEMORY_HEADER + size);
+        if (!entry) {
+            return NULL;
+        }
+        entry->chunk = NULL;
+        entry->size = size;
+        return entry;
     }
 
-    // Make sure we're not adding this to the list twice
-    //SDL_assert(!SDL_ClaimTemporaryMemory(memory));
+    if (chunk && SDL_GetAtomicInt(&chunk->refcount) == 1) {
+        // Everything allocated from this chunk has been freed, start over
+        chunk->used = SDL_TEMPORARY_MEMORY_CHUNK_HEADER;
+    }
+    if (!chunk || chunk->used + needed > SDL_TEMPORARY_MEMORY_CHUNK_SIZE) {
+        chunk = (SDL_TemporaryMemoryChunk *)SDL_malloc(SDL_TEMPORARY_MEMORY_CHUNK_SIZE);
+        if (!chunk) {
+            return NULL;
+        }
+        SDL_SetAtomicInt(&chunk->refcount, 1);
+        chunk->used = SDL_TEMPORARY_MEMORY_CHUNK_HEADER;
+        if (state->chunk) {
+            // The old chunk goes away when the last allocation from it is freed
+            SDL_ReleaseTemporaryMemoryChunk(state->chunk);
+        }
+        state->chunk = chunk;
+    }
+
+    entry = (SDL_TemporaryMemory *)((Uint8 *)chunk + chunk->used);
+    chunk->used += needed;
+    SDL_AtomicIncRef(&chunk->refcount);
+    entry->chunk = chunk;
+    entry->size = size;
+    return entry;
+}
+
+void *SDL_AllocateTemporaryMemory(size_t size)
+{
+    SDL_TemporaryMemoryState *state;
+    SDL_TemporaryMemory *entry;
 
     state = SDL_GetTemporaryMemoryState(true);
     if (!state) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed.
+        return NULL;
     }
 
-    SDL_TemporaryMemory *entry = (SDL_TemporaryMemory *)SDL_malloc(sizeof(*entry));
+    entry = SDL_AllocateTemporaryMemoryEntry(state, size);
     if (!entry) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed. We could probably pool up and reuse entries, though.
+        return NULL;
     }
-
-    entry->memory = memory;
-
     SDL_LinkTemporaryMemoryEntry(state, entry);
 
-    return memory;
-}
-
-void *SDL_AllocateTemporaryMemory(size_t size)
-{
-    return SDL_FreeLater(SDL_malloc(size));
+    return SDL_TemporaryMemoryData(entry);
 }
 
 const char *SDL_CreateTemporaryString(const char *string)
 {
     if (string) {
-        return (const char *)SDL_FreeLater(SDL_strdup(string));
+        const size_t length = SDL_strlen(string) + 1;
+        char *copy = (char *)SDL_AllocateTemporaryMemory(length);
+        if (copy) {
+            SDL_memcpy(copy, string, length);
+        }
+        return copy;
     }
     return NULL;
 }
 
+// Temporary memory doesn't come straight from SDL_malloc(), so the caller gets a copy that does
 void *SDL_ClaimTemporaryMemory(const void *mem)
 {
     SDL_TemporaryMemoryState *state;
@@ -366,9 +489,13 @@ void *SDL_ClaimTemporaryMemory(const void *mem)
     if (state && mem) {
         SDL_TemporaryMemory *entry = SDL_GetTemporaryMemoryEntry(state, mem);
         if (entry) {
-            SDL_UnlinkTemporaryMemoryEntry(state, entry);
-            SDL_FreeTemporaryMemoryEntry(state, entry, false);
-            return (void *)mem;
+            void *copy = SDL_malloc(entry->size);
+            if (copy) {
+                SDL_memcpy(copy, mem, entry->size);
+                SDL_UnlinkTemporaryMemoryEntry(state, entry);
+                SDL_FreeTemporaryMemoryEntry(entry);
+            }
+            return copy;
         }
     }
     return NULL;
@@ -377,18 +504,19 @@ void *SDL_ClaimTemporaryMemory(const void *mem)
 void SDL_FreeTemporaryMemory(void)
 {
     SDL_TemporaryMemoryState *state;
+    SDL_TemporaryMemory *entry, *next;
 
     state = SDL_GetTemporaryMemoryState(false);
     if (!state) {
         return;
     }
 
-    while (state->head) {
-        SDL_TemporaryMemory *entry = state->head;
-
-        SDL_UnlinkTemporaryMemoryEntry(state, entry);
-        SDL_FreeTemporaryMemoryEntry(state, entry, true);
+    for (entry = state->head; entry; entry = next) {
+        next = entry->next;
+        SDL_FreeTemporaryMemoryEntry(entry);
     }
+    state->head = NULL;
+    state->tail = NULL;
 }
 
 #ifndef SDL_JOYSTICK_DISABLED
@@ -926,10 +1054,18 @@ void SDL_StopEventLoop(void)
 
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d",
-                SDL_EventQ.max_events_seen);
+                SDL_GetAtomicInt(&SDL_EventQ.max_events_seen));
     }
 
-    // Clean out EventQ
+    // Clean out EventQ, once no producer can still be writing to the ring
+    SDL_EventRing *ring = (SDL_EventRing *)SDL_SetAtomicPointer((void **)&SDL_EventQ.ring, NULL);
+    if (ring) {
+        while (SDL_GetAtomicInt(&SDL_EventQ.ring_users) > 0) {
+            SDL_CPUPauseInstruction();
+        }
+        SDL_MoveEventRingToList(ring);
+        SDL_free(ring);
+    }
     for (entry = SDL_EventQ.head; entry;) {
         SDL_EventEntry *next = entry->next;
         SDL_TransferTemporaryMemoryFromEvent(entry);
@@ -943,7 +1079,7 @@ void SDL_StopEventLoop(void)
     }
 
     SDL_SetAtomicInt(&SDL_EventQ.count, 0);
-    SDL_EventQ.max_events_seen = 0;
+    SDL_SetAtomicInt(&SDL_EventQ.max_events_seen, 0);
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
@@ -998,6 +1134,16 @@ bool SDL_StartEventLoop(void)
 
     SDL_InitWindowEventWatch();
 
+    if (!SDL_EventQ.ring && SDL_GetHintBoolean(SDL_HINT_EVENT_QUEUE_LOCKFREE, false)) {
+        SDL_EventRing *ring = (SDL_EventRing *)SDL_calloc(1, sizeof(*ring));
+        if (ring) {
+            for (Uint32 i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+                SDL_SetAtomicU32(&ring->slots[i].sequence, i);
+            }
+            SDL_SetAtomicPointer((void **)&SDL_EventQ.ring, ring);
+        }
+    }
+
     SDL_EventQ.active = true;
 
 #ifndef SDL_THREADS_DISABLED
@@ -1006,6 +1152,172 @@ bool SDL_StartEventLoop(void)
     return true;
 }
 
+static void SDL_UpdateMaxEventsSeen(int count)
+{
+    int max_events_seen = SDL_GetAtomicInt(&SDL_EventQ.max_events_seen);
+    while (count > max_events_seen) {
+        if (SDL_CompareAndSwapAtomicInt(&SDL_EventQ.max_events_seen, max_events_seen, count)) {
+            break;
+        }
+        max_events_seen = SDL_GetAtomicInt(&SDL_EventQ.max_events_seen);
+    }
+}
+
+// Get an unused list entry -- called with the queue locked
+static SDL_EventEntry *SDL_AllocEventEntry(void)
+{
+    SDL_EventEntry *entry;
+
+    if (SDL_EventQ.free == NULL) {
+        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
+    } else {
+        entry = SDL_EventQ.free;
+        SDL_EventQ.free = entry->next;
+    }
+    return entry;
+}
+
+// Put an entry at the end of the list -- called with the queue locked
+static void SDL_LinkEventEntry(SDL_EventEntry *entry)
+{
+    if (SDL_EventQ.tail) {
+        SDL_EventQ.tail->next = entry;
+        entry->prev = SDL_EventQ.tail;
+        SDL_EventQ.tail = entry;
+        entry->next = NULL;
+    } else {
+        SDL_assert(!SDL_EventQ.head);
+        SDL_EventQ.head = entry;
+        SDL_EventQ.tail = entry;
+        entry->prev = NULL;
+        entry->next = NULL;
+    }
+}
+
+// Try to add an event to the lock-free ring, returns false if it has to go through the list instead
+static bool SDL_AddEventToRing(SDL_EventRing *ring, const SDL_Event *event)
+{
+    SDL_EventRingSlot *slot;
+    Uint32 pos;
+
+    // Events that carry temporary memory need an entry to hold it until they're read
+    if (SDL_TransferTemporaryMemoryToEvent(event, NULL)) {
+        return false;
+    }
+
+    // Count the event before publishing it, so the consumer never sees the count go negative
+    const int final_count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1;
+    if (final_count > SDL_MAX_QUEUED_EVENTS) {
+        SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        return false;  // let SDL_AddEvent() report the error
+    }
+    if (event->type == SDL_EVENT_POLL_SENTINEL) {
+        SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
+    }
+
+    pos = SDL_GetAtomicU32(&ring->tail);
+    for (;;) {
+        slot = &ring->slots[pos & (SDL_EVENT_RING_SIZE - 1)];
+        const Sint32 diff = (Sint32)(SDL_GetAtomicU32(&slot->sequence) - pos);
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicU32(&ring->tail, pos, pos + 1)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The ring is full
+            if (event->type == SDL_EVENT_POLL_SENTINEL) {
+                SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
+            }
+            SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+            return false;
+        }
+        pos = SDL_GetAtomicU32(&ring->tail);
+    }
+
+    SDL_copyp(&slot->event, event);
+    SDL_SetAtomicU32(&slot->sequence, pos + 1);
+
+    SDL_UpdateMaxEventsSeen(final_count);
+
+    if (SDL_EventLoggingVerbosity > 0) {
+        SDL_LogEvent(event);
+    }
+    return true;
+}
+
+// Get the oldest event in the ring, if it has been published -- called with the queue locked
+static SDL_EventRingSlot *SDL_PeekEventRing(SDL_EventRing *ring)
+{
+    SDL_EventRingSlot *slot = &ring->slots[ring->head & (SDL_EVENT_RING_SIZE - 1)];
+    if (SDL_GetAtomicU32(&slot->sequence) != ring->head + 1) {
+        return NULL;
+    }
+    return slot;
+}
+
+// Hand the oldest slot back to the producers -- called with the queue locked
+static void SDL_ReleaseEventRingSlot(SDL_EventRing *ring, SDL_EventRingSlot *slot)
+{
+    SDL_SetAtomicU32(&slot->sequence, ring->head + SDL_EVENT_RING_SIZE);
+    ++ring->head;
+}
+
+// Get the ring for a producer, which must call SDL_ReleaseEventRing() once it's done with it
+static SDL_EventRing *SDL_AcquireEventRing(void)
+{
+    if (!SDL_GetAtomicPointer((void **)&SDL_EventQ.ring)) {
+        return NULL;
+    }
+
+    // Count ourselves before loading the pointer again, so SDL_StopEventLoop() either sees us or we see NULL
+    SDL_AddAtomicInt(&SDL_EventQ.ring_users, 1);
+    SDL_EventRing *ring = (SDL_EventRing *)SDL_GetAtomicPointer((void **)&SDL_EventQ.ring);
+    if (!ring) {
+        SDL_AddAtomicInt(&SDL_EventQ.ring_users, -1);
+    }
+    return ring;
+}
+
+static void SDL_ReleaseEventRing(void)
+{
+    SDL_AddAtomicInt(&SDL_EventQ.ring_users, -1);
+}
+
+// Move everything in the ring to the end of the list -- called with the queue locked
+static void SDL_MoveEventRingToList(SDL_EventRing *ring)
+{
+    const Uint32 tail = SDL_GetAtomicU32(&ring->tail);
+    while (ring->head != tail) {
+        SDL_EventRingSlot *slot;
+
+        // A producer may have claimed this slot and not finished filling it in yet
+        while ((slot = SDL_PeekEventRing(ring)) == NULL) {
+            SDL_CPUPauseInstruction();
+        }
+
+        SDL_EventEntry *entry = SDL_AllocEventEntry();
+        if (entry) {
+            SDL_copyp(&entry->event, &slot->event);
+            entry->memory = NULL;
+            SDL_LinkEventEntry(entry);
+        } else {
+            // We're out of memory, the event is lost
+            if (slot->event.type == SDL_EVENT_POLL_SENTINEL) {
+                SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
+            }
+            SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        }
+        SDL_ReleaseEventRingSlot(ring, slot);
+    }
+}
+
+static void SDL_DrainEventRing(void)
+{
+    if (SDL_EventQ.ring) {
+        SDL_MoveEventRingToList(SDL_EventQ.ring);
+    }
+}
+
 // Add an event to the event queue -- called with the queue locked
 static int SDL_AddEvent(SDL_Event *event)
 {
@@ -1018,14 +1330,12 @@ static int SDL_AddEvent(SDL_Event *event)
         return 0;
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (entry == NULL) {
-            return 0;
-        }
-    } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
+    // Anything already in the ring was pushed before this event
+    SDL_DrainEventRing();
+
+    entry = SDL_AllocEventEntry();
+    if (entry == NULL) {
+        return 0;
     }
 
     if (SDL_EventLoggingVerbosity > 0) {
@@ -1037,25 +1347,12 @@ static int SDL_AddEvent(SDL_Event *event)
         SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
     }
     entry->memory = NULL;
-    SDL_TransferTemporaryMemoryToEvent(entry);
+    SDL_TransferTemporaryMemoryToEvent(&entry->event, entry);
 
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
-    }
+    SDL_LinkEventEntry(entry);
 
     final_count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
-    }
+    SDL_UpdateMaxEventsSeen(final_count);
 
     ++SDL_last_event_id;
 
@@ -1111,6 +1408,36 @@ static void SDL_SendWakeupEvent(void)
 #endif
 }
 
+// Take events off the front of the ring while they match -- called with the queue locked
+static int SDL_GetEventsFromRing(SDL_EventRing *ring, SDL_Event *events, int numevents,
+                                 Uint32 minType, Uint32 maxType, bool include_sentinel)
+{
+    SDL_EventRingSlot *slot;
+    int used = 0;
+
+    while (used < numevents && (slot = SDL_PeekEventRing(ring)) != NULL) {
+        const Uint32 type = slot->event.type;
+        if (type < minType || maxType < type) {
+            break;
+        }
+        SDL_copyp(&events[used], &slot->event);
+        if (type == SDL_EVENT_POLL_SENTINEL) {
+            SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
+        }
+        SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        SDL_ReleaseEventRingSlot(ring, slot);
+
+        if (type == SDL_EVENT_POLL_SENTINEL) {
+            // Same handling as SDL_PeepEventsInternal()
+            if (!include_sentinel || SDL_GetAtomicInt(&SDL_sentinel_pending) > 0) {
+                continue;
+            }
+        }
+        ++used;
+    }
+    return used;
+}
+
 // Lock the event queue, take a peep at it, and unlock it
 static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAction action,
                                   Uint32 minType, Uint32 maxType, bool include_sentinel)
@@ -1120,6 +1447,23 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
     // Lock the event queue
     used = 0;
 
+    if (action == SDL_ADDEVENT && events) {
+        // Try to add the events without taking the lock at all
+        SDL_EventRing *ring = SDL_AcquireEventRing();
+        if (ring) {
+            while (used < numevents && SDL_AddEventToRing(ring, &events[used])) {
+                ++used;
+            }
+            SDL_ReleaseEventRing();
+            if (used == numevents) {
+                if (used > 0) {
+                    SDL_SendWakeupEvent();
+                }
+                return used;
+            }
+        }
+    }
+
     SDL_LockMutex(SDL_EventQ.lock);
     {
         // Don't look after we've quit
@@ -1136,40 +1480,63 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
                 SDL_UnlockMutex(SDL_EventQ.lock);
                 return SDL_InvalidParamError("events");
             }
-            for (i = 0; i < numevents; ++i) {
+            for (i = used; i < numevents; ++i) {
                 used += SDL_AddEvent(&events[i]);
             }
         } else {
             SDL_EventEntry *entry, *next;
             Uint32 type;
 
-            for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
-                next = entry->next;
-                type = entry->event.type;
-                if (minType <= type && type <= maxType) {
-                    if (events) {
-                        SDL_copyp(&events[used], &entry->event);
+            bool from_ring = (SDL_EventQ.ring && events && action == SDL_GETEVENT);
 
-                        if (action == SDL_GETEVENT) {
-                            SDL_CutEvent(entry);
-                        }
-                    }
-                    if (type == SDL_EVENT_POLL_SENTINEL) {
-                        // Special handling for the sentinel event
-                        if (!include_sentinel) {
-                            // Skip it, we don't want to include it
-                            continue;
-                        }
-                        if (events == NULL || action != SDL_GETEVENT) {
-                            ++sentinels_expected;
+            if (!from_ring) {
+                // Peeking and counting have to see the whole queue in order
+                SDL_DrainEventRing();
+            }
+
+            for (;;) {
+                for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
+                    next = entry->next;
+                    type = entry->event.type;
+                    if (minType <= type && type <= maxType) {
+                        if (events) {
+                            SDL_copyp(&events[used], &entry->event);
+
+                            if (action == SDL_GETEVENT) {
+                                SDL_CutEvent(entry);
+                            }
                         }
-                        if (SDL_GetAtomicInt(&SDL_sentinel_pending) > sentinels_expected) {
-                            // Skip it, there's another one pending
-                            continue;
+                        if (type == SDL_EVENT_POLL_SENTINEL) {
+                            // Special handling for the sentinel event
+                            if (!include_sentinel) {
+                                // Skip it, we don't want to include it
+                                continue;
+                            }
+                            if (events == NULL || action != SDL_GETEVENT) {
+                                ++sentinels_expected;
+                            }
+                            if (SDL_GetAtomicInt(&SDL_sentinel_pending) > sentinels_expected) {
+                                // Skip it, there's another one pending
+                                continue;
+                            }
                         }
+                        ++used;
                     }
-                    ++used;
                 }
+
+                if (!from_ring || used == numevents) {
+                    break;
+                }
+
+                // Everything that matched in the list is gone, so the ring is next in line
+                used += SDL_GetEventsFromRing(SDL_EventQ.ring, &events[used], numevents - used, minType, maxType, include_sentinel);
+                if (used == numevents || SDL_EventQ.ring->head == SDL_GetAtomicU32(&SDL_EventQ.ring->tail)) {
+                    break;
+                }
+
+                // There's an event in the way that we need to skip over, do it the slow way
+                SDL_DrainEventRing();
+                from_ring = false;
             }
         }
     }
@@ -1199,6 +1566,7 @@ bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         if (SDL_EventQ.active) {
+            SDL_DrainEventRing();
             for (SDL_EventEntry *entry = SDL_EventQ.head; entry; entry = entry->next) {
                 const Uint32 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
@@ -1239,6 +1607,7 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -1760,6 +2129,37 @@ bool SDL_PushEvent(SDL_Event *event)
     return true;
 }
 
+int SDL_PushEvents(SDL_Event *events, int numevents)
+{
+    if (!events) {
+        SDL_InvalidParamError("events");
+        return -1;
+    }
+    if (numevents <= 0) {
+        return 0;
+    }
+
+    // One clock read covers the whole batch
+    Uint64 now = 0;
+    for (int i = 0; i < numevents; ++i) {
+        if (!events[i].common.timestamp) {
+            if (!now) {
+                now = SDL_GetTicksNS();
+            }
+            events[i].common.timestamp = now;
+        }
+    }
+
+    // Run the filter and watchers over everything at once, dropping what the filter rejects
+    numevents = SDL_DispatchEventWatchListBatch(&SDL_event_watchers, events, numevents);
+    if (numevents == 0) {
+        SDL_ClearError();
+        return 0;
+    }
+
+    return SDL_PeepEvents(events, numevents, SDL_ADDEVENT, 0, 0);
+}
+
 void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
 {
     SDL_EventEntry *event, *next;
@@ -1772,6 +2172,7 @@ void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
             // Cut all events not accepted by the filter
             SDL_LockMutex(SDL_EventQ.lock);
             {
+                SDL_DrainEventRing();
                 for (event = SDL_EventQ.head; event; event = next) {
                     next = event->next;
                     if (!filter(userdata, &event->event)) {
@@ -1819,6 +2220,7 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -48,6 +48,22 @@ void SDL_QuitEventWatchList(SDL_EventWatchList *list)
     SDL_zero(list->filter);
 }
 
+// Drop watchers that were removed while we were dispatching -- called with the list locked
+static void SDL_CompactEventWatchList(SDL_EventWatchList *list)
+{
+    if (list->removed) {
+        for (int i = list->count; i--;) {
+            if (list->watchers[i].removed) {
+                --list->count;
+                if (i < list->count) {
+                    SDL_memmove(&list->watchers[i], &list->watchers[i + 1], (list->count - i) * sizeof(list->watchers[i]));
+                }
+            }
+        }
+        list->removed = false;
+    }
+}
+
 bool SDL_DispatchEventWatchList(SDL_EventWatchList *list, SDL_Event *event)
 {
     SDL_EventWatcher *filter = &list->filter;
@@ -74,21 +90,56 @@ bool SDL_DispatchEventWatchList(SDL_EventWatchList *list, SDL_Event *event)
         }
         list->dispatching = false;
 
-        if (list->removed) {
-            for (i = list->count; i--;) {
-                if (list->watchers[i].removed) {
-                    --list->count;
-                    if (i < list->count) {
-                        SDL_memmove(&list->watchers[i], &list->watchers[i + 1], (list->count - i) * sizeof(list->watchers[i]));
+        SDL_CompactEventWatchList(list);
+    }
+    SDL_UnlockMutex(list->lock);
+
+    return true;
+}
+
+int SDL_DispatchEventWatchListBatch(SDL_EventWatchList *list, SDL_Event *events, int numevents)
+{
+    SDL_EventWatcher *filter = &list->filter;
+    int kept = 0;
+
+    if (!filter->callback && list->count == 0) {
+        return numevents;
+    }
+
+    SDL_LockMutex(list->lock);
+    {
+        // Make sure we only dispatch the current watcher list
+        int i, count = list->count;
+
+        list->dispatching = true;
+        for (int e = 0; e < numevents; ++e) {
+            SDL_Event *event = &events[e];
+
+            // The poll sentinel is internal, it's queued without being filtered or watched, like SDL_PushEvent() does
+            if (event->common.type != SDL_EVENT_POLL_SENTINEL) {
+                if (filter->callback && !filter->callback(filter->userdata, event)) {
+                    continue;
+                }
+
+                for (i = 0; i < count; ++i) {
+                    if (!list->watchers[i].removed) {
+                        list->watchers[i].callback(list->watchers[i].userdata, event);
                     }
                 }
             }
-            list->removed = false;
+
+            if (kept != e) {
+                SDL_copyp(&events[kept], event);
+            }
+            ++kept;
         }
+        list->dispatching = false;
+
+        SDL_CompactEventWatchList(list);
     }
     SDL_UnlockMutex(list->lock);
 
-    return true;
+    return kept;
 }
 
 bool SDL_AddEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata)
@@ -41,5 +41,6 @@ typedef struct SDL_EventWatchList
 extern bool SDL_InitEventWatchList(SDL_EventWatchList *list);
 extern void SDL_QuitEventWatchList(SDL_EventWatchList *list);
 extern bool SDL_DispatchEventWatchList(SDL_EventWatchList *list, SDL_Event *event);
+extern int SDL_DispatchEventWatchListBatch(SDL_EventWatchList *list, SDL_Event *events, int numevents);
 extern bool SDL_AddEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata);
 extern void SDL_RemoveEventWatchList(SDL_EventWatchList *list, SDL_EventFilter filter, void *userdata);
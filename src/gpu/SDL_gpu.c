@@ -774,6 +774,20 @@ SDL_PropertiesID SDL_GetGPUDeviceProperties(SDL_GPUDevice *device)
     return device->GetDeviceProperties(device);
 }
 
+void *SDL_GetGPUPipelineCacheData(SDL_GPUDevice *device, size_t *size)
+{
+    size_t unused;
+
+    if (!size) {
+        size = &unused;
+    }
+    *size = 0;
+
+    CHECK_DEVICE_MAGIC(device, NULL);
+
+    return device->GetPipelineCacheData(device->driverData, size);
+}
+
 Uint32 SDL_GPUTextureFormatTexelBlockSize(
     SDL_GPUTextureFormat format)
 {
@@ -671,6 +671,10 @@ struct SDL_GPUDevice
 
     SDL_PropertiesID (*GetDeviceProperties)(SDL_GPUDevice *device);
 
+    void *(*GetPipelineCacheData)(
+        SDL_GPURenderer *driverData,
+        size_t *size);
+
     // State Creation
 
     SDL_GPUComputePipeline *(*CreateComputePipeline)(
@@ -1103,6 +1107,7 @@ struct SDL_GPUDevice
 #define ASSIGN_DRIVER(name)                                 \
     ASSIGN_DRIVER_FUNC(DestroyDevice, name)                 \
     ASSIGN_DRIVER_FUNC(GetDeviceProperties, name)      \
+    ASSIGN_DRIVER_FUNC(GetPipelineCacheData, name)          \
     ASSIGN_DRIVER_FUNC(CreateComputePipeline, name)         \
     ASSIGN_DRIVER_FUNC(CreateGraphicsPipeline, name)        \
     ASSIGN_DRIVER_FUNC(CreateSampler, name)                 \
@@ -1740,6 +1740,14 @@ static SDL_PropertiesID D3D12_GetDeviceProperties(SDL_GPUDevice *device)
     return renderer->props;
 }
 
+static void *D3D12_GetPipelineCacheData(SDL_GPURenderer *driverData, size_t *size)
+{
+    (void)driverData;
+    *size = 0;
+    SDL_Unsupported();
+    return NULL;
+}
+
 // Barriers
 
 static inline Uint32 D3D12_INTERNAL_CalcSubresource(
@@ -768,6 +768,14 @@ static SDL_PropertiesID METAL_GetDeviceProperties(SDL_GPUDevice *device)
     return renderer->props;
 }
 
+static void *METAL_GetPipelineCacheData(SDL_GPURenderer *driverData, size_t *size)
+{
+    (void)driverData;
+    *size = 0;
+    SDL_Unsupported();
+    return NULL;
+}
+
 // Resource tracking
 
 static void METAL_INTERNAL_TrackBuffer(
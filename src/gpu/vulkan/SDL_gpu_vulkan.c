@@ -1093,6 +1093,29 @@ struct VulkanCommandPool
     Uint32 inactiveCommandBufferCount;
 };
 
+// Pipeline cache
+
+/* Written in front of the driver's pipeline cache data, so a cache saved on a
+ * different device or driver, or one that got corrupted on disk, is thrown
+ * away instead of being handed to the driver.
+ */
+#define PIPELINE_CACHE_MAGIC   0x43504C53 // "SLPC"
+#define PIPELINE_CACHE_VERSION 1
+
+typedef struct VulkanPipelineCacheHeader
+{
+    Uint32 magic;
+    Uint32 version;
+    Uint32 vendorID;
+    Uint32 deviceID;
+    Uint32 driverVersion;
+    Uint32 driverID; // 0 without VK_KHR_driver_properties
+    Uint8 pipelineCacheUUID[VK_UUID_SIZE];
+    Uint64 dataSize;
+    Uint32 dataChecksum;
+    Uint32 padding;
+} VulkanPipelineCacheHeader;
+
 // Context
 
 struct VulkanRenderer
@@ -1137,6 +1160,8 @@ struct VulkanRenderer
 
     VulkanFencePool fencePool;
 
+    VkPipelineCache pipelineCache;
+
     SDL_HashTable *commandPoolHashTable;
     SDL_HashTable *renderPassHashTable;
     SDL_HashTable *framebufferHashTable;
@@ -4970,6 +4995,11 @@ static void VULKAN_DestroyDevice(
     SDL_DestroyMutex(renderer->descriptorSetLayoutFetchLock);
     SDL_DestroyMutex(renderer->windowLock);
 
+    renderer->vkDestroyPipelineCache(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        NULL);
+
     renderer->vkDestroyDevice(renderer->logicalDevice, NULL);
     renderer->vkDestroyInstance(renderer->instance, NULL);
 
@@ -4987,6 +5017,134 @@ static SDL_PropertiesID VULKAN_GetDeviceProperties(
     return renderer->props;
 }
 
+static void VULKAN_INTERNAL_FillPipelineCacheHeader(
+    VulkanRenderer *renderer,
+    VulkanPipelineCacheHeader *header)
+{
+    SDL_zerop(header);
+    header->magic = PIPELINE_CACHE_MAGIC;
+    header->version = PIPELINE_CACHE_VERSION;
+    header->vendorID = renderer->physicalDeviceProperties.properties.vendorID;
+    header->deviceID = renderer->physicalDeviceProperties.properties.deviceID;
+    header->driverVersion = renderer->physicalDeviceProperties.properties.driverVersion;
+    if (renderer->supports.KHR_driver_properties) {
+        header->driverID = (Uint32)renderer->physicalDeviceDriverProperties.driverID;
+    }
+    SDL_memcpy(
+        header->pipelineCacheUUID,
+        renderer->physicalDeviceProperties.properties.pipelineCacheUUID,
+        VK_UUID_SIZE);
+}
+
+static bool VULKAN_INTERNAL_CreatePipelineCache(
+    VulkanRenderer *renderer,
+    const void *data,
+    size_t size,
+    bool verboseLogs)
+{
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo;
+    VulkanPipelineCacheHeader expected;
+    VulkanPipelineCacheHeader header;
+    VkResult vulkanResult;
+
+    pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.pNext = NULL;
+    pipelineCacheCreateInfo.flags = 0;
+    pipelineCacheCreateInfo.initialDataSize = 0;
+    pipelineCacheCreateInfo.pInitialData = NULL;
+
+    if (data && size > 0) {
+        VULKAN_INTERNAL_FillPipelineCacheHeader(renderer, &expected);
+        if (size >= sizeof(header)) {
+            SDL_memcpy(&header, data, sizeof(header));
+            expected.dataSize = header.dataSize;
+            expected.dataChecksum = header.dataChecksum;
+        }
+
+        if (size < sizeof(header) || SDL_memcmp(&header, &expected, sizeof(header)) != 0) {
+            if (verboseLogs) {
+                SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "Vulkan pipeline cache was saved on a different device or driver, ignoring it");
+            }
+        } else if (header.dataSize != size - sizeof(header) ||
+                   header.dataChecksum != SDL_crc32(0, (const Uint8 *)data + sizeof(header), (size_t)header.dataSize)) {
+            if (verboseLogs) {
+                SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "Vulkan pipeline cache is truncated or corrupt, ignoring it");
+            }
+        } else {
+            pipelineCacheCreateInfo.initialDataSize = (size_t)header.dataSize;
+            pipelineCacheCreateInfo.pInitialData = (const Uint8 *)data + sizeof(header);
+        }
+    }
+
+    vulkanResult = renderer->vkCreatePipelineCache(
+        renderer->logicalDevice,
+        &pipelineCacheCreateInfo,
+        NULL,
+        &renderer->pipelineCache);
+
+    if (vulkanResult != VK_SUCCESS && pipelineCacheCreateInfo.initialDataSize > 0) {
+        // The driver didn't like the data after all, start over empty
+        pipelineCacheCreateInfo.initialDataSize = 0;
+        pipelineCacheCreateInfo.pInitialData = NULL;
+        vulkanResult = renderer->vkCreatePipelineCache(
+            renderer->logicalDevice,
+            &pipelineCacheCreateInfo,
+            NULL,
+            &renderer->pipelineCache);
+    }
+
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreatePipelineCache, false);
+
+    if (verboseLogs && pipelineCacheCreateInfo.initialDataSize > 0) {
+        SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "Vulkan pipeline cache: loaded %u bytes", (unsigned int)pipelineCacheCreateInfo.initialDataSize);
+    }
+    return true;
+}
+
+static void *VULKAN_GetPipelineCacheData(
+    SDL_GPURenderer *driverData,
+    size_t *size)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanPipelineCacheHeader header;
+    size_t dataSize = 0;
+    Uint8 *result;
+    VkResult vulkanResult;
+
+    *size = 0;
+
+    vulkanResult = renderer->vkGetPipelineCacheData(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        &dataSize,
+        NULL);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetPipelineCacheData, NULL);
+
+    result = (Uint8 *)SDL_malloc(sizeof(header) + dataSize);
+    if (!result) {
+        return NULL;
+    }
+
+    // Other threads may have added pipelines since, in which case we get a bit less
+    vulkanResult = renderer->vkGetPipelineCacheData(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        &dataSize,
+        result + sizeof(header));
+    if (vulkanResult != VK_SUCCESS && vulkanResult != VK_INCOMPLETE) {
+        SDL_free(result);
+        CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetPipelineCacheData, NULL);
+    }
+
+    VULKAN_INTERNAL_FillPipelineCacheHeader(renderer, &header);
+    header.dataSize = dataSize;
+    header.dataChecksum = SDL_crc32(0, result + sizeof(header), dataSize);
+    SDL_memcpy(result, &header, sizeof(header));
+
+    *size = sizeof(header) + dataSize;
+    return result;
+}
+
 static DescriptorSetCache *VULKAN_INTERNAL_AcquireDescriptorSetCache(
     VulkanRenderer *renderer)
 {
@@ -6527,10 +6685,9 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
     vkPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
     vkPipelineCreateInfo.basePipelineIndex = 0;
 
-    // TODO: enable pipeline caching
     vulkanResult = renderer->vkCreateGraphicsPipelines(
         renderer->logicalDevice,
-        VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkPipelineCreateInfo,
         NULL,
@@ -6665,7 +6822,7 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
 
     vulkanResult = renderer->vkCreateComputePipelines(
         renderer->logicalDevice,
-        (VkPipelineCache)VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkShaderCreateInfo,
         NULL,
@@ -11913,6 +12070,19 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
         return NULL;
     }
 
+    if (!VULKAN_INTERNAL_CreatePipelineCache(
+            renderer,
+            SDL_GetPointerProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_POINTER, NULL),
+            (size_t)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_SIZE_NUMBER, 0),
+            verboseLogs)) {
+        renderer->vkDestroyDevice(renderer->logicalDevice, NULL);
+        renderer->vkDestroyInstance(renderer->instance, NULL);
+        SDL_DestroyProperties(renderer->props);
+        SDL_free(renderer);
+        SDL_Vulkan_UnloadLibrary();
+        return NULL;
+    }
+
     // FIXME: just move this into this function
     result = (SDL_GPUDevice *)SDL_malloc(sizeof(SDL_GPUDevice));
     ASSIGN_DRIVER(VULKAN)
@@ -307,6 +307,176 @@ static SDL_INLINE void DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+// Settle a state command before the command that uses it, returns true if the state actually changes
+static bool SettleStateCommand(SDL_Renderer *renderer, SDL_RenderCommand **pending, SDL_RenderCommand **current)
+{
+    SDL_RenderCommand *cmd = *pending;
+    const SDL_RenderCommand *prev = *current;
+    bool same = false;
+
+    if (!cmd) {
+        return false;
+    }
+    *pending = NULL;
+
+    if (prev) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_SETVIEWPORT:
+            same = (SDL_memcmp(&cmd->data.viewport.rect, &prev->data.viewport.rect, sizeof(cmd->data.viewport.rect)) == 0);
+            break;
+        case SDL_RENDERCMD_SETCLIPRECT:
+            same = (cmd->data.cliprect.enabled == prev->data.cliprect.enabled &&
+                    SDL_memcmp(&cmd->data.cliprect.rect, &prev->data.cliprect.rect, sizeof(cmd->data.cliprect.rect)) == 0);
+            break;
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+            same = (cmd->data.color.color_scale == prev->data.color.color_scale &&
+                    cmd->data.color.color.r == prev->data.color.color.r &&
+                    cmd->data.color.color.g == prev->data.color.color.g &&
+                    cmd->data.color.color.b == prev->data.color.color.b &&
+                    cmd->data.color.color.a == prev->data.color.color.a);
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (same) {
+        cmd->command = SDL_RENDERCMD_NO_OP;
+        renderer->stats.dropped_state_commands++;
+        return false;
+    }
+    *current = cmd;
+    return true;
+}
+
+// Replace a state command that is overridden before anything uses it
+static void SupersedeStateCommand(SDL_Renderer *renderer, SDL_RenderCommand **pending, SDL_RenderCommand *cmd)
+{
+    if (*pending) {
+        (*pending)->command = SDL_RENDERCMD_NO_OP;
+        renderer->stats.dropped_state_commands++;
+    }
+    *pending = cmd;
+}
+
+static bool SameDrawState(const SDL_RenderCommand *prev, const SDL_RenderCommand *cmd)
+{
+    return cmd->data.draw.texture == prev->data.draw.texture &&
+           (!cmd->data.draw.texture || cmd->data.draw.texture_scale_mode == prev->data.draw.texture_scale_mode) &&
+           cmd->data.draw.texture_address_mode_u == prev->data.draw.texture_address_mode_u &&
+           cmd->data.draw.texture_address_mode_v == prev->data.draw.texture_address_mode_v &&
+           cmd->data.draw.blend == prev->data.draw.blend &&
+           cmd->data.draw.color_scale == prev->data.draw.color_scale &&
+           cmd->data.draw.gpu_render_state == prev->data.draw.gpu_render_state;
+}
+
+static bool CanMergeDrawCommands(const SDL_RenderCommand *prev, const SDL_RenderCommand *cmd)
+{
+    return cmd->command == prev->command &&
+           cmd->data.draw.first == prev->data.draw.vertex_end &&
+           SameDrawState(prev, cmd);
+}
+
+/* Join consecutive draws that the backend can run as one, and drop state commands
+ * that don't change anything, so each backend gets the shortest queue that draws
+ * the same pixels. Merged and dropped commands become SDL_RENDERCMD_NO_OP.
+ */
+static void MergeRenderCommands(SDL_Renderer *renderer)
+{
+    const Uint32 mergeable = renderer->mergeable_commands;
+    SDL_RenderCommand *pending_viewport = NULL;
+    SDL_RenderCommand *pending_cliprect = NULL;
+    SDL_RenderCommand *pending_color = NULL;
+    SDL_RenderCommand *viewport = NULL;
+    SDL_RenderCommand *cliprect = NULL;
+    SDL_RenderCommand *color = NULL;
+    SDL_RenderCommand *last_draw = NULL;
+    SDL_RenderCommand *cmd;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        bool state_changed = false;
+
+        switch (cmd->command) {
+        case SDL_RENDERCMD_NO_OP:
+            continue;
+
+        case SDL_RENDERCMD_SETVIEWPORT:
+            if (mergeable) {
+                SupersedeStateCommand(renderer, &pending_viewport, cmd);
+            }
+            continue;
+
+        case SDL_RENDERCMD_SETCLIPRECT:
+            if (mergeable) {
+                SupersedeStateCommand(renderer, &pending_cliprect, cmd);
+            }
+            continue;
+
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+            if (mergeable) {
+                SupersedeStateCommand(renderer, &pending_color, cmd);
+            }
+            continue;
+
+        case SDL_RENDERCMD_CLEAR:
+            break;
+
+        default:
+            renderer->stats.draw_commands++;
+            break;
+        }
+
+        if (!mergeable) {
+            continue;
+        }
+
+        // This command runs with whatever state is pending, see if any of it is new
+        state_changed |= SettleStateCommand(renderer, &pending_viewport, &viewport);
+        state_changed |= SettleStateCommand(renderer, &pending_cliprect, &cliprect);
+        state_changed |= SettleStateCommand(renderer, &pending_color, &color);
+
+        if (last_draw && !state_changed && CanMergeDrawCommands(last_draw, cmd)) {
+            last_draw->data.draw.count += cmd->data.draw.count;
+            last_draw->data.draw.vertex_end = cmd->data.draw.vertex_end;
+            cmd->command = SDL_RENDERCMD_NO_OP;
+            renderer->stats.merged_draw_commands++;
+        } else if (mergeable & (1u << cmd->command)) {
+            last_draw = cmd;
+        } else {
+            last_draw = NULL;
+        }
+    }
+}
+
+// Count the state changes left in the queue that the backend is about to run
+static void CountStateChanges(SDL_Renderer *renderer)
+{
+    const SDL_RenderCommand *last_draw = NULL;
+    const SDL_RenderCommand *cmd;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_NO_OP:
+        case SDL_RENDERCMD_CLEAR:
+            break;
+
+        case SDL_RENDERCMD_SETVIEWPORT:
+        case SDL_RENDERCMD_SETCLIPRECT:
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+            renderer->stats.state_changes++;
+            break;
+
+        default:
+            // Switching texture, blend mode, sampler or render state between draws
+            if (last_draw && !SameDrawState(last_draw, cmd)) {
+                renderer->stats.state_changes++;
+            }
+            last_draw = cmd;
+            break;
+        }
+    }
+}
+
 static bool FlushRenderCommands(SDL_Renderer *renderer)
 {
     bool result;
@@ -318,6 +488,9 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         return true;
     }
 
+    MergeRenderCommands(renderer);
+    CountStateChanges(renderer);
+
     DebugLogRenderCommands(renderer->render_commands);
 
     result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
@@ -342,6 +515,7 @@ static bool FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
     SDL_Renderer *renderer = texture->renderer;
     if (texture->last_command_generation == renderer->render_command_generation) {
         // the current command queue depends on this texture, flush the queue now before it changes
+        renderer->stats.forced_flushes++;
         return FlushRenderCommands(renderer);
     }
     return true;
@@ -352,6 +526,7 @@ static bool FlushRenderCommandsIfGPURenderStateNeeded(SDL_GPURenderState *state)
     SDL_Renderer *renderer = state->renderer;
     if (state->last_command_generation == renderer->render_command_generation) {
         // the current command queue depends on this state, flush the queue now before it changes
+        renderer->stats.forced_flushes++;
         return FlushRenderCommands(renderer);
     }
     return true;
@@ -396,6 +571,8 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
     }
 
     renderer->vertex_data_used += aligner + numbytes;
+    renderer->vertex_data_alignment = SDL_max(renderer->vertex_data_alignment, alignment);
+    renderer->stats.vertex_bytes += aligner + numbytes;
 
     return ((Uint8 *)renderer->vertex_data) + aligned;
 }
@@ -422,6 +599,7 @@ static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
         renderer->render_commands = result;
     }
     renderer->render_commands_tail = result;
+    renderer->stats.commands++;
 
     return result;
 }
@@ -604,7 +782,9 @@ static bool QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points,
     bool result = false;
     if (cmd) {
         result = renderer->QueueDrawPoints(renderer, cmd, points, count);
-        if (!result) {
+        if (result) {
+            cmd->data.draw.vertex_end = renderer->vertex_data_used;
+        } else {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
     }
@@ -680,7 +860,9 @@ static bool QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, co
                                                  num_vertices, indices, num_indices, size_indices,
                                                  1.0f, 1.0f);
 
-                if (!result) {
+                if (result) {
+                    cmd->data.draw.vertex_end = renderer->vertex_data_used;
+                } else {
                     cmd->command = SDL_RENDERCMD_NO_OP;
                 }
             }
@@ -689,7 +871,9 @@ static bool QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, co
 
         } else {
             result = renderer->QueueFillRects(renderer, cmd, rects, count);
-            if (!result) {
+            if (result) {
+                cmd->data.draw.vertex_end = renderer->vertex_data_used;
+            } else {
                 cmd->command = SDL_RENDERCMD_NO_OP;
             }
         }
@@ -745,7 +929,9 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
                                          color, color_stride, uv, uv_stride,
                                          num_vertices, indices, num_indices, size_indices,
                                          scale_x, scale_y);
-        if (!result) {
+        if (result) {
+            cmd->data.draw.vertex_end = renderer->vertex_data_used;
+        } else {
             cmd->command = SDL_RENDERCMD_NO_OP;
         }
     }
@@ -2181,6 +2367,7 @@ bool SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *p
         if (!FlushRenderCommandsIfTextureNeeded(texture)) {
             return false;
         }
+        renderer->stats.texture_uploads++;
         return renderer->UpdateTexture(renderer, texture, &real_rect, pixels, pitch);
     }
 }
@@ -2348,6 +2535,7 @@ bool SDL_UpdateYUVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (!FlushRenderCommandsIfTextureNeeded(texture)) {
                 return false;
             }
+            renderer->stats.texture_uploads++;
             return renderer->UpdateTextureYUV(renderer, texture, &real_rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
         } else {
             return SDL_Unsupported();
@@ -2408,6 +2596,7 @@ bool SDL_UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (!FlushRenderCommandsIfTextureNeeded(texture)) {
                 return false;
             }
+            renderer->stats.texture_uploads++;
             return renderer->UpdateTextureNV(renderer, texture, &real_rect, Yplane, Ypitch, UVplane, UVpitch);
         } else {
             return SDL_Unsupported();
@@ -2568,6 +2757,7 @@ void SDL_UnlockTexture(SDL_Texture *texture)
         SDL_UnlockTextureNative(texture);
     } else {
         SDL_Renderer *renderer = texture->renderer;
+        renderer->stats.texture_uploads++;
         renderer->UnlockTexture(renderer, texture);
     }
 
@@ -4216,6 +4406,265 @@ bool SDL_RenderTextureRotated(SDL_Renderer *renderer, SDL_Texture *texture,
     return result;
 }
 
+static bool GetBatchSourceRect(const SDL_Texture *texture, const SDL_FRect *srcrects, int index, SDL_FRect *srcrect)
+{
+    srcrect->x = 0.0f;
+    srcrect->y = 0.0f;
+    srcrect->w = (float)texture->w;
+    srcrect->h = (float)texture->h;
+    if (srcrects) {
+        return SDL_GetRectIntersectionFloat(&srcrects[index], srcrect, srcrect);
+    }
+    return true;
+}
+
+// Renderers with their own copy commands get one copy per sprite, the way SDL_RenderTextureRotated() would queue them
+static bool SDL_RenderTextureBatchCopy(SDL_Renderer *renderer, SDL_Texture *texture,
+                                       const SDL_FRect *srcrects, const SDL_FRect *dstrects,
+                                       const SDL_FColor *colors, const double *angles,
+                                       const SDL_FlipMode *flips, int count)
+{
+    const SDL_RenderViewState *view = renderer->view;
+    const float scale_x = view->current_scale.x;
+    const float scale_y = view->current_scale.y;
+    const SDL_FColor texture_color = texture->color;
+    bool result = true;
+    int i;
+
+    for (i = 0; i < count && result; ++i) {
+        const SDL_FRect *dstrect = &dstrects[i];
+        const double angle = angles ? angles[i] : 0.0;
+        const SDL_FlipMode flip = flips ? flips[i] : SDL_FLIP_NONE;
+        SDL_FRect srcrect;
+
+        if (!GetBatchSourceRect(texture, srcrects, i, &srcrect)) {
+            continue;
+        }
+
+        // The copy commands pick up their color from the texture
+        if (colors) {
+            texture->color.r = texture_color.r * colors[i].r;
+            texture->color.g = texture_color.g * colors[i].g;
+            texture->color.b = texture_color.b * colors[i].b;
+            texture->color.a = texture_color.a * colors[i].a;
+        }
+
+        if (flip == SDL_FLIP_NONE && (int)(angle / 360) == angle / 360) {
+            const SDL_FRect rect = { dstrect->x * scale_x, dstrect->y * scale_y, dstrect->w * scale_x, dstrect->h * scale_y };
+            result = QueueCmdCopy(renderer, texture, &srcrect, &rect);
+        } else {
+            const SDL_FPoint center = { dstrect->w / 2.0f, dstrect->h / 2.0f };
+            result = QueueCmdCopyEx(renderer, texture, &srcrect, dstrect, angle, &center, flip, scale_x, scale_y);
+        }
+    }
+
+    texture->color = texture_color;
+    return result;
+}
+
+// Everything else gets the sprites in geometry commands of up to this many, which keeps the vertex and index counts well inside an int
+#define SDL_RENDER_BATCH_MAX_GEOMETRY_SPRITES 16384
+
+static bool SDL_RenderTextureBatchGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
+                                           const SDL_FRect *srcrects, const SDL_FRect *dstrects,
+                                           const SDL_FColor *colors, const double *angles,
+                                           const SDL_FlipMode *flips, int count)
+{
+    const SDL_RenderViewState *view = renderer->view;
+    const float scale_x = view->current_scale.x;
+    const float scale_y = view->current_scale.y;
+    bool xy_isstack, uv_isstack, color_isstack = false, indices_isstack;
+    float *xy = SDL_small_alloc(float, count * 8, &xy_isstack);
+    float *uv = SDL_small_alloc(float, count * 8, &uv_isstack);
+    SDL_FColor *vertex_colors = colors ? SDL_small_alloc(SDL_FColor, count * 4, &color_isstack) : NULL;
+    int *indices = SDL_small_alloc(int, count * 6, &indices_isstack);
+    int num_sprites = 0;
+    bool result = false;
+    int i, j;
+
+    if (!xy || !uv || (colors && !vertex_colors) || !indices) {
+        goto done;
+    }
+
+    for (i = 0; i < count; ++i) {
+        const SDL_FRect *dstrect = &dstrects[i];
+        const SDL_FlipMode flip = flips ? flips[i] : SDL_FLIP_NONE;
+        float *sprite_xy = &xy[num_sprites * 8];
+        float *sprite_uv = &uv[num_sprites * 8];
+        int *sprite_indices = &indices[num_sprites * 6];
+        SDL_FRect srcrect;
+        float minu, minv, maxu, maxv;
+        float minx, miny, maxx, maxy;
+
+        if (!GetBatchSourceRect(texture, srcrects, i, &srcrect)) {
+            continue;
+        }
+
+        minu = srcrect.x / texture->w;
+        minv = srcrect.y / texture->h;
+        maxu = (srcrect.x + srcrect.w) / texture->w;
+        maxv = (srcrect.y + srcrect.h) / texture->h;
+
+        if (flip & SDL_FLIP_HORIZONTAL) {
+            minx = dstrect->x + dstrect->w;
+            maxx = dstrect->x;
+        } else {
+            minx = dstrect->x;
+            maxx = dstrect->x + dstrect->w;
+        }
+
+        if (flip & SDL_FLIP_VERTICAL) {
+            miny = dstrect->y + dstrect->h;
+            maxy = dstrect->y;
+        } else {
+            miny = dstrect->y;
+            maxy = dstrect->y + dstrect->h;
+        }
+
+        sprite_uv[0] = minu;
+        sprite_uv[1] = minv;
+        sprite_uv[2] = maxu;
+        sprite_uv[3] = minv;
+        sprite_uv[4] = maxu;
+        sprite_uv[5] = maxv;
+        sprite_uv[6] = minu;
+        sprite_uv[7] = maxv;
+
+        if (angles && (int)(angles[i] / 360) != angles[i] / 360) {
+            // Same rotation as SDL_RenderTextureRotated(), about the center of dstrect
+            const float radian_angle = (float)((SDL_PI_D * angles[i]) / 180.0);
+            const float s = SDL_sinf(radian_angle);
+            const float c = SDL_cosf(radian_angle);
+            const float centerx = dstrect->w / 2.0f + dstrect->x;
+            const float centery = dstrect->h / 2.0f + dstrect->y;
+            const float s_minx = s * (minx - centerx);
+            const float s_miny = s * (miny - centery);
+            const float s_maxx = s * (maxx - centerx);
+            const float s_maxy = s * (maxy - centery);
+            const float c_minx = c * (minx - centerx);
+            const float c_miny = c * (miny - centery);
+            const float c_maxx = c * (maxx - centerx);
+            const float c_maxy = c * (maxy - centery);
+
+            sprite_xy[0] = (c_minx - s_miny) + centerx;
+            sprite_xy[1] = (s_minx + c_miny) + centery;
+            sprite_xy[2] = (c_maxx - s_miny) + centerx;
+            sprite_xy[3] = (s_maxx + c_miny) + centery;
+            sprite_xy[4] = (c_maxx - s_maxy) + centerx;
+            sprite_xy[5] = (s_maxx + c_maxy) + centery;
+            sprite_xy[6] = (c_minx - s_maxy) + centerx;
+            sprite_xy[7] = (s_minx + c_maxy) + centery;
+        } else {
+            sprite_xy[0] = minx;
+            sprite_xy[1] = miny;
+            sprite_xy[2] = maxx;
+            sprite_xy[3] = miny;
+            sprite_xy[4] = maxx;
+            sprite_xy[5] = maxy;
+            sprite_xy[6] = minx;
+            sprite_xy[7] = maxy;
+        }
+
+        if (colors) {
+            SDL_FColor *sprite_colors = &vertex_colors[num_sprites * 4];
+            SDL_FColor color;
+
+            color.r = texture->color.r * colors[i].r;
+            color.g = texture->color.g * colors[i].g;
+            color.b = texture->color.b * colors[i].b;
+            color.a = texture->color.a * colors[i].a;
+            for (j = 0; j < 4; ++j) {
+                sprite_colors[j] = color;
+            }
+        }
+
+        for (j = 0; j < 6; ++j) {
+            sprite_indices[j] = num_sprites * 4 + rect_index_order[j];
+        }
+        ++num_sprites;
+    }
+
+    if (num_sprites == 0) {
+        result = true;
+    } else if (colors) {
+        result = QueueCmdGeometry(renderer, texture,
+                                  xy, 2 * sizeof(float), vertex_colors, sizeof(SDL_FColor), uv, 2 * sizeof(float),
+                                  num_sprites * 4, indices, num_sprites * 6, 4,
+                                  scale_x, scale_y, SDL_TEXTURE_ADDRESS_CLAMP, SDL_TEXTURE_ADDRESS_CLAMP);
+    } else {
+        result = QueueCmdGeometry(renderer, texture,
+                                  xy, 2 * sizeof(float), &texture->color, 0 /* color_stride */, uv, 2 * sizeof(float),
+                                  num_sprites * 4, indices, num_sprites * 6, 4,
+                                  scale_x, scale_y, SDL_TEXTURE_ADDRESS_CLAMP, SDL_TEXTURE_ADDRESS_CLAMP);
+    }
+
+done:
+    if (xy) {
+        SDL_small_free(xy, xy_isstack);
+    }
+    if (uv) {
+        SDL_small_free(uv, uv_isstack);
+    }
+    if (vertex_colors) {
+        SDL_small_free(vertex_colors, color_isstack);
+    }
+    if (indices) {
+        SDL_small_free(indices, indices_isstack);
+    }
+    return result;
+}
+
+bool SDL_RenderTextureBatch(SDL_Renderer *renderer, SDL_Texture *texture,
+                            const SDL_FRect *srcrects, const SDL_FRect *dstrects,
+                            const SDL_FColor *colors, const double *angles,
+                            const SDL_FlipMode *flips, int count)
+{
+    CHECK_RENDERER_MAGIC(renderer, false);
+    CHECK_TEXTURE_MAGIC(texture, false);
+
+    CHECK_PARAM(renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    CHECK_PARAM(!dstrects) {
+        return SDL_InvalidParamError("SDL_RenderTextureBatch(): dstrects");
+    }
+    if (!renderer->QueueCopyEx && !renderer->QueueGeometry) {
+        return SDL_SetError("Renderer does not support RenderCopyEx");
+    }
+
+    if (count < 1) {
+        return true;
+    }
+
+#if DONT_DRAW_WHILE_HIDDEN
+    // Don't draw while we're hidden
+    if (renderer->hidden) {
+        return true;
+    }
+#endif
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    texture->last_command_generation = renderer->render_command_generation;
+
+    if (renderer->QueueCopy && renderer->QueueCopyEx) {
+        return SDL_RenderTextureBatchCopy(renderer, texture, srcrects, dstrects, colors, angles, flips, count);
+    }
+
+    bool result = true;
+    for (int i = 0; i < count && result;) {
+        const int batch = SDL_min(count - i, SDL_RENDER_BATCH_MAX_GEOMETRY_SPRITES);
+        result = SDL_RenderTextureBatchGeometry(renderer, texture,
+                                                srcrects ? &srcrects[i] : NULL, &dstrects[i],
+                                                colors ? &colors[i] : NULL, angles ? &angles[i] : NULL,
+                                                flips ? &flips[i] : NULL, batch);
+        i += batch;
+    }
+    return result;
+}
+
 static bool SDL_RenderTextureTiled_Wrap(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, float scale, const SDL_FRect *dstrect)
 {
     float xy[8];
@@ -5072,6 +5521,68 @@ end:
 }
 #endif // SDL_VIDEO_RENDER_SW
 
+static void GetGeometryTextureAddressModes(SDL_Renderer *renderer, SDL_Texture *texture,
+                                           const float *uv, int uv_stride, int num_vertices,
+                                           SDL_TextureAddressMode *texture_address_mode_u,
+                                           SDL_TextureAddressMode *texture_address_mode_v)
+{
+    int i;
+
+    *texture_address_mode_u = renderer->texture_address_mode_u;
+    *texture_address_mode_v = renderer->texture_address_mode_v;
+    if (texture &&
+        (*texture_address_mode_u == SDL_TEXTURE_ADDRESS_AUTO ||
+         *texture_address_mode_v == SDL_TEXTURE_ADDRESS_AUTO)) {
+        for (i = 0; i < num_vertices; ++i) {
+            const float *uv_ = (const float *)((const char *)uv + i * uv_stride);
+            float u = uv_[0];
+            float v = uv_[1];
+            if (u < 0.0f || u > 1.0f) {
+                if (*texture_address_mode_u == SDL_TEXTURE_ADDRESS_AUTO) {
+                    *texture_address_mode_u = SDL_TEXTURE_ADDRESS_WRAP;
+                    if (*texture_address_mode_v != SDL_TEXTURE_ADDRESS_AUTO) {
+                        break;
+                    }
+                }
+            }
+            if (v < 0.0f || v > 1.0f) {
+                if (*texture_address_mode_v == SDL_TEXTURE_ADDRESS_AUTO) {
+                    *texture_address_mode_v = SDL_TEXTURE_ADDRESS_WRAP;
+                    if (*texture_address_mode_u != SDL_TEXTURE_ADDRESS_AUTO) {
+                        break;
+                    }
+                }
+            }
+        }
+        if (*texture_address_mode_u == SDL_TEXTURE_ADDRESS_AUTO) {
+            *texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
+        }
+        if (*texture_address_mode_v == SDL_TEXTURE_ADDRESS_AUTO) {
+            *texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
+        }
+    }
+}
+
+static bool CheckGeometryIndices(const void *indices, int num_indices, int size_indices, int num_vertices)
+{
+    int i;
+
+    for (i = 0; i < num_indices; ++i) {
+        int j;
+        if (size_indices == 4) {
+            j = ((const Uint32 *)indices)[i];
+        } else if (size_indices == 2) {
+            j = ((const Uint16 *)indices)[i];
+        } else {
+            j = ((const Uint8 *)indices)[i];
+        }
+        if (j < 0 || j >= num_vertices) {
+            return SDL_SetError("Values of 'indices' out of bounds");
+        }
+    }
+    return true;
+}
+
 bool SDL_RenderGeometryRaw(SDL_Renderer *renderer,
                           SDL_Texture *texture,
                           const float *xy, int xy_stride,
@@ -5080,7 +5591,6 @@ bool SDL_RenderGeometryRaw(SDL_Renderer *renderer,
                           int num_vertices,
                           const void *indices, int num_indices, int size_indices)
 {
-    int i;
     int count = indices ? num_indices : num_vertices;
     SDL_TextureAddressMode texture_address_mode_u;
     SDL_TextureAddressMode texture_address_mode_v;
@@ -5141,54 +5651,10 @@ bool SDL_RenderGeometryRaw(SDL_Renderer *renderer,
         texture = texture->native;
     }
 
-    texture_address_mode_u = renderer->texture_address_mode_u;
-    texture_address_mode_v = renderer->texture_address_mode_v;
-    if (texture &&
-        (texture_address_mode_u == SDL_TEXTURE_ADDRESS_AUTO ||
-         texture_address_mode_v == SDL_TEXTURE_ADDRESS_AUTO)) {
-        for (i = 0; i < num_vertices; ++i) {
-            const float *uv_ = (const float *)((const char *)uv + i * uv_stride);
-            float u = uv_[0];
-            float v = uv_[1];
-            if (u < 0.0f || u > 1.0f) {
-                if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_AUTO) {
-                    texture_address_mode_u = SDL_TEXTURE_ADDRESS_WRAP;
-                    if (texture_address_mode_v != SDL_TEXTURE_ADDRESS_AUTO) {
-                        break;
-                    }
-                }
-            }
-            if (v < 0.0f || v > 1.0f) {
-                if (texture_address_mode_v == SDL_TEXTURE_ADDRESS_AUTO) {
-                    texture_address_mode_v = SDL_TEXTURE_ADDRESS_WRAP;
-                    if (texture_address_mode_u != SDL_TEXTURE_ADDRESS_AUTO) {
-                        break;
-                    }
-                }
-            }
-        }
-        if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_AUTO) {
-            texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
-        }
-        if (texture_address_mode_v == SDL_TEXTURE_ADDRESS_AUTO) {
-            texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
-        }
-    }
+    GetGeometryTextureAddressModes(renderer, texture, uv, uv_stride, num_vertices, &texture_address_mode_u, &texture_address_mode_v);
 
-    if (indices) {
-        for (i = 0; i < num_indices; ++i) {
-            int j;
-            if (size_indices == 4) {
-                j = ((const Uint32 *)indices)[i];
-            } else if (size_indices == 2) {
-                j = ((const Uint16 *)indices)[i];
-            } else {
-                j = ((const Uint8 *)indices)[i];
-            }
-            if (j < 0 || j >= num_vertices) {
-                return SDL_SetError("Values of 'indices' out of bounds");
-            }
-        }
+    if (indices && !CheckGeometryIndices(indices, num_indices, size_indices, num_vertices)) {
+        return false;
     }
 
     if (texture) {
@@ -5344,6 +5810,24 @@ static void SDL_SimulateRenderVSync(SDL_Renderer *renderer)
     }
 }
 
+static void PublishRenderStats(SDL_Renderer *renderer)
+{
+    SDL_PropertiesID props = SDL_GetRendererProperties(renderer);
+
+    if (props) {
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_COMMANDS_NUMBER, renderer->stats.commands);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_DRAW_COMMANDS_NUMBER, renderer->stats.draw_commands);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_MERGED_DRAW_COMMANDS_NUMBER, renderer->stats.merged_draw_commands);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_DROPPED_STATE_COMMANDS_NUMBER, renderer->stats.dropped_state_commands);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_DRAW_CALLS_NUMBER, renderer->stats.draw_calls);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_STATE_CHANGES_NUMBER, renderer->stats.state_changes);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_VERTEX_BYTES_NUMBER, renderer->stats.vertex_bytes);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_TEXTURE_UPLOADS_NUMBER, renderer->stats.texture_uploads);
+        SDL_SetNumberProperty(props, SDL_PROP_RENDERER_STATS_FORCED_FLUSHES_NUMBER, renderer->stats.forced_flushes);
+    }
+    SDL_zero(renderer->stats);
+}
+
 bool SDL_RenderPresent(SDL_Renderer *renderer)
 {
     bool presented = true;
@@ -5359,6 +5843,7 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
     }
 
     FlushRenderCommands(renderer); // time to send everything to the GPU!
+    PublishRenderStats(renderer);
 
 #if DONT_DRAW_WHILE_HIDDEN
     // Don't present while we're hidden
@@ -6031,3 +6516,386 @@ void SDL_DestroyGPURenderState(SDL_GPURenderState *state)
     SDL_free(state->storage_buffers);
     SDL_free(state);
 }
+
+/* A command list records with a copy of the renderer that has its own command queue, vertex data and
+ * view state, so the usual queue functions and the backend's queue functions can fill it on any thread. */
+struct SDL_RenderCommandList
+{
+    SDL_Renderer *renderer;
+    SDL_Renderer recorder;
+};
+
+static void DiscardRenderCommandList(SDL_RenderCommandList *list)
+{
+    SDL_Renderer *recorder = &list->recorder;
+
+    if (recorder->render_commands_tail) {
+        recorder->render_commands_tail->next = recorder->render_commands_pool;
+        recorder->render_commands_pool = recorder->render_commands;
+    }
+    recorder->render_commands = NULL;
+    recorder->render_commands_tail = NULL;
+    recorder->vertex_data_used = 0;
+    recorder->vertex_data_alignment = 0;
+    recorder->color_queued = false;
+    recorder->viewport_queued = false;
+    recorder->cliprect_queued = false;
+    SDL_zero(recorder->stats);
+}
+
+static void CopyRendererState(SDL_RenderCommandList *list)
+{
+    SDL_Renderer *recorder = &list->recorder;
+    SDL_RenderCommand *pool = recorder->render_commands_pool;
+    void *vertex_data = recorder->vertex_data;
+    size_t vertex_data_allocation = recorder->vertex_data_allocation;
+
+    SDL_copyp(recorder, list->renderer);
+    SDL_copyp(&recorder->main_view, list->renderer->view);
+    recorder->view = &recorder->main_view;
+    recorder->gpu_render_state = NULL;
+
+    recorder->render_commands = NULL;
+    recorder->render_commands_tail = NULL;
+    recorder->render_commands_pool = pool;
+    recorder->vertex_data = vertex_data;
+    recorder->vertex_data_allocation = vertex_data_allocation;
+    DiscardRenderCommandList(list);
+}
+
+SDL_RenderCommandList *SDL_CreateRenderCommandList(SDL_Renderer *renderer)
+{
+    SDL_RenderCommandList *list;
+
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    if (!renderer->supports_command_lists) {
+        SDL_Unsupported();
+        return NULL;
+    }
+
+    list = (SDL_RenderCommandList *)SDL_calloc(1, sizeof(*list));
+    if (!list) {
+        return NULL;
+    }
+    list->renderer = renderer;
+    CopyRendererState(list);
+    return list;
+}
+
+bool SDL_ResetRenderCommandList(SDL_RenderCommandList *list)
+{
+    CHECK_PARAM(!list) {
+        return SDL_InvalidParamError("list");
+    }
+    CHECK_RENDERER_MAGIC(list->renderer, false);
+
+    DiscardRenderCommandList(list);
+    CopyRendererState(list);
+    return true;
+}
+
+bool SDL_SetRenderCommandListDrawColorFloat(SDL_RenderCommandList *list, float r, float g, float b, float a)
+{
+    CHECK_PARAM(!list) {
+        return SDL_InvalidParamError("list");
+    }
+
+    list->recorder.color.r = r;
+    list->recorder.color.g = g;
+    list->recorder.color.b = b;
+    list->recorder.color.a = a;
+    return true;
+}
+
+bool SDL_SetRenderCommandListDrawBlendMode(SDL_RenderCommandList *list, SDL_BlendMode blendMode)
+{
+    CHECK_PARAM(!list) {
+        return SDL_InvalidParamError("list");
+    }
+    CHECK_PARAM(blendMode == SDL_BLENDMODE_INVALID) {
+        return SDL_InvalidParamError("blendMode");
+    }
+
+    if (!IsSupportedBlendMode(list->renderer, blendMode)) {
+        return SDL_Unsupported();
+    }
+
+    list->recorder.blendMode = blendMode;
+    return true;
+}
+
+bool SDL_RecordRenderFillRects(SDL_RenderCommandList *list, const SDL_FRect *rects, int count)
+{
+    SDL_Renderer *recorder;
+    SDL_FRect *frects;
+    int i;
+    bool result;
+    bool isstack;
+
+    CHECK_PARAM(!list) {
+        return SDL_InvalidParamError("list");
+    }
+    CHECK_PARAM(!rects) {
+        return SDL_InvalidParamError("SDL_RecordRenderFillRects(): rects");
+    }
+
+    if (count < 1) {
+        return true;
+    }
+
+    recorder = &list->recorder;
+
+#if DONT_DRAW_WHILE_HIDDEN
+    // Don't draw while we're hidden
+    if (recorder->hidden) {
+        return true;
+    }
+#endif
+
+    frects = SDL_small_alloc(SDL_FRect, count, &isstack);
+    if (!frects) {
+        return false;
+    }
+
+    const SDL_RenderViewState *view = recorder->view;
+    const float scale_x = view->current_scale.x;
+    const float scale_y = view->current_scale.y;
+    for (i = 0; i < count; ++i) {
+        frects[i].x = rects[i].x * scale_x;
+        frects[i].y = rects[i].y * scale_y;
+        frects[i].w = rects[i].w * scale_x;
+        frects[i].h = rects[i].h * scale_y;
+    }
+
+    result = QueueCmdFillRects(recorder, frects, count);
+
+    SDL_small_free(frects, isstack);
+
+    return result;
+}
+
+bool SDL_RecordRenderTexture(SDL_RenderCommandList *list, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FRect *dstrect)
+{
+    SDL_Renderer *recorder;
+
+    CHECK_PARAM(!list) {
+        return SDL_InvalidParamError("list");
+    }
+    CHECK_TEXTURE_MAGIC(texture, false);
+
+    CHECK_PARAM(list->renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+
+    recorder = &list->recorder;
+
+#if DONT_DRAW_WHILE_HIDDEN
+    // Don't draw while we're hidden
+    if (recorder->hidden) {
+        return true;
+    }
+#endif
+
+    SDL_FRect real_srcrect;
+    real_srcrect.x = 0.0f;
+    real_srcrect.y = 0.0f;
+    real_srcrect.w = (float)texture->w;
+    real_srcrect.h = (float)texture->h;
+    if (srcrect) {
+        if (!SDL_GetRectIntersectionFloat(srcrect, &real_srcrect, &real_srcrect)) {
+            return true;
+        }
+    }
+
+    SDL_FRect full_dstrect;
+    if (!dstrect) {
+        GetRenderViewportSize(recorder, &full_dstrect);
+        dstrect = &full_dstrect;
+    }
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    return SDL_RenderTextureInternal(recorder, texture, &real_srcrect, dstrect);
+}
+
+bool SDL_RecordRenderGeometry(SDL_RenderCommandList *list,
+                              SDL_Texture *texture,
+                              const SDL_Vertex *vertices, int num_vertices,
+                              const int *indices, int num_indices)
+{
+    SDL_Renderer *recorder;
+    const int size_indices = 4;
+    SDL_TextureAddressMode texture_address_mode_u;
+    SDL_TextureAddressMode texture_address_mode_v;
+
+    CHECK_PARAM(!list) {
+        return SDL_InvalidParamError("list");
+    }
+
+    if (texture) {
+        CHECK_TEXTURE_MAGIC(texture, false);
+
+        CHECK_PARAM(list->renderer != texture->renderer) {
+            return SDL_SetError("Texture was not created with this renderer");
+        }
+    }
+
+    CHECK_PARAM(!vertices) {
+        return SDL_InvalidParamError("vertices");
+    }
+
+    CHECK_PARAM((indices ? num_indices : num_vertices) % 3 != 0) {
+        return SDL_InvalidParamError(indices ? "num_indices" : "num_vertices");
+    }
+
+    recorder = &list->recorder;
+
+    if (!recorder->QueueGeometry) {
+        return SDL_Unsupported();
+    }
+
+#if DONT_DRAW_WHILE_HIDDEN
+    // Don't draw while we're hidden
+    if (recorder->hidden) {
+        return true;
+    }
+#endif
+
+    if (num_vertices < 3) {
+        return true;
+    }
+
+    if (texture && texture->native) {
+        texture = texture->native;
+    }
+
+    GetGeometryTextureAddressModes(recorder, texture, &vertices->tex_coord.x, sizeof(SDL_Vertex), num_vertices, &texture_address_mode_u, &texture_address_mode_v);
+
+    if (indices && !CheckGeometryIndices(indices, num_indices, size_indices, num_vertices)) {
+        return false;
+    }
+
+    const SDL_RenderViewState *view = recorder->view;
+    return QueueCmdGeometry(recorder, texture,
+                            &vertices->position.x, sizeof(SDL_Vertex),
+                            &vertices->color, sizeof(SDL_Vertex),
+                            &vertices->tex_coord.x, sizeof(SDL_Vertex),
+                            num_vertices, indices, num_indices, indices ? size_indices : 0,
+                            view->current_scale.x, view->current_scale.y,
+                            texture_address_mode_u, texture_address_mode_v);
+}
+
+bool SDL_SubmitRenderCommandList(SDL_RenderCommandList *list)
+{
+    SDL_Renderer *renderer;
+    SDL_Renderer *recorder;
+    SDL_RenderCommand *cmd;
+    size_t base = 0;
+    int num_commands = 0;
+
+    CHECK_PARAM(!list) {
+        return SDL_InvalidParamError("list");
+    }
+
+    renderer = list->renderer;
+    recorder = &list->recorder;
+
+    CHECK_RENDERER_MAGIC(renderer, false);
+
+    if (renderer->target != recorder->target) {
+        return SDL_SetError("The render target changed since the command list was started");
+    }
+
+    if (!recorder->render_commands) {
+        return true;
+    }
+
+    // The vertex data goes after the renderer's, aligned so every offset in it stays aligned
+    if (recorder->vertex_data_used > 0) {
+        void *vertices = SDL_AllocateRenderVertices(renderer, recorder->vertex_data_used, recorder->vertex_data_alignment, &base);
+        if (!vertices) {
+            return false;
+        }
+        SDL_memcpy(vertices, recorder->vertex_data, recorder->vertex_data_used);
+    }
+
+    for (cmd = recorder->render_commands; cmd; cmd = cmd->next) {
+        ++num_commands;
+
+        switch (cmd->command) {
+        case SDL_RENDERCMD_SETVIEWPORT:
+            cmd->data.viewport.first += base;
+            break;
+
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+        case SDL_RENDERCMD_CLEAR:
+            cmd->data.color.first += base;
+            break;
+
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+        case SDL_RENDERCMD_FILL_RECTS:
+        case SDL_RENDERCMD_COPY:
+        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_GEOMETRY:
+            cmd->data.draw.first += base;
+            cmd->data.draw.vertex_end += base;
+            if (cmd->data.draw.texture) {
+                cmd->data.draw.texture->last_command_generation = renderer->render_command_generation;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
+    if (renderer->render_commands_tail) {
+        renderer->render_commands_tail->next = recorder->render_commands;
+    } else {
+        renderer->render_commands = recorder->render_commands;
+    }
+    renderer->render_commands_tail = recorder->render_commands_tail;
+    renderer->stats.commands += recorder->stats.commands;
+
+    // The list changed the state, so the renderer has to set it again before its next draw
+    renderer->color_queued = false;
+    renderer->viewport_queued = false;
+    renderer->cliprect_queued = false;
+
+    // The commands belong to the renderer now. Take as many back from its pool as there
+    // are free, so the list doesn't allocate new ones every frame and grow the renderer's pool.
+    recorder->render_commands = NULL;
+    recorder->render_commands_tail = NULL;
+    while (num_commands > 0 && renderer->render_commands_pool) {
+        cmd = renderer->render_commands_pool;
+        renderer->render_commands_pool = cmd->next;
+        cmd->next = recorder->render_commands_pool;
+        recorder->render_commands_pool = cmd;
+        --num_commands;
+    }
+    DiscardRenderCommandList(list);
+    return true;
+}
+
+void SDL_DestroyRenderCommandList(SDL_RenderCommandList *list)
+{
+    SDL_RenderCommand *cmd;
+    SDL_RenderCommand *next;
+
+    if (!list) {
+        return;
+    }
+
+    DiscardRenderCommandList(list);
+    for (cmd = list->recorder.render_commands_pool; cmd; cmd = next) {
+        next = cmd->next;
+        SDL_free(cmd);
+    }
+    SDL_free(list->recorder.vertex_data);
+    SDL_free(list);
+}
@@ -182,6 +182,7 @@ typedef struct SDL_RenderCommand
             SDL_TextureAddressMode texture_address_mode_u;
             SDL_TextureAddressMode texture_address_mode_v;
             SDL_GPURenderState *gpu_render_state;
+            size_t vertex_end; // where the vertex data ends for points, rects and geometry, filled in by SDL_render.c
         } draw;
         struct
         {
@@ -193,6 +194,20 @@ typedef struct SDL_RenderCommand
     struct SDL_RenderCommand *next;
 } SDL_RenderCommand;
 
+// Counters for the frame being rendered, published as renderer properties by SDL_RenderPresent()
+typedef struct SDL_RenderStats
+{
+    Sint64 commands;
+    Sint64 draw_commands;
+    Sint64 merged_draw_commands;
+    Sint64 dropped_state_commands;
+    Sint64 draw_calls; // counted by the backends, one per draw they submit
+    Sint64 state_changes;
+    Sint64 vertex_bytes;
+    Sint64 texture_uploads;
+    Sint64 forced_flushes;
+} SDL_RenderStats;
+
 typedef struct SDL_VertexSolid
 {
     SDL_FPoint position;
@@ -271,6 +286,17 @@ struct SDL_Renderer
     bool software;
     bool npot_texture_wrap_unsupported;
 
+    /* Draw commands that can be joined with the draw before them, a mask of (1 << SDL_RenderCommandType).
+     * A backend sets a bit if it queues exactly draw.count fixed size vertices for that command at
+     * byte offset draw.first in the vertex data, and draws them all the same way.
+     */
+    Uint32 mergeable_commands;
+
+    /* Whether the queue functions can be called on other threads to record an SDL_RenderCommandList.
+     * A backend sets this if its queue functions only change the command and the vertex data from SDL_AllocateRenderVertices().
+     */
+    bool supports_command_lists;
+
     // The window associated with the renderer
     SDL_Window *window;
     bool hidden;
@@ -326,6 +352,9 @@ struct SDL_Renderer
     void *vertex_data;
     size_t vertex_data_used;
     size_t vertex_data_allocation;
+    size_t vertex_data_alignment; // The largest alignment asked of SDL_AllocateRenderVertices()
+
+    SDL_RenderStats stats;
 
     // Shaped window support
     bool transparent_window;
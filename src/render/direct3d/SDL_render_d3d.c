@@ -1285,9 +1285,11 @@ static bool D3D_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
             SetDrawState(data, cmd);
             if (vbo) {
                 IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_POINTLIST, (UINT)(first / sizeof(Vertex)), (UINT)count);
+                renderer->stats.draw_calls++;
             } else {
                 const Vertex *verts = (Vertex *)(((Uint8 *)vertices) + first);
                 IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_POINTLIST, (UINT)count, verts, sizeof(Vertex));
+                renderer->stats.draw_calls++;
             }
             break;
         }
@@ -1307,13 +1309,17 @@ static bool D3D_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
 
             if (vbo) {
                 IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_LINESTRIP, (UINT)(first / sizeof(Vertex)), (UINT)(count - 1));
+                renderer->stats.draw_calls++;
                 if (close_endpoint) {
                     IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_POINTLIST, (UINT)((first / sizeof(Vertex)) + (count - 1)), 1);
+                    renderer->stats.draw_calls++;
                 }
             } else {
                 IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_LINESTRIP, (UINT)(count - 1), verts, sizeof(Vertex));
+                renderer->stats.draw_calls++;
                 if (close_endpoint) {
                     IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_POINTLIST, 1, &verts[count - 1], sizeof(Vertex));
+                    renderer->stats.draw_calls++;
                 }
             }
             break;
@@ -1335,9 +1341,11 @@ static bool D3D_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
             SetDrawState(data, cmd);
             if (vbo) {
                 IDirect3DDevice9_DrawPrimitive(data->device, D3DPT_TRIANGLELIST, (UINT)(first / sizeof(Vertex)), (UINT)count / 3);
+                renderer->stats.draw_calls++;
             } else {
                 const Vertex *verts = (Vertex *)(((Uint8 *)vertices) + first);
                 IDirect3DDevice9_DrawPrimitiveUP(data->device, D3DPT_TRIANGLELIST, (UINT)count / 3, verts, sizeof(Vertex));
+                renderer->stats.draw_calls++;
             }
             break;
         }
@@ -1682,6 +1690,8 @@ static bool D3D_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_P
     renderer->QueueGeometry = D3D_QueueGeometry;
     renderer->InvalidateCachedState = D3D_InvalidateCachedState;
     renderer->RunCommandQueue = D3D_RunCommandQueue;
+    renderer->mergeable_commands = (1 << SDL_RENDERCMD_DRAW_POINTS) | (1 << SDL_RENDERCMD_GEOMETRY);
+    renderer->supports_command_lists = true;
     renderer->RenderReadPixels = D3D_RenderReadPixels;
     renderer->RenderPresent = D3D_RenderPresent;
     renderer->DestroyTexture = D3D_DestroyTexture;
@@ -2438,6 +2438,7 @@ static void D3D11_DrawPrimitives(SDL_Renderer *renderer, D3D11_PRIMITIVE_TOPOLOG
     D3D11_RenderData *rendererData = (D3D11_RenderData *)renderer->internal;
     ID3D11DeviceContext_IASetPrimitiveTopology(rendererData->d3dContext, primitiveTopology);
     ID3D11DeviceContext_Draw(rendererData->d3dContext, (UINT)vertexCount, (UINT)vertexStart);
+    renderer->stats.draw_calls++;
 }
 
 static void D3D11_InvalidateCachedState(SDL_Renderer *renderer)
@@ -2781,6 +2782,8 @@ static bool D3D11_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL
     renderer->QueueGeometry = D3D11_QueueGeometry;
     renderer->InvalidateCachedState = D3D11_InvalidateCachedState;
     renderer->RunCommandQueue = D3D11_RunCommandQueue;
+    renderer->mergeable_commands = (1 << SDL_RENDERCMD_DRAW_POINTS) | (1 << SDL_RENDERCMD_GEOMETRY);
+    renderer->supports_command_lists = true;
     renderer->RenderReadPixels = D3D11_RenderReadPixels;
     renderer->RenderPresent = D3D11_RenderPresent;
     renderer->DestroyTexture = D3D11_DestroyTexture;
@@ -2834,6 +2834,7 @@ static void D3D12_DrawPrimitives(SDL_Renderer *renderer, D3D12_PRIMITIVE_TOPOLOG
     D3D12_RenderData *rendererData = (D3D12_RenderData *)renderer->internal;
     ID3D12GraphicsCommandList2_IASetPrimitiveTopology(rendererData->commandList, primitiveTopology);
     ID3D12GraphicsCommandList2_DrawInstanced(rendererData->commandList, (UINT)vertexCount, 1, (UINT)vertexStart, 0);
+    renderer->stats.draw_calls++;
 }
 
 static void D3D12_InvalidateCachedState(SDL_Renderer *renderer)
@@ -3277,6 +3278,8 @@ bool D3D12_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_Proper
     renderer->QueueGeometry = D3D12_QueueGeometry;
     renderer->InvalidateCachedState = D3D12_InvalidateCachedState;
     renderer->RunCommandQueue = D3D12_RunCommandQueue;
+    renderer->mergeable_commands = (1 << SDL_RENDERCMD_DRAW_POINTS) | (1 << SDL_RENDERCMD_GEOMETRY);
+    renderer->supports_command_lists = true;
     renderer->RenderReadPixels = D3D12_RenderReadPixels;
     renderer->RenderPresent = D3D12_RenderPresent;
     renderer->DestroyTexture = D3D12_DestroyTexture;
@@ -791,6 +791,7 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
             if (count > 2) {
                 // joined lines cannot be grouped
                 Draw(data, cmd, count, offset, SDL_GPU_PRIMITIVETYPE_LINESTRIP);
+                renderer->stats.draw_calls++;
             } else {
                 // let's group non joined lines
                 SDL_RenderCommand *finalcmd = cmd;
@@ -813,6 +814,7 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
                 }
 
                 Draw(data, cmd, count, offset, SDL_GPU_PRIMITIVETYPE_LINELIST);
+                renderer->stats.draw_calls++;
                 cmd = finalcmd; // skip any copy commands we just combined in here.
             }
             break;
@@ -858,6 +860,7 @@ static bool GPU_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd,
             }
 
             Draw(data, cmd, count, offset, prim);
+            renderer->stats.draw_calls++;
 
             cmd = finalcmd; // skip any copy commands we just combined in here.
             break;
@@ -1180,6 +1183,8 @@ static bool GPU_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_P
     renderer->QueueGeometry = GPU_QueueGeometry;
     renderer->InvalidateCachedState = GPU_InvalidateCachedState;
     renderer->RunCommandQueue = GPU_RunCommandQueue;
+    renderer->mergeable_commands = (1 << SDL_RENDERCMD_DRAW_POINTS) | (1 << SDL_RENDERCMD_GEOMETRY);
+    renderer->supports_command_lists = true;
     renderer->RenderReadPixels = GPU_RenderReadPixels;
     renderer->RenderPresent = GPU_RenderPresent;
     renderer->DestroyTexture = GPU_DestroyTexture;
@@ -1454,6 +1454,7 @@ static bool GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
                 if (count > 2) {
                     // joined lines cannot be grouped
                     data->glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)count);
+                    renderer->stats.draw_calls++;
                 } else {
                     // let's group non joined lines
                     SDL_RenderCommand *finalcmd = cmd;
@@ -1476,6 +1477,7 @@ static bool GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
                     }
 
                     data->glDrawArrays(GL_LINES, 0, (GLsizei)count);
+                    renderer->stats.draw_calls++;
                     cmd = finalcmd; // skip any copy commands we just combined in here.
                 }
             }
@@ -1526,6 +1528,7 @@ static bool GLES2_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd
                     op = GL_POINTS;
                 }
                 data->glDrawArrays(op, 0, (GLsizei)count);
+                renderer->stats.draw_calls++;
             }
 
             cmd = finalcmd; // skip any copy commands we just combined in here.
@@ -2270,6 +2273,8 @@ static bool GLES2_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL
     renderer->QueueGeometry = GLES2_QueueGeometry;
     renderer->InvalidateCachedState = GLES2_InvalidateCachedState;
     renderer->RunCommandQueue = GLES2_RunCommandQueue;
+    renderer->mergeable_commands = (1 << SDL_RENDERCMD_DRAW_POINTS) | (1 << SDL_RENDERCMD_GEOMETRY);
+    renderer->supports_command_lists = true;
     renderer->RenderReadPixels = GLES2_RenderReadPixels;
     renderer->RenderPresent = GLES2_RenderPresent;
     renderer->DestroyTexture = GLES2_DestroyTexture;
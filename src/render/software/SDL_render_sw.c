@@ -34,9 +34,13 @@
 #include "SDL_rotate.h"
 #include "SDL_triangle.h"
 #include "../../video/SDL_pixels_c.h"
+#include "../../thread/SDL_workerpool_c.h"
 
 // SDL surface based renderer implementation
 
+// With SDL_HINT_RENDER_SOFTWARE_THREADS, the render target is split into tiles of this many rows
+#define SW_TILE_HEIGHT 64
+
 typedef struct
 {
     const SDL_Rect *viewport;
@@ -45,10 +49,47 @@ typedef struct
     SDL_Color color;
 } SW_DrawStateCache;
 
+// A queued command, waiting to be drawn into each tile it touches
+typedef struct SW_TileOp
+{
+    const SDL_RenderCommand *cmd;
+    SDL_Rect cliprect;
+    SDL_Color color;
+    int texture;
+    int first_tile;
+    int last_tile;
+} SW_TileOp;
+
+/* Each worker draws through its own views of the render target and the
+   textures, so clip rects and blit maps are never shared between threads. */
+typedef struct SW_TileTexture
+{
+    SDL_Surface *surface;
+    SDL_Surface **views;
+} SW_TileTexture;
+
+typedef struct SW_TileState
+{
+    bool active;
+    int num_tiles;
+    int num_workers;
+    void *vertices;
+    SDL_Surface **targets;
+    SW_TileOp *ops;
+    int num_ops;
+    int max_ops;
+    SW_TileTexture *textures;
+    int num_textures;
+    int max_textures;
+    int last_texture;
+} SW_TileState;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    SDL_WorkerPool *tile_pool;
+    SW_TileState tiles;
 } SW_RenderData;
 
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
@@ -674,9 +715,357 @@ static void SW_InvalidateCachedState(SDL_Renderer *renderer)
     // SW_DrawStateCache only lives during SW_RunCommandQueue, so nothing to do here!
 }
 
+// Draw a command whose vertices already have the viewport applied, clipped to the surface clip rect
+static void SW_DrawCommand(SDL_Surface *surface, SDL_Surface *src, const SDL_RenderCommand *cmd, void *vertices, SDL_Color color)
+{
+    const Uint8 r = color.r;
+    const Uint8 g = color.g;
+    const Uint8 b = color.b;
+    const Uint8 a = color.a;
+    const int count = (int)cmd->data.draw.count;
+    const SDL_BlendMode blend = cmd->data.draw.blend;
+    void *verts = ((Uint8 *)vertices) + cmd->data.draw.first;
+    int i;
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR:
+        SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        break;
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_DrawPoints(surface, (const SDL_Point *)verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendPoints(surface, (const SDL_Point *)verts, count, blend, r, g, b, a);
+        }
+        break;
+
+    case SDL_RENDERCMD_DRAW_LINES:
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_DrawLines(surface, (const SDL_Point *)verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendLines(surface, (const SDL_Point *)verts, count, blend, r, g, b, a);
+        }
+        break;
+
+    case SDL_RENDERCMD_FILL_RECTS:
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_FillSurfaceRects(surface, (const SDL_Rect *)verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendFillRects(surface, (const SDL_Rect *)verts, count, blend, r, g, b, a);
+        }
+        break;
+
+    case SDL_RENDERCMD_COPY:
+    {
+        // Only unscaled copies come through here
+        const SDL_Rect *srcrect = (const SDL_Rect *)verts;
+        const SDL_Rect *dstrect = srcrect + 1;
+        SDL_BlitSurface(src, srcrect, surface, dstrect);
+        break;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY:
+        if (src) {
+            GeometryCopyData *ptr = (GeometryCopyData *)verts;
+            for (i = 0; i < count; i += 3, ptr += 3) {
+                SDL_SW_BlitTriangle(
+                    src,
+                    &(ptr[0].src), &(ptr[1].src), &(ptr[2].src),
+                    surface,
+                    &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst),
+                    ptr[0].color, ptr[1].color, ptr[2].color,
+                    cmd->data.draw.texture_address_mode_u,
+                    cmd->data.draw.texture_address_mode_v);
+            }
+        } else {
+            GeometryFillData *ptr = (GeometryFillData *)verts;
+            for (i = 0; i < count; i += 3, ptr += 3) {
+                SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+// Get the area a command can touch, returns false if it can't be split into tiles and get exactly the same pixels
+static bool SW_GetCommandBounds(const SDL_RenderCommand *cmd, void *vertices, SDL_Surface *surface, SDL_Rect *bounds)
+{
+    const int count = (int)cmd->data.draw.count;
+    void *verts = ((Uint8 *)vertices) + cmd->data.draw.first;
+    int i;
+
+    SDL_zerop(bounds);
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR:
+        bounds->w = surface->w;
+        bounds->h = surface->h;
+        return true;
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+        if (count > 0) {
+            SDL_GetRectEnclosingPoints((const SDL_Point *)verts, count, NULL, bounds);
+        }
+        return true;
+
+    case SDL_RENDERCMD_FILL_RECTS:
+    {
+        const SDL_Rect *rects = (const SDL_Rect *)verts;
+        for (i = 0; i < count; ++i) {
+            SDL_GetRectUnion(bounds, &rects[i], bounds);
+        }
+        return true;
+    }
+
+    case SDL_RENDERCMD_COPY:
+    {
+        // Clipping a scaled copy can round the source rectangle differently
+        const SDL_Rect *srcrect = (const SDL_Rect *)verts;
+        const SDL_Rect *dstrect = srcrect + 1;
+        if (srcrect->w != dstrect->w || srcrect->h != dstrect->h) {
+            return false;
+        }
+        *bounds = *dstrect;
+        return true;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY:
+        for (i = 0; i + 2 < count; i += 3) {
+            SDL_Rect rect;
+            if (cmd->data.draw.texture) {
+                const GeometryCopyData *ptr = (const GeometryCopyData *)verts + i;
+                SDL_SW_GetTriangleBounds(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &rect);
+            } else {
+                const GeometryFillData *ptr = (const GeometryFillData *)verts + i;
+                SDL_SW_GetTriangleBounds(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &rect);
+            }
+            SDL_GetRectUnion(bounds, &rect, bounds);
+        }
+        return true;
+
+    default:
+        // Clipping a line moves its end points, and rotated copies go through temporary surfaces
+        return false;
+    }
+}
+
+static SDL_Surface *SW_CreateSurfaceView(SDL_Surface *surface)
+{
+    SDL_Surface *view;
+    Uint32 colorkey;
+
+    view = SDL_CreateSurfaceFrom(surface->w, surface->h, surface->format, surface->pixels, surface->pitch);
+    if (!view) {
+        return NULL;
+    }
+    SDL_SetSurfaceColorspace(view, SDL_GetSurfaceColorspace(surface));
+    if (surface->palette) {
+        SDL_SetSurfacePalette(view, surface->palette);
+    }
+    if (SDL_SurfaceHasColorKey(surface) && SDL_GetSurfaceColorKey(surface, &colorkey)) {
+        SDL_SetSurfaceColorKey(view, true, colorkey);
+    }
+    return view;
+}
+
+static void SW_EndTiles(SW_RenderData *data)
+{
+    SW_TileState *tiles = &data->tiles;
+    int i, j;
+
+    for (i = 0; i < tiles->num_textures; ++i) {
+        for (j = 0; j < tiles->num_workers; ++j) {
+            SDL_DestroySurface(tiles->textures[i].views[j]);
+        }
+        SDL_free(tiles->textures[i].views);
+    }
+    tiles->num_textures = 0;
+
+    if (tiles->targets) {
+        for (j = 0; j < tiles->num_workers; ++j) {
+            SDL_DestroySurface(tiles->targets[j]);
+        }
+        SDL_free(tiles->targets);
+        tiles->targets = NULL;
+    }
+    tiles->num_ops = 0;
+    tiles->active = false;
+}
+
+static bool SW_BeginTiles(SW_RenderData *data, SDL_Surface *surface, void *vertices)
+{
+    SW_TileState *tiles = &data->tiles;
+    int i;
+
+    if (!data->tile_pool || SDL_MUSTLOCK(surface) || surface->h < 2 * SW_TILE_HEIGHT) {
+        return false;
+    }
+
+    tiles->num_workers = SDL_GetWorkerPoolThreadCount(data->tile_pool) + 1;
+    tiles->targets = (SDL_Surface **)SDL_calloc(tiles->num_workers, sizeof(*tiles->targets));
+    if (!tiles->targets) {
+        return false;
+    }
+    for (i = 0; i < tiles->num_workers; ++i) {
+        tiles->targets[i] = SW_CreateSurfaceView(surface);
+        if (!tiles->targets[i]) {
+            SW_EndTiles(data);
+            return false;
+        }
+    }
+    tiles->num_tiles = (surface->h + SW_TILE_HEIGHT - 1) / SW_TILE_HEIGHT;
+    tiles->vertices = vertices;
+    tiles->num_ops = 0;
+    tiles->last_texture = -1;
+    tiles->active = true;
+    return true;
+}
+
+// Returns the index of the per-worker views of a texture, or -1 if they can't be created
+static int SW_GetTileTexture(SW_TileState *tiles, SDL_Surface *surface)
+{
+    SW_TileTexture *texture;
+    int i;
+
+    if (tiles->last_texture >= 0 && tiles->textures[tiles->last_texture].surface == surface) {
+        return tiles->last_texture;
+    }
+    for (i = 0; i < tiles->num_textures; ++i) {
+        if (tiles->textures[i].surface == surface) {
+            tiles->last_texture = i;
+            return i;
+        }
+    }
+
+    if (tiles->num_textures == tiles->max_textures) {
+        const int max_textures = SDL_max(tiles->max_textures * 2, 8);
+        SW_TileTexture *textures = (SW_TileTexture *)SDL_realloc(tiles->textures, max_textures * sizeof(*textures));
+        if (!textures) {
+            return -1;
+        }
+        tiles->textures = textures;
+        tiles->max_textures = max_textures;
+    }
+
+    texture = &tiles->textures[tiles->num_textures];
+    texture->surface = surface;
+    texture->views = (SDL_Surface **)SDL_calloc(tiles->num_workers, sizeof(*texture->views));
+    if (!texture->views) {
+        return -1;
+    }
+    for (i = 0; i < tiles->num_workers; ++i) {
+        texture->views[i] = SW_CreateSurfaceView(surface);
+        if (!texture->views[i]) {
+            while (i--) {
+                SDL_DestroySurface(texture->views[i]);
+            }
+            SDL_free(texture->views);
+            return -1;
+        }
+    }
+    tiles->last_texture = tiles->num_textures++;
+    return tiles->last_texture;
+}
+
+static void SDLCALL SW_RunTile(void *userdata, int tile, int worker)
+{
+    SW_RenderData *data = (SW_RenderData *)userdata;
+    SW_TileState *tiles = &data->tiles;
+    SDL_Surface *target = tiles->targets[worker];
+    SDL_Rect tile_rect;
+    int i;
+
+    tile_rect.x = 0;
+    tile_rect.y = tile * SW_TILE_HEIGHT;
+    tile_rect.w = target->w;
+    tile_rect.h = SDL_min(SW_TILE_HEIGHT, target->h - tile_rect.y);
+
+    for (i = 0; i < tiles->num_ops; ++i) {
+        const SW_TileOp *op = &tiles->ops[i];
+        SDL_Surface *src = NULL;
+        SDL_Rect clip;
+
+        if (tile < op->first_tile || tile > op->last_tile) {
+            continue;
+        }
+        if (!SDL_GetRectIntersection(&op->cliprect, &tile_rect, &clip)) {
+            continue;
+        }
+        SDL_SetSurfaceClipRect(target, &clip);
+
+        if (op->texture >= 0) {
+            // Same as PrepTextureForCopy(), on this worker's view of the texture
+            src = tiles->textures[op->texture].views[worker];
+            SDL_SetSurfaceColorMod(src, op->color.r, op->color.g, op->color.b);
+            SDL_SetSurfaceAlphaMod(src, op->color.a);
+            SDL_SetSurfaceBlendMode(src, op->cmd->data.draw.blend);
+        }
+        SW_DrawCommand(target, src, op->cmd, tiles->vertices, op->color);
+    }
+}
+
+// Draw everything queued for the tiles, in order
+static void SW_FlushTiles(SW_RenderData *data)
+{
+    SW_TileState *tiles = &data->tiles;
+
+    if (tiles->num_ops > 0) {
+        SDL_RunWorkerPool(data->tile_pool, tiles->num_tiles, SW_RunTile, data);
+        tiles->num_ops = 0;
+    }
+}
+
+/* Queue a command to be drawn into the tiles, using the current surface clip rect.
+   Returns false if the caller should draw it directly, in which case everything
+   queued before it has already been drawn. */
+static bool SW_DeferToTiles(SW_RenderData *data, SDL_Surface *surface, const SDL_RenderCommand *cmd, SDL_Color color, SDL_Surface *src)
+{
+    SW_TileState *tiles = &data->tiles;
+    SW_TileOp *op;
+    SDL_Rect bounds;
+    int texture = -1;
+
+    if (!tiles->active) {
+        return false;
+    }
+
+    if (!SW_GetCommandBounds(cmd, tiles->vertices, surface, &bounds) ||
+        (src && (SDL_MUSTLOCK(src) || (texture = SW_GetTileTexture(tiles, src)) < 0))) {
+        SW_FlushTiles(data);
+        return false;
+    }
+    if (!SDL_GetRectIntersection(&bounds, &surface->clip_rect, &bounds)) {
+        return true; // nothing to draw
+    }
+
+    if (tiles->num_ops == tiles->max_ops) {
+        const int max_ops = SDL_max(tiles->max_ops * 2, 256);
+        SW_TileOp *ops = (SW_TileOp *)SDL_realloc(tiles->ops, max_ops * sizeof(*ops));
+        if (!ops) {
+            SW_FlushTiles(data);
+            return false;
+        }
+        tiles->ops = ops;
+        tiles->max_ops = max_ops;
+    }
+
+    op = &tiles->ops[tiles->num_ops++];
+    op->cmd = cmd;
+    op->cliprect = surface->clip_rect;
+    op->color = color;
+    op->texture = texture;
+    op->first_tile = bounds.y / SW_TILE_HEIGHT;
+    op->last_tile = (bounds.y + bounds.h - 1) / SW_TILE_HEIGHT;
+    return true;
+}
 
 static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
 
@@ -692,6 +1081,8 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
     drawstate.color.b = 0;
     drawstate.color.a = 0;
 
+    SW_BeginTiles(data, surface, vertices);
+
     while (cmd) {
         switch (cmd->command) {
         case SDL_RENDERCMD_SETDRAWCOLOR:
@@ -719,55 +1110,27 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
 
         case SDL_RENDERCMD_CLEAR:
         {
-            const Uint8 r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
+            SDL_Color color;
+            color.r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+            color.g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+            color.b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+            color.a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
             // By definition the clear ignores the clip rect
             SDL_SetSurfaceClipRect(surface, NULL);
-            SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+            if (!SW_DeferToTiles(data, surface, cmd, color, NULL)) {
+                SW_DrawCommand(surface, NULL, cmd, vertices, color);
+            }
             drawstate.surface_cliprect_dirty = true;
             break;
         }
 
         case SDL_RENDERCMD_DRAW_POINTS:
-        {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
-            const int count = (int)cmd->data.draw.count;
-            SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
-            SetDrawState(surface, &drawstate);
-
-            // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                int i;
-                for (i = 0; i < count; i++) {
-                    verts[i].x += drawstate.viewport->x;
-                    verts[i].y += drawstate.viewport->y;
-                }
-            }
-
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_DrawPoints(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            } else {
-                SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
-            }
-            break;
-        }
-
         case SDL_RENDERCMD_DRAW_LINES:
         {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
             const int count = (int)cmd->data.draw.count;
             SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
             SetDrawState(surface, &drawstate);
+            renderer->stats.draw_calls++;
 
             // Apply viewport
             if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
@@ -778,24 +1141,18 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 }
             }
 
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_DrawLines(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            } else {
-                SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
+            if (!SW_DeferToTiles(data, surface, cmd, drawstate.color, NULL)) {
+                SW_DrawCommand(surface, NULL, cmd, vertices, drawstate.color);
             }
             break;
         }
 
         case SDL_RENDERCMD_FILL_RECTS:
         {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
             const int count = (int)cmd->data.draw.count;
             SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
             SetDrawState(surface, &drawstate);
+            renderer->stats.draw_calls++;
 
             // Apply viewport
             if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
@@ -806,10 +1163,8 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 }
             }
 
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_FillSurfaceRects(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            } else {
-                SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
+            if (!SW_DeferToTiles(data, surface, cmd, drawstate.color, NULL)) {
+                SW_DrawCommand(surface, NULL, cmd, vertices, drawstate.color);
             }
             break;
         }
@@ -823,6 +1178,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             SDL_Surface *src = (SDL_Surface *)texture->internal;
 
             SetDrawState(surface, &drawstate);
+            renderer->stats.draw_calls++;
 
             PrepTextureForCopy(cmd, &drawstate);
 
@@ -832,8 +1188,12 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 dstrect->y += drawstate.viewport->y;
             }
 
+            if (SW_DeferToTiles(data, surface, cmd, drawstate.color, src)) {
+                break;
+            }
+
             if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
-                SDL_BlitSurface(src, srcrect, surface, dstrect);
+                SW_DrawCommand(surface, src, cmd, vertices, drawstate.color);
             } else {
                 /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
                  * to avoid potentially frequent RLE encoding/decoding.
@@ -883,6 +1243,7 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
         {
             CopyExData *copydata = (CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
             SetDrawState(surface, &drawstate);
+            renderer->stats.draw_calls++;
             PrepTextureForCopy(cmd, &drawstate);
 
             // Apply viewport
@@ -891,6 +1252,9 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                 copydata->dstrect.y += drawstate.viewport->y;
             }
 
+            // Rotated copies are always drawn directly, after anything queued for the tiles
+            SW_FlushTiles(data);
+
             SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
                             &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
                             copydata->scale_x, copydata->scale_y, cmd->data.draw.texture_scale_mode);
@@ -903,15 +1267,16 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
             SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
             const int count = (int)cmd->data.draw.count;
             SDL_Texture *texture = cmd->data.draw.texture;
-            const SDL_BlendMode blend = cmd->data.draw.blend;
+            SDL_Surface *src = NULL;
 
             SetDrawState(surface, &drawstate);
+            renderer->stats.draw_calls++;
 
             if (texture) {
-                SDL_Surface *src = (SDL_Surface *)texture->internal;
-
                 GeometryCopyData *ptr = (GeometryCopyData *)verts;
 
+                src = (SDL_Surface *)texture->internal;
+
                 PrepTextureForCopy(cmd, &drawstate);
 
                 // Apply viewport
@@ -925,17 +1290,6 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                         ptr[i].dst.y += vp.y;
                     }
                 }
-
-                for (i = 0; i < count; i += 3, ptr += 3) {
-                    SDL_SW_BlitTriangle(
-                        src,
-                        &(ptr[0].src), &(ptr[1].src), &(ptr[2].src),
-                        surface,
-                        &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst),
-                        ptr[0].color, ptr[1].color, ptr[2].color,
-                        cmd->data.draw.texture_address_mode_u,
-                        cmd->data.draw.texture_address_mode_v);
-                }
             } else {
                 GeometryFillData *ptr = (GeometryFillData *)verts;
 
@@ -950,10 +1304,10 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
                         ptr[i].dst.y += vp.y;
                     }
                 }
+            }
 
-                for (i = 0; i < count; i += 3, ptr += 3) {
-                    SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
-                }
+            if (!SW_DeferToTiles(data, surface, cmd, drawstate.color, src)) {
+                SW_DrawCommand(surface, src, cmd, vertices, drawstate.color);
             }
             break;
         }
@@ -965,6 +1319,11 @@ static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, v
         cmd = cmd->next;
     }
 
+    if (data->tiles.active) {
+        SW_FlushTiles(data);
+        SW_EndTiles(data);
+    }
+
     return true;
 }
 
@@ -1019,6 +1378,9 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
     if (window) {
         SDL_DestroyWindowSurface(window);
     }
+    SDL_DestroyWorkerPool(data->tile_pool);
+    SDL_free(data->tiles.ops);
+    SDL_free(data->tiles.textures);
     SDL_free(data);
 }
 
@@ -1120,6 +1482,8 @@ static void SW_SelectBestFormats(SDL_Renderer *renderer, SDL_PixelFormat format)
 bool SW_CreateRendererForSurface(SDL_Renderer *renderer, SDL_Surface *surface, SDL_PropertiesID create_props)
 {
     SW_RenderData *data;
+    const char *hint;
+    int num_threads;
 
     CHECK_PARAM(!SDL_SurfaceValid(surface)) {
         return SDL_InvalidParamError("surface");
@@ -1139,6 +1503,18 @@ bool SW_CreateRendererForSurface(SDL_Renderer *renderer, SDL_Surface *surface, S
     data->surface = surface;
     data->window = surface;
 
+    hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    num_threads = hint ? SDL_atoi(hint) : 0;
+    if (num_threads > 1) {
+        // The rendering thread draws tiles too, and if the pool can't be created everything is drawn on that thread
+        data->tile_pool = SDL_CreateWorkerPool("SDLRenderSW", num_threads - 1, SDL_THREAD_PRIORITY_NORMAL);
+    }
+    if (!data->tile_pool) {
+        // Joined draws cover more of the surface, so tiles would skip them less often
+        renderer->mergeable_commands = (1 << SDL_RENDERCMD_DRAW_POINTS) | (1 << SDL_RENDERCMD_FILL_RECTS) | (1 << SDL_RENDERCMD_GEOMETRY);
+    }
+    renderer->supports_command_lists = true;
+
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
     renderer->CreateTexture = SW_CreateTexture;
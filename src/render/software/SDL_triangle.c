@@ -149,6 +149,11 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
     r->h = (max_y - min_y) >> FP_BITS;
 }
 
+void SDL_SW_GetTriangleBounds(const SDL_Point *d0, const SDL_Point *d1, const SDL_Point *d2, SDL_Rect *rect)
+{
+    bounding_rect_fixedpoint(d0, d1, d2, rect);
+}
+
 /* Triangle rendering, using Barycentric coordinates (w0, w1, w2)
  *
  * The cross product isn't computed from scratch at each iteration,
@@ -156,23 +161,120 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
  *
  */
 
-#define TRIANGLE_BEGIN_LOOP                                                        \
-    {                                                                              \
-        int x, y;                                                                  \
-        for (y = 0; y < dstrect.h; y++) {                                          \
-            /* y start */                                                          \
-            Sint64 w0 = w0_row;                                                    \
-            Sint64 w1 = w1_row;                                                    \
-            Sint64 w2 = w2_row;                                                    \
-            for (x = 0; x < dstrect.w; x++) {                                      \
-                /* In triangle */                                                  \
-                if (w0 + bias_w0 >= 0 && w1 + bias_w1 >= 0 && w2 + bias_w2 >= 0) { \
+/* Rather than testing the edge functions at every pixel of the bounding rect,
+ * each row works out the span of pixels inside all three edges, so only
+ * covered pixels are visited. Colors and texture coordinates are stepped
+ * along the span as a running quotient and remainder, which gives exactly
+ * the same values as dividing by the area at every pixel.
+ */
+
+// Narrow [*x_start, *x_end) to the pixels where value + x * step >= 0
+static SDL_INLINE void clip_span(Sint64 value, Sint64 step, int *x_start, int *x_end)
+{
+    if (step > 0) {
+        if (value < 0) {
+            const Sint64 first = (-value + step - 1) / step;
+            if (first > *x_start) {
+                *x_start = (int)SDL_min(first, (Sint64)*x_end);
+            }
+        }
+    } else if (step < 0) {
+        if (value < 0) {
+            *x_end = *x_start;
+        } else {
+            const Sint64 last = value / -step;
+            if (last + 1 < *x_end) {
+                *x_end = (int)(last + 1);
+            }
+        }
+    } else if (value < 0) {
+        *x_end = *x_start;
+    }
+}
+
+// The value of n / area along a span, where n changes by dn at each pixel
+typedef struct TriangleInterp
+{
+    Sint64 q, r;   // floor(n / area) and the remainder
+    Sint64 dq, dr; // floor(dn / area) and the remainder
+} TriangleInterp;
+
+// Set up the step between pixels, once per triangle
+static SDL_INLINE void interp_setup(TriangleInterp *interp, Sint64 dn, Sint64 area)
+{
+    interp->dq = dn / area;
+    interp->dr = dn % area;
+    if (interp->dr < 0) {
+        interp->dr += area;
+        interp->dq -= 1;
+    }
+}
+
+// Set up the value at the first pixel of a span
+static SDL_INLINE void interp_start(TriangleInterp *interp, Sint64 n, Sint64 area)
+{
+    interp->q = n / area;
+    interp->r = n % area;
+    if (interp->r < 0) {
+        interp->r += area;
+        interp->q -= 1;
+    }
+}
+
+static SDL_INLINE void interp_step(TriangleInterp *interp, Sint64 area)
+{
+    // Branchless carry, the remainder wraps around at unpredictable pixels
+    Sint64 carry;
+    interp->r += interp->dr;
+    carry = (interp->r >= area);
+    interp->q += interp->dq + carry;
+    interp->r -= area & -carry;
+}
+
+// Same as n / area, which rounds towards zero
+static SDL_INLINE int interp_value(const TriangleInterp *interp)
+{
+    return (int)((interp->q < 0 && interp->r != 0) ? interp->q + 1 : interp->q);
+}
+
+// Edge function values at the first pixel of the span
+#define TRIANGLE_SPAN_W0 (w0_row + (Sint64)x_start * d2d1_y)
+#define TRIANGLE_SPAN_W1 (w1_row + (Sint64)x_start * d0d2_y)
+#define TRIANGLE_SPAN_W2 (w2_row + (Sint64)x_start * d1d0_y)
+
+#define TRIANGLE_BEGIN_LOOP TRIANGLE_BEGIN_LOOP_INTERP(, )
+
+#define TRIANGLE_BEGIN_LOOP_INTERP(SPAN_INIT, STEP)                                 \
+    {                                                                               \
+        int x, y;                                                                   \
+        for (y = 0; y < dstrect.h; y++) {                                           \
+            /* In triangle */                                                       \
+            int x_start = 0;                                                        \
+            int x_end = dstrect.w;                                                  \
+            clip_span(w0_row + bias_w0, d2d1_y, &x_start, &x_end);                  \
+            clip_span(w1_row + bias_w1, d0d2_y, &x_start, &x_end);                  \
+            clip_span(w2_row + bias_w2, d1d0_y, &x_start, &x_end);                  \
+            if (x_start < x_end) {                                                  \
+                SPAN_INIT                                                           \
+                for (x = x_start; x < x_end; x++ STEP) {                            \
                     Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
 
 // Use 64 bits precision to prevent overflow when interpolating color / texture with wide triangles
+#define TRIANGLE_TEXTCOORD_SETUP                                                                \
+    TriangleInterp interp_srcx, interp_srcy;                                                    \
+    interp_setup(&interp_srcx, (Sint64)d2d1_y * s2s0_x + (Sint64)d0d2_y * s2s1_x, area);        \
+    interp_setup(&interp_srcy, (Sint64)d2d1_y * s2s0_y + (Sint64)d0d2_y * s2s1_y, area);
+
+#define TRIANGLE_TEXTCOORD_INIT                                                                                        \
+    interp_start(&interp_srcx, TRIANGLE_SPAN_W0 * s2s0_x + TRIANGLE_SPAN_W1 * s2s1_x + s2_x_area.x, area);             \
+    interp_start(&interp_srcy, TRIANGLE_SPAN_W0 * s2s0_y + TRIANGLE_SPAN_W1 * s2s1_y + s2_x_area.y, area);
+
+#define TRIANGLE_TEXTCOORD_STEP \
+    , interp_step(&interp_srcx, area), interp_step(&interp_srcy, area)
+
 #define TRIANGLE_GET_TEXTCOORD                                                          \
-    int srcx = (int)(((Sint64)w0 * s2s0_x + (Sint64)w1 * s2s1_x + s2_x_area.x) / area); \
-    int srcy = (int)(((Sint64)w0 * s2s0_y + (Sint64)w1 * s2s1_y + s2_x_area.y) / area); \
+    int srcx = interp_value(&interp_srcx);                                              \
+    int srcy = interp_value(&interp_srcy);                                              \
     if (texture_address_mode_u == SDL_TEXTURE_ADDRESS_CLAMP) {                          \
         if (srcx < 0) {                                                                 \
             srcx = 0;                                                                   \
@@ -198,32 +300,44 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
         }                                                                               \
     }
 
-#define TRIANGLE_GET_MAPPED_COLOR                                                      \
-    Uint8 r = (Uint8)(((Sint64)w0 * c0.r + (Sint64)w1 * c1.r + (Sint64)w2 * c2.r) / area); \
-    Uint8 g = (Uint8)(((Sint64)w0 * c0.g + (Sint64)w1 * c1.g + (Sint64)w2 * c2.g) / area); \
-    Uint8 b = (Uint8)(((Sint64)w0 * c0.b + (Sint64)w1 * c1.b + (Sint64)w2 * c2.b) / area); \
-    Uint8 a = (Uint8)(((Sint64)w0 * c0.a + (Sint64)w1 * c1.a + (Sint64)w2 * c2.a) / area); \
+#define TRIANGLE_COLOR_SETUP                                                                                     \
+    TriangleInterp interp_r, interp_g, interp_b, interp_a;                                                       \
+    interp_setup(&interp_r, (Sint64)d2d1_y * c0.r + (Sint64)d0d2_y * c1.r + (Sint64)d1d0_y * c2.r, area);        \
+    interp_setup(&interp_g, (Sint64)d2d1_y * c0.g + (Sint64)d0d2_y * c1.g + (Sint64)d1d0_y * c2.g, area);        \
+    interp_setup(&interp_b, (Sint64)d2d1_y * c0.b + (Sint64)d0d2_y * c1.b + (Sint64)d1d0_y * c2.b, area);        \
+    interp_setup(&interp_a, (Sint64)d2d1_y * c0.a + (Sint64)d0d2_y * c1.a + (Sint64)d1d0_y * c2.a, area);
+
+#define TRIANGLE_COLOR_INIT                                                                                      \
+    interp_start(&interp_r, TRIANGLE_SPAN_W0 * c0.r + TRIANGLE_SPAN_W1 * c1.r + TRIANGLE_SPAN_W2 * c2.r, area);  \
+    interp_start(&interp_g, TRIANGLE_SPAN_W0 * c0.g + TRIANGLE_SPAN_W1 * c1.g + TRIANGLE_SPAN_W2 * c2.g, area);  \
+    interp_start(&interp_b, TRIANGLE_SPAN_W0 * c0.b + TRIANGLE_SPAN_W1 * c1.b + TRIANGLE_SPAN_W2 * c2.b, area);  \
+    interp_start(&interp_a, TRIANGLE_SPAN_W0 * c0.a + TRIANGLE_SPAN_W1 * c1.a + TRIANGLE_SPAN_W2 * c2.a, area);
+
+#define TRIANGLE_COLOR_STEP \
+    , interp_step(&interp_r, area), interp_step(&interp_g, area), interp_step(&interp_b, area), interp_step(&interp_a, area)
+
+#define TRIANGLE_GET_MAPPED_COLOR                   \
+    Uint8 r = (Uint8)interp_value(&interp_r);       \
+    Uint8 g = (Uint8)interp_value(&interp_g);       \
+    Uint8 b = (Uint8)interp_value(&interp_b);       \
+    Uint8 a = (Uint8)interp_value(&interp_a);       \
     Uint32 color = SDL_MapRGBA(format, palette, r, g, b, a);
 
-#define TRIANGLE_GET_COLOR                                                             \
-    int r = (int)(((Sint64)w0 * c0.r + (Sint64)w1 * c1.r + (Sint64)w2 * c2.r) / area); \
-    int g = (int)(((Sint64)w0 * c0.g + (Sint64)w1 * c1.g + (Sint64)w2 * c2.g) / area); \
-    int b = (int)(((Sint64)w0 * c0.b + (Sint64)w1 * c1.b + (Sint64)w2 * c2.b) / area); \
-    int a = (int)(((Sint64)w0 * c0.a + (Sint64)w1 * c1.a + (Sint64)w2 * c2.a) / area);
-
-#define TRIANGLE_END_LOOP \
-    }                     \
-    /* x += 1 */          \
-    w0 += d2d1_y;         \
-    w1 += d0d2_y;         \
-    w2 += d1d0_y;         \
-    }                     \
-    /* y += 1 */          \
-    w0_row += d1d2_x;     \
-    w1_row += d2d0_x;     \
-    w2_row += d0d1_x;     \
-    dst_ptr += dst_pitch; \
-    }                     \
+#define TRIANGLE_GET_COLOR                \
+    int r = interp_value(&interp_r);      \
+    int g = interp_value(&interp_g);      \
+    int b = interp_value(&interp_b);      \
+    int a = interp_value(&interp_a);
+
+#define TRIANGLE_END_LOOP         \
+                }                 \
+            }                     \
+            /* y += 1 */          \
+            w0_row += d1d2_x;     \
+            w1_row += d2d0_x;     \
+            w2_row += d0d1_x;     \
+            dst_ptr += dst_pitch; \
+        }                         \
     }
 
 bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Point *d2, SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2)
@@ -415,15 +529,16 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
             format = dst->fmt;
             palette = dst->palette;
         }
+        TRIANGLE_COLOR_SETUP
         if (dstbpp == 4) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_COLOR_INIT, TRIANGLE_COLOR_STEP)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *(Uint32 *)dptr = color;
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 3) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_COLOR_INIT, TRIANGLE_COLOR_STEP)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 Uint8 *s = (Uint8 *)&color;
@@ -433,14 +548,14 @@ bool SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poi
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 2) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_COLOR_INIT, TRIANGLE_COLOR_STEP)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *(Uint16 *)dptr = (Uint16)color;
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 1) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_COLOR_INIT, TRIANGLE_COLOR_STEP)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *dptr = (Uint8)color;
@@ -694,8 +809,9 @@ bool SDL_SW_BlitTriangle(
         goto end;
     }
 
+    TRIANGLE_TEXTCOORD_SETUP
     if (dstbpp == 4) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_TEXTCOORD_INIT, TRIANGLE_TEXTCOORD_STEP)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint32 *sptr = (Uint32 *)((Uint8 *)src_ptr + srcy * src_pitch);
@@ -703,7 +819,7 @@ bool SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 3) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_TEXTCOORD_INIT, TRIANGLE_TEXTCOORD_STEP)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint8 *sptr = (Uint8 *)src_ptr + srcy * src_pitch;
@@ -713,7 +829,7 @@ bool SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 2) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_TEXTCOORD_INIT, TRIANGLE_TEXTCOORD_STEP)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint16 *sptr = (Uint16 *)((Uint8 *)src_ptr + srcy * src_pitch);
@@ -721,7 +837,7 @@ bool SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 1) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_TEXTCOORD_INIT, TRIANGLE_TEXTCOORD_STEP)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint8 *sptr = (Uint8 *)src_ptr + srcy * src_pitch;
@@ -790,7 +906,9 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
     srcfmt_val = detect_format(src_fmt);
     dstfmt_val = detect_format(dst_fmt);
 
-    TRIANGLE_BEGIN_LOOP
+    TRIANGLE_TEXTCOORD_SETUP
+    TRIANGLE_COLOR_SETUP
+    TRIANGLE_BEGIN_LOOP_INTERP(TRIANGLE_TEXTCOORD_INIT TRIANGLE_COLOR_INIT, TRIANGLE_TEXTCOORD_STEP TRIANGLE_COLOR_STEP)
     {
         Uint8 *src;
         Uint8 *dst = dptr;
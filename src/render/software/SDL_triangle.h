@@ -38,4 +38,7 @@ extern bool SDL_SW_BlitTriangle(SDL_Surface *src,
 
 extern void trianglepoint_2_fixedpoint(SDL_Point *a);
 
+// The area a triangle with fixed point vertices can touch
+extern void SDL_SW_GetTriangleBounds(const SDL_Point *d0, const SDL_Point *d1, const SDL_Point *d2, SDL_Rect *rect);
+
 #endif // SDL_triangle_h_
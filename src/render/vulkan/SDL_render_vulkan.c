@@ -3835,6 +3835,7 @@ static void VULKAN_DrawPrimitives(SDL_Renderer *renderer, VkPrimitiveTopology pr
 {
     VULKAN_RenderData *rendererData = (VULKAN_RenderData *)renderer->internal;
     vkCmdDraw(rendererData->currentCommandBuffer, (uint32_t)vertexCount, 1, (uint32_t)vertexStart, 0);
+    renderer->stats.draw_calls++;
 }
 
 static void VULKAN_InvalidateCachedState(SDL_Renderer *renderer)
@@ -4300,6 +4301,8 @@ static bool VULKAN_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SD
     renderer->QueueGeometry = VULKAN_QueueGeometry;
     renderer->InvalidateCachedState = VULKAN_InvalidateCachedState;
     renderer->RunCommandQueue = VULKAN_RunCommandQueue;
+    renderer->mergeable_commands = (1 << SDL_RENDERCMD_DRAW_POINTS) | (1 << SDL_RENDERCMD_GEOMETRY);
+    renderer->supports_command_lists = true;
     renderer->RenderReadPixels = VULKAN_RenderReadPixels;
     renderer->AddVulkanRenderSemaphores = VULKAN_AddVulkanRenderSemaphores;
     renderer->RenderPresent = VULKAN_RenderPresent;
@@ -32,6 +32,12 @@
 #define NO_MALLOC_STATS 1
 #define USE_LOCKS 1
 #define USE_DL_PREFIX
+#ifdef SDL_MALLOC_ARENAS
+// Each chunk records the arena it came from, so any thread can free it
+#define MSPACES 1
+#define FOOTERS 1
+#define LACKS_TIME_H
+#endif
 
 /*
   This is a version (aka dlmalloc) of malloc/free/realloc written by
@@ -6330,11 +6336,67 @@ History:
 
 #endif /* !HAVE_MALLOC */
 
+// Define this if you want to track the number of allocations active
+// #define SDL_TRACK_ALLOCATION_COUNT
+
+#if defined(SDL_TRACK_ALLOCATION_COUNT) || (!defined(HAVE_MALLOC) && defined(SDL_MALLOC_ARENAS))
+// Spread per-thread state over a few slots, so threads don't all share one cache line
+static SDL_INLINE Uint32 SDL_GetThreadSlot(Uint32 num_slots)
+{
+    return (Uint32)((SDL_GetCurrentThreadID() * 0x9E3779B97F4A7C15ULL) >> 32) % num_slots;
+}
+#endif
+
 #ifdef HAVE_MALLOC
 static void * SDLCALL real_malloc(size_t s) { return malloc(s); }
 static void * SDLCALL real_calloc(size_t n, size_t s) { return calloc(n, s); }
 static void * SDLCALL real_realloc(void *p, size_t s) { return realloc(p,s); }
 static void   SDLCALL real_free(void *p) { free(p); }
+#elif defined(SDL_MALLOC_ARENAS)
+/* Define SDL_MALLOC_ARENAS to a number of arenas to give threads their own
+   dlmalloc spaces, picked by thread ID, so they only wait for each other's
+   locks when they happen to share one. Freeing and reallocating work on
+   memory from any arena, since each chunk has a footer pointing to it. */
+static mspace SDL_malloc_arenas[SDL_MALLOC_ARENAS];
+
+static mspace SDL_GetMallocArena(void)
+{
+    void **slot = &SDL_malloc_arenas[SDL_GetThreadSlot(SDL_MALLOC_ARENAS)];
+    mspace arena = SDL_GetAtomicPointer(slot);
+
+    if (!arena) {
+        mspace new_arena = create_mspace(0, 1);
+        if (!new_arena) {
+            return NULL;
+        }
+        if (SDL_CompareAndSwapAtomicPointer(slot, NULL, new_arena)) {
+            arena = new_arena;
+        } else {
+            destroy_mspace(new_arena);
+            arena = SDL_GetAtomicPointer(slot);
+        }
+    }
+    return arena;
+}
+
+static void * SDLCALL real_malloc(size_t s)
+{
+    mspace arena = SDL_GetMallocArena();
+    return arena ? mspace_malloc(arena, s) : dlmalloc(s);
+}
+
+static void * SDLCALL real_calloc(size_t n, size_t s)
+{
+    mspace arena = SDL_GetMallocArena();
+    return arena ? mspace_calloc(arena, n, s) : dlcalloc(n, s);
+}
+
+static void * SDLCALL real_realloc(void *p, size_t s)
+{
+    return p ? dlrealloc(p, s) : real_malloc(s);
+}
+
+#define real_free dlfree
 #else
 #define real_malloc dlmalloc
 #define real_calloc dlcalloc
@@ -6360,16 +6422,26 @@ static struct
     SDL_calloc_func calloc_func;
     SDL_realloc_func realloc_func;
     SDL_free_func free_func;
-    SDL_AtomicInt num_allocations;
 } s_mem = {
-    real_malloc, real_calloc, real_realloc, real_free, { 0 }
+    real_malloc, real_calloc, real_realloc, real_free
 };
 
-// Define this if you want to track the number of allocations active
-// #define SDL_TRACK_ALLOCATION_COUNT
 #ifdef SDL_TRACK_ALLOCATION_COUNT
-#define INCREMENT_ALLOCATION_COUNT()    (void)SDL_AtomicIncRef(&s_mem.num_allocations)
-#define DECREMENT_ALLOCATION_COUNT()    (void)SDL_AtomicDecRef(&s_mem.num_allocations)
+/* Each thread counts in one of several counters, and they're only added up
+   when the total is asked for. Memory is often freed on a different thread
+   than it was allocated on, so a single counter can go negative. */
+#define SDL_ALLOCATION_COUNTERS 16
+
+typedef struct SDL_AllocationCounter
+{
+    SDL_AtomicInt count;
+    Uint8 padding[SDL_CACHELINE_SIZE - sizeof(SDL_AtomicInt)];
+} SDL_AllocationCounter;
+
+static SDL_AllocationCounter s_allocation_counters[SDL_ALLOCATION_COUNTERS];
+
+#define INCREMENT_ALLOCATION_COUNT()    (void)SDL_AtomicIncRef(&s_allocation_counters[SDL_GetThreadSlot(SDL_ALLOCATION_COUNTERS)].count)
+#define DECREMENT_ALLOCATION_COUNT()    (void)SDL_AtomicDecRef(&s_allocation_counters[SDL_GetThreadSlot(SDL_ALLOCATION_COUNTERS)].count)
 #else
 #define INCREMENT_ALLOCATION_COUNT()
 #define DECREMENT_ALLOCATION_COUNT()
@@ -6442,7 +6514,13 @@ bool SDL_SetMemoryFunctions(SDL_malloc_func malloc_func,
 int SDL_GetNumAllocations(void)
 {
 #ifdef SDL_TRACK_ALLOCATION_COUNT
-    return SDL_GetAtomicInt(&s_mem.num_allocations);
+    int num_allocations = 0;
+    int i;
+
+    for (i = 0; i < SDL_ALLOCATION_COUNTERS; ++i) {
+        num_allocations += SDL_GetAtomicInt(&s_allocation_counters[i].count);
+    }
+    return num_allocations;
 #else
     return -1;
 #endif
@@ -0,0 +1,198 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_workerpool_c.h"
+
+typedef struct SDL_WorkerPoolThread
+{
+    SDL_WorkerPool *pool;
+    SDL_Thread *thread;
+    int index;
+} SDL_WorkerPoolThread;
+
+struct SDL_WorkerPool
+{
+    SDL_Mutex *lock;
+    SDL_Condition *work_cond;   // signaled when a new batch is posted, or on shutdown.
+    SDL_Condition *done_cond;   // signaled when the last helper finishes a batch.
+    SDL_ThreadPriority priority;
+    SDL_WorkerPoolThread *threads;
+    int num_threads;
+
+    // these are only changed while holding `lock`.
+    Uint32 generation;
+    int busy_threads;
+    bool shutdown;
+
+    // the current batch.
+    SDL_WorkerPoolTask task;
+    void *userdata;
+    int num_tasks;
+    SDL_AtomicInt next_task;
+};
+
+static void RunWorkerPoolTasks(SDL_WorkerPool *pool, SDL_WorkerPoolTask task, void *userdata, int num_tasks, int worker)
+{
+    while (true) {
+        const int i = SDL_AddAtomicInt(&pool->next_task, 1);
+        if (i >= num_tasks) {
+            break;
+        }
+        task(userdata, i, worker);
+    }
+}
+
+static int SDLCALL WorkerPoolThread(void *data)
+{
+    SDL_WorkerPoolThread *info = (SDL_WorkerPoolThread *)data;
+    SDL_WorkerPool *pool = info->pool;
+    Uint32 generation = 0;
+
+    SDL_SetCurrentThreadPriority(pool->priority);
+
+    SDL_LockMutex(pool->lock);
+    while (true) {
+        while (!pool->shutdown && (pool->generation == generation)) {
+            SDL_WaitCondition(pool->work_cond, pool->lock);
+        }
+
+        if (pool->shutdown) {
+            break;
+        }
+
+        generation = pool->generation;
+        SDL_WorkerPoolTask task = pool->task;
+        void *userdata = pool->userdata;
+        const int num_tasks = pool->num_tasks;
+        SDL_UnlockMutex(pool->lock);
+
+        RunWorkerPoolTasks(pool, task, userdata, num_tasks, info->index);
+
+        SDL_LockMutex(pool->lock);
+        if (--pool->busy_threads == 0) {
+            SDL_SignalCondition(pool->done_cond);
+        }
+    }
+    SDL_UnlockMutex(pool->lock);
+
+    return 0;
+}
+
+SDL_WorkerPool *SDL_CreateWorkerPool(const char *name, int num_threads, SDL_ThreadPriority priority)
+{
+    if (num_threads <= 0) {
+        SDL_InvalidParamError("num_threads");
+        return NULL;
+    }
+
+    SDL_WorkerPool *pool = (SDL_WorkerPool *)SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->priority = priority;
+    pool->lock = SDL_CreateMutex();
+    pool->work_cond = SDL_CreateCondition();
+    pool->done_cond = SDL_CreateCondition();
+    pool->threads = (SDL_WorkerPoolThread *)SDL_calloc(num_threads, sizeof(*pool->threads));
+    if (!pool->lock || !pool->work_cond || !pool->done_cond || !pool->threads) {
+        SDL_DestroyWorkerPool(pool);
+        return NULL;
+    }
+
+    for (int i = 0; i < num_threads; ++i) {
+        char threadname[64];
+        SDL_WorkerPoolThread *info = &pool->threads[i];
+        info->pool = pool;
+        info->index = i + 1;
+        (void)SDL_snprintf(threadname, sizeof(threadname), "%s%d", name, info->index);
+        info->thread = SDL_CreateThread(WorkerPoolThread, threadname, info);
+        if (!info->thread) {
+            SDL_DestroyWorkerPool(pool);
+            return NULL;
+        }
+        pool->num_threads++;
+    }
+
+    return pool;
+}
+
+int SDL_GetWorkerPoolThreadCount(SDL_WorkerPool *pool)
+{
+    return pool ? pool->num_threads : 0;
+}
+
+void SDL_RunWorkerPool(SDL_WorkerPool *pool, int num_tasks, SDL_WorkerPoolTask task, void *userdata)
+{
+    if (num_tasks <= 0) {
+        return;
+    } else if (!pool || (num_tasks == 1)) {
+        for (int i = 0; i < num_tasks; ++i) {
+            task(userdata, i, 0);
+        }
+        return;
+    }
+
+    SDL_LockMutex(pool->lock);
+    SDL_assert(pool->busy_threads == 0);  // not reentrant!
+    pool->task = task;
+    pool->userdata = userdata;
+    pool->num_tasks = num_tasks;
+    pool->busy_threads = pool->num_threads;
+    SDL_SetAtomicInt(&pool->next_task, 0);
+    pool->generation++;
+    SDL_BroadcastCondition(pool->work_cond);
+    SDL_UnlockMutex(pool->lock);
+
+    RunWorkerPoolTasks(pool, task, userdata, num_tasks, 0);
+
+    // every helper has to check in before we return, so nobody is still looking at this batch when the next one is posted.
+    SDL_LockMutex(pool->lock);
+    while (pool->busy_threads > 0) {
+        SDL_WaitCondition(pool->done_cond, pool->lock);
+    }
+    SDL_UnlockMutex(pool->lock);
+}
+
+void SDL_DestroyWorkerPool(SDL_WorkerPool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    if (pool->num_threads > 0) {
+        SDL_LockMutex(pool->lock);
+        pool->shutdown = true;
+        SDL_BroadcastCondition(pool->work_cond);
+        SDL_UnlockMutex(pool->lock);
+
+        for (int i = 0; i < pool->num_threads; ++i) {
+            SDL_WaitThread(pool->threads[i].thread, NULL);
+        }
+    }
+
+    SDL_free(pool->threads);
+    SDL_DestroyCondition(pool->done_cond);
+    SDL_DestroyCondition(pool->work_cond);
+    SDL_DestroyMutex(pool->lock);
+    SDL_free(pool);
+}
@@ -0,0 +1,52 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_workerpool_c_h_
+#define SDL_workerpool_c_h_
+
+/* A tiny fork/join pool for splitting one piece of work into independent tasks.
+
+   The thread calling SDL_RunWorkerPool() participates as worker 0, and the pool
+   threads are workers 1 through SDL_GetWorkerPoolThreadCount(). Tasks are handed
+   out with an atomic counter, so each task index runs exactly once, on whatever
+   worker grabs it first. The worker index is stable for the duration of a task,
+   so callers can use it to pick per-worker scratch space.
+
+   A NULL pool is valid everywhere and simply runs every task on the caller. */
+
+typedef struct SDL_WorkerPool SDL_WorkerPool;
+
+typedef void (*SDL_WorkerPoolTask)(void *userdata, int task, int worker);
+
+// Create a pool with `num_threads` helper threads. Returns NULL on failure or if threads are disabled.
+extern SDL_WorkerPool *SDL_CreateWorkerPool(const char *name, int num_threads, SDL_ThreadPriority priority);
+
+// Number of helper threads in the pool (0 for a NULL pool). The maximum worker index is this value.
+extern int SDL_GetWorkerPoolThreadCount(SDL_WorkerPool *pool);
+
+// Run `num_tasks` tasks and block until every one of them has finished. Not reentrant for a given pool.
+extern void SDL_RunWorkerPool(SDL_WorkerPool *pool, int num_tasks, SDL_WorkerPoolTask task, void *userdata);
+
+// Stop and join all helper threads.
+extern void SDL_DestroyWorkerPool(SDL_WorkerPool *pool);
+
+#endif // SDL_workerpool_c_h_
@@ -35,24 +35,18 @@ typedef struct SDL_Timer
     void *userdata;
     Uint64 interval;
     Uint64 scheduled;
+    Uint64 sequence;  // breaks ties between timers scheduled for the same tick, so they fire in the order they were queued.
     SDL_AtomicInt canceled;
-    struct SDL_Timer *next;
+    struct SDL_Timer *next;  // used by the pending list and the freelist.
 } SDL_Timer;
 
-typedef struct SDL_TimerMap
-{
-    SDL_TimerID timerID;
-    SDL_Timer *timer;
-    struct SDL_TimerMap *next;
-} SDL_TimerMap;
-
-// The timers are kept in a sorted list
+// The timers are kept in a 4-ary min-heap, ordered by scheduling time
 typedef struct
 {
     // Data used by the main thread
     SDL_InitState init;
     SDL_Thread *thread;
-    SDL_TimerMap *timermap;
+    SDL_HashTable *timermap;  // SDL_TimerID -> SDL_Timer *
     SDL_Mutex *timermap_lock;
 
     // Padding to separate cache lines between threads
@@ -64,9 +58,13 @@ typedef struct
     SDL_Timer *pending;
     SDL_Timer *freelist;
     SDL_AtomicInt active;
+    SDL_AtomicInt num_canceled;  // timers canceled by SDL_RemoveTimer that may still be sitting in the heap.
 
-    // List of timers - this is only touched by the timer thread
-    SDL_Timer *timers;
+    // Heap of timers - this is only touched by the timer thread
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint64 next_sequence;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -74,33 +72,134 @@ static SDL_TimerData SDL_timer_data;
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
- * Timers are removed by simply setting a canceled flag
+ * Timers are removed by simply setting a canceled flag. The timer thread
+ * drops them when they reach the top of the heap, or sweeps them all out
+ * at once if enough of them pile up.
  */
 
-static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+#define TIMER_HEAP_ARITY 4
+
+// Don't bother sweeping canceled timers out of the heap until there are at least this many.
+#define TIMER_SWEEP_THRESHOLD 64
+
+static bool SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
 {
-    SDL_Timer *prev, *curr;
+    if (a->scheduled != b->scheduled) {
+        return a->scheduled < b->scheduled;
+    }
+    return a->sequence < b->sequence;
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
+static void SDL_SiftTimerUp(SDL_TimerData *data, int i)
+{
+    SDL_Timer **heap = data->timers;
+    SDL_Timer *timer = heap[i];
+
+    while (i > 0) {
+        const int parent = (i - 1) / TIMER_HEAP_ARITY;
+        if (!SDL_TimerBefore(timer, heap[parent])) {
             break;
         }
+        heap[i] = heap[parent];
+        i = parent;
     }
+    heap[i] = timer;
+}
 
-    // Insert the timer here!
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+static void SDL_SiftTimerDown(SDL_TimerData *data, int i)
+{
+    SDL_Timer **heap = data->timers;
+    SDL_Timer *timer = heap[i];
+    const int count = data->num_timers;
+
+    for (;;) {
+        const int first = (i * TIMER_HEAP_ARITY) + 1;
+        if (first >= count) {
+            break;
+        }
+
+        const int last = SDL_min(first + TIMER_HEAP_ARITY, count);
+        int best = first;
+        for (int child = first + 1; child < last; ++child) {
+            if (SDL_TimerBefore(heap[child], heap[best])) {
+                best = child;
+            }
+        }
+
+        if (!SDL_TimerBefore(heap[best], timer)) {
+            break;
+        }
+        heap[i] = heap[best];
+        i = best;
+    }
+    heap[i] = timer;
+}
+
+static bool SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    if (data->num_timers == data->max_timers) {
+        const int max_timers = data->max_timers ? (data->max_timers * 2) : 64;
+        SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return false;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    timer->sequence = data->next_sequence++;
+    data->timers[data->num_timers++] = timer;
+    SDL_SiftTimerUp(data, data->num_timers - 1);
+    return true;
+}
+
+static SDL_Timer *SDL_RemoveFirstTimer(SDL_TimerData *data)
+{
+    SDL_Timer *timer = data->timers[0];
+
+    data->num_timers--;
+    if (data->num_timers > 0) {
+        data->timers[0] = data->timers[data->num_timers];
+        SDL_SiftTimerDown(data, 0);
     }
-    timer->next = curr;
+    return timer;
+}
+
+// Move every canceled timer out of the heap onto a list, and rebuild what's left.
+static void SDL_SweepCanceledTimers(SDL_TimerData *data, SDL_Timer **freelist_head, SDL_Timer **freelist_tail)
+{
+    int kept = 0;
+    int removed = 0;
+
+    for (int i = 0; i < data->num_timers; ++i) {
+        SDL_Timer *timer = data->timers[i];
+        if (SDL_GetAtomicInt(&timer->canceled)) {
+            timer->next = NULL;
+            if (*freelist_tail) {
+                (*freelist_tail)->next = timer;
+            } else {
+                *freelist_head = timer;
+            }
+            *freelist_tail = timer;
+            removed++;
+        } else {
+            data->timers[kept++] = timer;
+        }
+    }
+
+    data->num_timers = kept;
+    for (int i = (kept - 2) / TIMER_HEAP_ARITY; i >= 0; --i) {
+        SDL_SiftTimerDown(data, i);
+    }
+
+    SDL_AddAtomicInt(&data->num_canceled, -removed);
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
 {
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
+    SDL_Timer *deferred = NULL;
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
@@ -127,11 +226,25 @@ static int SDLCALL SDL_TimerThread(void *_data)
         }
         SDL_UnlockSpinlock(&data->lock);
 
-        // Sort the pending timers into our list
+        // Anything we couldn't fit in the heap last time goes first.
+        if (deferred) {
+            current = deferred;
+            while (current->next) {
+                current = current->next;
+            }
+            current->next = pending;
+            pending = deferred;
+            deferred = NULL;
+        }
+
+        // Sort the pending timers into our heap
         while (pending) {
             current = pending;
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
+            if (!SDL_AddTimerInternal(data, current)) {
+                current->next = deferred;  // out of memory, try again next time around.
+                deferred = current;
+            }
         }
         freelist_head = NULL;
         freelist_tail = NULL;
@@ -141,25 +254,29 @@ static int SDLCALL SDL_TimerThread(void *_data)
             break;
         }
 
+        // If lots of timers were canceled, get them out of the way now instead of waiting for them to come due.
+        const int num_canceled = SDL_GetAtomicInt(&data->num_canceled);
+        if ((num_canceled >= TIMER_SWEEP_THRESHOLD) && (num_canceled >= (data->num_timers / 2))) {
+            SDL_SweepCanceledTimers(data, &freelist_head, &freelist_tail);
+        }
+
         // Initial delay if there are no timers
-        delay = (Uint64)-1;
+        delay = deferred ? SDL_MS_TO_NS(1) : (Uint64)-1;
 
         tick = SDL_GetTicksNS();
 
         // Process all the pending timers for this tick
-        while (data->timers) {
-            current = data->timers;
+        while (data->num_timers > 0) {
+            current = data->timers[0];
 
             if (tick < current->scheduled) {
                 // Scheduled for the future, wait a bit
-                delay = (current->scheduled - tick);
+                delay = SDL_min(delay, current->scheduled - tick);
                 break;
             }
 
-            // We're going to do something with this timer
-            data->timers = current->next;
-
-            if (SDL_GetAtomicInt(&current->canceled)) {
+            const bool was_canceled = SDL_GetAtomicInt(&current->canceled) ? true : false;
+            if (was_canceled) {
                 interval = 0;
             } else {
                 if (current->callback_ms) {
@@ -170,11 +287,15 @@ static int SDLCALL SDL_TimerThread(void *_data)
             }
 
             if (interval > 0) {
-                // Reschedule this timer
+                // Reschedule this timer, it's still at the top of the heap so just push it down.
                 current->interval = interval;
                 current->scheduled = tick + interval;
-                SDL_AddTimerInternal(data, current);
+                current->sequence = data->next_sequence++;
+                SDL_SiftTimerDown(data, 0);
             } else {
+                SDL_RemoveFirstTimer(data);
+
+                current->next = NULL;
                 if (!freelist_head) {
                     freelist_head = current;
                 }
@@ -183,7 +304,10 @@ static int SDLCALL SDL_TimerThread(void *_data)
                 }
                 freelist_tail = current;
 
-                SDL_SetAtomicInt(&current->canceled, 1);
+                if (was_canceled || !SDL_CompareAndSwapAtomicInt(&current->canceled, 0, 1)) {
+                    // SDL_RemoveTimer() counted this one as still being in the heap.
+                    SDL_AddAtomicInt(&data->num_canceled, -1);
+                }
             }
         }
 
@@ -203,6 +327,26 @@ static int SDLCALL SDL_TimerThread(void *_data)
          */
         SDL_WaitSemaphoreTimeoutNS(data->sem, delay);
     }
+
+    // Hand back anything that never made it into the heap, so SDL_QuitTimers can free it.
+    if (deferred) {
+        current = deferred;
+        while (current->next) {
+            current = current->next;
+        }
+        if (!freelist_head) {
+            freelist_head = deferred;
+        } else {
+            freelist_tail->next = deferred;
+        }
+        freelist_tail = current;
+    }
+    if (freelist_head) {
+        SDL_LockSpinlock(&data->lock);
+        freelist_tail->next = data->freelist;
+        data->freelist = freelist_head;
+        SDL_UnlockSpinlock(&data->lock);
+    }
     return 0;
 }
 
@@ -219,6 +363,11 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    data->timermap = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!data->timermap) {
+        goto error;
+    }
+
     data->sem = SDL_CreateSemaphore(0);
     if (!data->sem) {
         goto error;
@@ -245,7 +394,6 @@ void SDL_QuitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
 
     if (!SDL_ShouldQuit(&data->init)) {
         return;
@@ -266,20 +414,25 @@ void SDL_QuitTimers(void)
     }
 
     // Clean up the timer entries
-    while (data->timers) {
-        timer = data->timers;
-        data->timers = timer->next;
-        SDL_free(timer);
+    for (int i = 0; i < data->num_timers; ++i) {
+        SDL_free(data->timers[i]);
     }
+    SDL_free(data->timers);
+    data->timers = NULL;
+    data->num_timers = 0;
+    data->max_timers = 0;
+    data->next_sequence = 0;
+    SDL_SetAtomicInt(&data->num_canceled, 0);
+
     while (data->freelist) {
         timer = data->freelist;
         data->freelist = timer->next;
         SDL_free(timer);
     }
-    while (data->timermap) {
-        entry = data->timermap;
-        data->timermap = entry->next;
-        SDL_free(entry);
+
+    if (data->timermap) {
+        SDL_DestroyHashTable(data->timermap);
+        data->timermap = NULL;
     }
 
     if (data->timermap_lock) {
@@ -299,7 +452,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    bool added;
 
     CHECK_PARAM(!callback_ms && !callback_ns) {
         SDL_InvalidParamError("callback");
@@ -318,7 +471,10 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     SDL_UnlockSpinlock(&data->lock);
 
     if (timer) {
-        SDL_RemoveTimer(timer->timerID);
+        // Timers that expired on their own are still in the map, drop that entry.
+        SDL_LockMutex(data->timermap_lock);
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID);
+        SDL_UnlockMutex(data->timermap_lock);
     } else {
         timer = (SDL_Timer *)SDL_malloc(sizeof(*timer));
         if (!timer) {
@@ -333,18 +489,13 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     timer->scheduled = SDL_GetTicksNS() + timer->interval;
     SDL_SetAtomicInt(&timer->canceled, 0);
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
+    SDL_LockMutex(data->timermap_lock);
+    added = SDL_InsertIntoHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID, timer, false);
+    SDL_UnlockMutex(data->timermap_lock);
+    if (!added) {
         SDL_free(timer);
         return 0;
     }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
-
-    SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
-    SDL_UnlockMutex(data->timermap_lock);
 
     // Add the timer to the pending list for the timer thread
     SDL_LockSpinlock(&data->lock);
@@ -355,7 +506,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     // Wake up the timer thread if necessary
     SDL_SignalSemaphore(data->sem);
 
-    return entry->timerID;
+    return timer->timerID;
 }
 
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *userdata)
@@ -371,35 +522,23 @@ SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *
 bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_Timer *timer = NULL;
     bool canceled = false;
 
     CHECK_PARAM(!id) {
         return SDL_InvalidParamError("id");
     }
 
-    // Find the timer
+    // Find the timer. Cancel it while holding the lock, so it can't be recycled as a different timer out from under us.
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
-    }
-    SDL_UnlockMutex(data->timermap_lock);
-
-    if (entry) {
-        if (!SDL_GetAtomicInt(&entry->timer->canceled)) {
-            SDL_SetAtomicInt(&entry->timer->canceled, 1);
+    if (data->timermap && SDL_FindInHashTable(data->timermap, (const void *)(uintptr_t)id, (const void **)&timer)) {
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)id);
+        if (SDL_CompareAndSwapAtomicInt(&timer->canceled, 0, 1)) {
+            SDL_AddAtomicInt(&data->num_canceled, 1);
             canceled = true;
         }
-        SDL_free(entry);
     }
+    SDL_UnlockMutex(data->timermap_lock);
     if (canceled) {
         return true;
     } else {
@@ -27,6 +27,128 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../thread/SDL_workerpool_c.h"
+
+// Blits at least this large may be split into bands and run in parallel, see SDL_HINT_SURFACE_BLIT_THREADS
+#define SDL_BLIT_BAND_MIN_PIXELS (512 * 512)
+#define SDL_BLIT_BAND_MIN_ROWS   16
+
+static SDL_InitState SDL_blit_pool_init;
+static SDL_Mutex *SDL_blit_pool_lock;
+static SDL_WorkerPool *SDL_blit_pool;
+static int SDL_blit_pool_threads;
+
+// The CPU features the blitters can use, detected on first use and reset at SDL_Quit()
+static unsigned int SDL_blit_features = 0x7fffffff;
+
+typedef struct SDL_BlitBands
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+    int num_bands;
+} SDL_BlitBands;
+
+static void SDL_BlitBand(void *userdata, int task, int worker)
+{
+    const SDL_BlitBands *bands = (const SDL_BlitBands *)userdata;
+    const SDL_BlitInfo *info = bands->info;
+    const int y0 = (int)(((Sint64)info->dst_h * task) / bands->num_bands);
+    const int y1 = (int)(((Sint64)info->dst_h * (task + 1)) / bands->num_bands);
+    SDL_BlitInfo band;
+
+    SDL_copyp(&band, info);
+    band.src += (size_t)y0 * info->src_pitch;
+    band.dst += (size_t)y0 * info->dst_pitch;
+    band.src_h = y1 - y0;
+    band.dst_h = y1 - y0;
+    bands->blit(&band);
+}
+
+// Get the blit worker pool, sized for `num_threads`, or NULL if it's busy or can't be created
+static SDL_WorkerPool *SDL_AcquireBlitPool(int num_threads)
+{
+    if (SDL_ShouldInit(&SDL_blit_pool_init)) {
+        SDL_blit_pool_lock = SDL_CreateMutex();
+        SDL_SetInitialized(&SDL_blit_pool_init, (SDL_blit_pool_lock != NULL));
+    }
+    if (!SDL_blit_pool_lock || !SDL_TryLockMutex(SDL_blit_pool_lock)) {
+        // Another thread is running a banded blit, this one can run on its own thread
+        return NULL;
+    }
+
+    if (num_threads != SDL_blit_pool_threads) {
+        SDL_DestroyWorkerPool(SDL_blit_pool);
+        SDL_blit_pool = SDL_CreateWorkerPool("SDLBlit", num_threads - 1, SDL_THREAD_PRIORITY_NORMAL);  // the blitting thread is a worker, too.
+        SDL_blit_pool_threads = SDL_blit_pool ? num_threads : 0;
+    }
+    if (!SDL_blit_pool) {
+        SDL_UnlockMutex(SDL_blit_pool_lock);
+        return NULL;
+    }
+    return SDL_blit_pool;
+}
+
+static void SDL_ReleaseBlitPool(void)
+{
+    SDL_UnlockMutex(SDL_blit_pool_lock);
+}
+
+void SDL_QuitBlit(void)
+{
+    SDL_blit_features = 0x7fffffff;
+
+    if (SDL_ShouldQuit(&SDL_blit_pool_init)) {
+        SDL_DestroyWorkerPool(SDL_blit_pool);
+        SDL_blit_pool = NULL;
+        SDL_blit_pool_threads = 0;
+        SDL_DestroyMutex(SDL_blit_pool_lock);
+        SDL_blit_pool_lock = NULL;
+        SDL_SetInitialized(&SDL_blit_pool_init, false);
+    }
+}
+
+// Split a large blit into horizontal bands and run them on the blit worker pool, returns false if the blit should run on this thread
+static bool SDL_RunBlitInBands(SDL_BlitFunc RunBlit, const SDL_BlitInfo *info)
+{
+    // Scaled blits step through the source across the whole rectangle, so they can't be split
+    if (info->src_w != info->dst_w || info->src_h != info->dst_h) {
+        return false;
+    }
+    if ((Sint64)info->dst_w * info->dst_h < SDL_BLIT_BAND_MIN_PIXELS || info->dst_h < 2 * SDL_BLIT_BAND_MIN_ROWS) {
+        return false;
+    }
+    // The palette map fills itself in as colors are looked up, so it can't be shared between threads
+    if (info->palette_map) {
+        return false;
+    }
+
+    // Overlapping blits within a surface depend on the order rows are copied in
+    const Uint8 *src_end = info->src + (size_t)(info->src_h - 1) * info->src_pitch + (size_t)info->src_w * info->src_fmt->bytes_per_pixel;
+    const Uint8 *dst_end = info->dst + (size_t)(info->dst_h - 1) * info->dst_pitch + (size_t)info->dst_w * info->dst_fmt->bytes_per_pixel;
+    if (info->src < dst_end && info->dst < src_end) {
+        return false;
+    }
+
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+    const int num_threads = hint ? SDL_atoi(hint) : 0;
+    if (num_threads <= 1) {
+        return false;
+    }
+
+    SDL_WorkerPool *pool = SDL_AcquireBlitPool(num_threads);
+    if (!pool) {
+        return false;
+    }
+
+    SDL_BlitBands bands;
+    bands.blit = RunBlit;
+    bands.info = info;
+    bands.num_bands = SDL_min(num_threads * 2, info->dst_h / SDL_BLIT_BAND_MIN_ROWS);  // a few extra bands evens out the load
+    SDL_RunWorkerPool(pool, bands.num_bands, SDL_BlitBand, &bands);
+
+    SDL_ReleaseBlitPool();
+    return true;
+}
 
 // The general purpose software blit routine
 static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
@@ -83,7 +205,9 @@ static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
         RunBlit = (SDL_BlitFunc)src->map.data;
 
         // Run the actual software blit
-        RunBlit(info);
+        if (!SDL_RunBlitInBands(RunBlit, info)) {
+            RunBlit(info);
+        }
     }
 
     // We need to unlock the surfaces if they're locked
@@ -126,7 +250,7 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelForm
                                        SDL_BlitFuncEntry *entries)
 {
     int i, flagcheck = (flags & (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
-    static unsigned int features = 0x7fffffff;
+    unsigned int features = SDL_blit_features;
 
     // Get the available CPU features
     if (features == 0x7fffffff) {
@@ -140,6 +264,15 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelForm
         if (SDL_HasSSE2()) {
             features |= SDL_CPU_SSE2;
         }
+        if (SDL_HasSSE41()) {
+            features |= SDL_CPU_SSE41;
+        }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasNEON()) {
+            features |= SDL_CPU_NEON;
+        }
         if (SDL_HasAltiVec()) {
             if (SDL_UseAltivecPrefetch()) {
                 features |= SDL_CPU_ALTIVEC_PREFETCH;
@@ -147,6 +280,7 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelForm
                 features |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
+        SDL_blit_features = features;
     }
 
     for (i = 0; entries[i].func; ++i) {
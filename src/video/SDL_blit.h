@@ -52,6 +52,11 @@ extern const Uint16 SDL_expand_byte_10[];
 #define SDL_CPU_SSE2               0x00000004
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000008
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000010
+#define SDL_CPU_SSE41              0x00000020
+#define SDL_CPU_AVX2               0x00000040
+#define SDL_CPU_NEON               0x00000080
+
+typedef struct SDL_PaletteMap SDL_PaletteMap;
 
 typedef struct
 {
@@ -70,7 +75,7 @@ typedef struct
     const SDL_PixelFormatDetails *dst_fmt;
     const SDL_Palette *dst_pal;
     Uint8 *table;
-    SDL_HashTable *palette_map;
+    SDL_PaletteMap *palette_map;
     int flags;
     Uint32 colorkey;
     Uint8 r, g, b, a;
@@ -105,6 +110,7 @@ typedef struct SDL_BlitMap
 
 // Functions found in SDL_blit.c
 extern bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst);
+extern void SDL_QuitBlit(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
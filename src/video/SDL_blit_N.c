@@ -2089,6 +2089,48 @@ static void BlitNtoN(SDL_BlitInfo *info)
     }
 }
 
+// Convert a row at a time to RGBA and look the whole row up in the destination palette
+static void BlitNtoIndex8(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    const SDL_PixelFormatDetails *srcfmt = info->src_fmt;
+    int srcbpp = srcfmt->bytes_per_pixel;
+    Uint32 row[256];
+    Uint32 Pixel;
+    unsigned sR, sG, sB, sA;
+
+    while (height--) {
+        int n = width;
+        while (n > 0) {
+            const int count = SDL_min(n, (int)SDL_arraysize(row));
+            int i;
+            if (srcfmt->Amask) {
+                for (i = 0; i < count; ++i) {
+                    DISEMBLE_RGBA(src, srcbpp, srcfmt, Pixel, sR, sG, sB, sA);
+                    row[i] = (sR << 24) | (sG << 16) | (sB << 8) | sA;
+                    src += srcbpp;
+                }
+            } else {
+                for (i = 0; i < count; ++i) {
+                    DISEMBLE_RGB(src, srcbpp, srcfmt, Pixel, sR, sG, sB);
+                    row[i] = (sR << 24) | (sG << 16) | (sB << 8) | 0xFF;
+                    src += srcbpp;
+                }
+            }
+            SDL_LookupRGBAColors(info->palette_map, row, dst, count);
+            dst += count;
+            n -= count;
+        }
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
 static void BlitNtoNCopyAlpha(SDL_BlitInfo *info)
 {
     int width = info->dst_w;
@@ -3191,6 +3233,8 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
                     blitfun = BlitNtoNCopyAlpha;
                 }
             }
+        } else if (surface->map.info.palette_map) {
+            blitfun = BlitNtoIndex8;
         }
         return blitfun;
 
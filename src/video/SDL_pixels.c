@@ -1153,23 +1153,228 @@ Uint8 SDL_FindColor(const SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     return pixelvalue;
 }
 
-Uint8 SDL_LookupRGBAColor(SDL_HashTable *palette_map, Uint32 pixelvalue, const SDL_Palette *pal)
+/* Nearest color lookup for converting pixels to a palette.
+
+   RGBA space is split into cells, and the first time a cell is used we work
+   out which palette entries could possibly be closest to some color inside
+   it: an entry is a candidate if its nearest distance to the cell is no more
+   than the smallest farthest distance of any entry. Checking just those
+   candidates gives exactly the same answer as SDL_FindColor(),
+   usually after a handful of comparisons instead of a pass over the whole
+   palette. A small direct-mapped cache in front of that catches repeated
+   pixel values. */
+
+#define PALETTE_MAP_RGB_SHIFT   4
+#define PALETTE_MAP_ALPHA_SHIFT 6
+#define PALETTE_MAP_RGB_CELLS   (256 >> PALETTE_MAP_RGB_SHIFT)
+#define PALETTE_MAP_ALPHA_CELLS ((256 >> PALETTE_MAP_ALPHA_SHIFT) + 1) // opaque pixels get a cell of their own
+#define PALETTE_MAP_NUM_CELLS   (PALETTE_MAP_RGB_CELLS * PALETTE_MAP_RGB_CELLS * PALETTE_MAP_RGB_CELLS * PALETTE_MAP_ALPHA_CELLS)
+#define PALETTE_MAP_CACHE_BITS  12
+#define PALETTE_MAP_CACHE_SIZE  (1 << PALETTE_MAP_CACHE_BITS)
+
+typedef struct SDL_PaletteMapCell
 {
-    Uint8 color_index = 0;
-    const void *value;
-    if (SDL_FindInHashTable(palette_map, (const void *)(uintptr_t)pixelvalue, &value)) {
-        color_index = (Uint8)(uintptr_t)value;
+    Uint32 offset;
+    Uint32 count; // 0 until the cell is built, every built cell has at least one candidate.
+} SDL_PaletteMapCell;
+
+typedef struct SDL_PaletteMapCandidate
+{
+    SDL_Color color;
+    Uint32 index;
+} SDL_PaletteMapCandidate;
+
+typedef struct SDL_PaletteMapCacheEntry
+{
+    Uint32 pixel;
+    Uint32 index; // palette index + 1, or 0 if this entry is unused.
+} SDL_PaletteMapCacheEntry;
+
+struct SDL_PaletteMap
+{
+    const SDL_Palette *palette;
+    SDL_PaletteMapCandidate *candidates;
+    Uint32 num_candidates;
+    Uint32 max_candidates;
+    SDL_PaletteMapCell cells[PALETTE_MAP_NUM_CELLS];
+    SDL_PaletteMapCacheEntry cache[PALETTE_MAP_CACHE_SIZE];
+};
+
+SDL_PaletteMap *SDL_CreatePaletteMap(const SDL_Palette *pal)
+{
+    SDL_PaletteMap *palette_map = (SDL_PaletteMap *)SDL_calloc(1, sizeof(*palette_map));
+    if (!palette_map) {
+        return NULL;
+    }
+    palette_map->palette = pal;
+    return palette_map;
+}
+
+static SDL_INLINE void GetCellDistance(int value, int lo, int size, Uint32 *dmin, Uint32 *dmax)
+{
+    const int hi = lo + size - 1;
+    const int near_d = (value < lo) ? (lo - value) : (value > hi) ? (value - hi) : 0;
+    const int far_d = SDL_max(value - lo, hi - value);
+    *dmin += (Uint32)(near_d * near_d);
+    *dmax += (Uint32)(far_d * far_d);
+}
+
+static bool BuildPaletteMapCell(SDL_PaletteMap *palette_map, SDL_PaletteMapCell *cell, int r, int g, int b, int a, int alpha_size)
+{
+    const SDL_Color *colors = palette_map->palette->colors;
+    const int ncolors = palette_map->palette->ncolors;
+    const int rgb_size = (1 << PALETTE_MAP_RGB_SHIFT);
+    Uint32 dmin[256];
+    Uint32 best_max = ~0U;
+    Uint32 count = 0;
+    int i;
+
+    for (i = 0; i < ncolors; ++i) {
+        Uint32 dmax = 0;
+        dmin[i] = 0;
+        GetCellDistance(colors[i].r, r, rgb_size, &dmin[i], &dmax);
+        GetCellDistance(colors[i].g, g, rgb_size, &dmin[i], &dmax);
+        GetCellDistance(colors[i].b, b, rgb_size, &dmin[i], &dmax);
+        GetCellDistance(colors[i].a, a, alpha_size, &dmin[i], &dmax);
+        if (dmax < best_max) {
+            best_max = dmax;
+        }
+    }
+    for (i = 0; i < ncolors; ++i) {
+        if (dmin[i] <= best_max) {
+            ++count;
+        }
+    }
+
+    if (palette_map->num_candidates + count > palette_map->max_candidates) {
+        Uint32 new_max = SDL_max(palette_map->max_candidates * 2, 4096);
+        while (new_max < palette_map->num_candidates + count) {
+            new_max *= 2;
+        }
+        SDL_PaletteMapCandidate *candidates = (SDL_PaletteMapCandidate *)SDL_realloc(palette_map->candidates, new_max * sizeof(*candidates));
+        if (!candidates) {
+            return false;
+        }
+        palette_map->candidates = candidates;
+        palette_map->max_candidates = new_max;
+    }
+
+    cell->offset = palette_map->num_candidates;
+    cell->count = count;
+    for (i = 0; i < ncolors; ++i) {
+        if (dmin[i] <= best_max) {
+            SDL_PaletteMapCandidate *candidate = &palette_map->candidates[palette_map->num_candidates++];
+            candidate->color = colors[i];
+            candidate->index = (Uint32)i;
+        }
+    }
+    return true;
+}
+
+static Uint8 FindPaletteMapColor(SDL_PaletteMap *palette_map, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    const SDL_Palette *pal = palette_map->palette;
+    SDL_PaletteMapCell *cell;
+    const SDL_PaletteMapCandidate *candidates;
+    int alpha_cell, alpha_lo, alpha_size;
+    Uint32 best;
+    Uint32 i;
+
+    if (pal->ncolors <= 0 || pal->ncolors > 256) {
+        return SDL_FindColor(pal, r, g, b, a);
+    }
+
+    if (a == SDL_ALPHA_OPAQUE) {
+        alpha_cell = PALETTE_MAP_ALPHA_CELLS - 1;
+        alpha_lo = SDL_ALPHA_OPAQUE;
+        alpha_size = 1;
     } else {
-        Uint8 r = (Uint8)((pixelvalue >> 24) & 0xFF);
-        Uint8 g = (Uint8)((pixelvalue >> 16) & 0xFF);
-        Uint8 b = (Uint8)((pixelvalue >>  8) & 0xFF);
-        Uint8 a = (Uint8)((pixelvalue >>  0) & 0xFF);
-        color_index = SDL_FindColor(pal, r, g, b, a);
-        SDL_InsertIntoHashTable(palette_map, (const void *)(uintptr_t)pixelvalue, (const void *)(uintptr_t)color_index, true);
+        alpha_cell = (a >> PALETTE_MAP_ALPHA_SHIFT);
+        alpha_lo = (alpha_cell << PALETTE_MAP_ALPHA_SHIFT);
+        alpha_size = SDL_min(1 << PALETTE_MAP_ALPHA_SHIFT, SDL_ALPHA_OPAQUE - alpha_lo);
+    }
+    cell = &palette_map->cells[(((alpha_cell * PALETTE_MAP_RGB_CELLS +
+                                  (r >> PALETTE_MAP_RGB_SHIFT)) * PALETTE_MAP_RGB_CELLS +
+                                 (g >> PALETTE_MAP_RGB_SHIFT)) * PALETTE_MAP_RGB_CELLS) +
+                               (b >> PALETTE_MAP_RGB_SHIFT)];
+    if (cell->count == 0) {
+        const int rgb_mask = ~((1 << PALETTE_MAP_RGB_SHIFT) - 1);
+        if (!BuildPaletteMapCell(palette_map, cell, r & rgb_mask, g & rgb_mask, b & rgb_mask, alpha_lo, alpha_size)) {
+            return SDL_FindColor(pal, r, g, b, a);
+        }
+    }
+
+    /* Pack the distance and the palette index together, so the smallest value
+       is the closest color and ties go to the first entry, like SDL_FindColor() */
+    candidates = &palette_map->candidates[cell->offset];
+    best = ~0U;
+    for (i = 0; i < cell->count; ++i) {
+        const SDL_Color *color = &candidates[i].color;
+        const int rd = color->r - r;
+        const int gd = color->g - g;
+        const int bd = color->b - b;
+        const int ad = color->a - a;
+        const Uint32 distance = (Uint32)((rd * rd) + (gd * gd) + (bd * bd) + (ad * ad));
+        const Uint32 key = (distance << 8) | candidates[i].index;
+        best = SDL_min(best, key);
+    }
+    return (Uint8)(best & 0xFF);
+}
+
+Uint8 SDL_LookupRGBAColor(SDL_PaletteMap *palette_map, Uint32 pixelvalue, const SDL_Palette *pal)
+{
+    SDL_PaletteMapCacheEntry *entry;
+    Uint8 color_index;
+    Uint8 r = (Uint8)((pixelvalue >> 24) & 0xFF);
+    Uint8 g = (Uint8)((pixelvalue >> 16) & 0xFF);
+    Uint8 b = (Uint8)((pixelvalue >>  8) & 0xFF);
+    Uint8 a = (Uint8)((pixelvalue >>  0) & 0xFF);
+
+    if (!palette_map) {
+        return SDL_FindColor(pal, r, g, b, a);
+    }
+
+    entry = &palette_map->cache[(pixelvalue * 0x9E3779B1u) >> (32 - PALETTE_MAP_CACHE_BITS)];
+    if (entry->index && entry->pixel == pixelvalue) {
+        return (Uint8)(entry->index - 1);
     }
+
+    color_index = FindPaletteMapColor(palette_map, r, g, b, a);
+    entry->pixel = pixelvalue;
+    entry->index = (Uint32)color_index + 1;
     return color_index;
 }
 
+void SDL_LookupRGBAColors(SDL_PaletteMap *palette_map, const Uint32 *pixels, Uint8 *indices, int count)
+{
+    Uint32 last_pixel;
+    Uint8 last_index;
+    int i;
+
+    if (count <= 0) {
+        return;
+    }
+
+    last_pixel = pixels[0];
+    last_index = SDL_LookupRGBAColor(palette_map, last_pixel, palette_map->palette);
+    for (i = 0; i < count; ++i) {
+        const Uint32 pixel = pixels[i];
+        if (pixel != last_pixel) {
+            last_pixel = pixel;
+            last_index = SDL_LookupRGBAColor(palette_map, pixel, palette_map->palette);
+        }
+        indices[i] = last_index;
+    }
+}
+
+void SDL_DestroyPaletteMap(SDL_PaletteMap *palette_map)
+{
+    if (palette_map) {
+        SDL_free(palette_map->candidates);
+        SDL_free(palette_map);
+    }
+}
+
 // Tell whether palette is opaque, and if it has an alpha_channel
 void SDL_DetectPalette(const SDL_Palette *pal, bool *is_opaque, bool *has_alpha_channel)
 {
@@ -1475,7 +1680,7 @@ void SDL_InvalidateMap(SDL_BlitMap *map)
         map->info.table = NULL;
     }
     if (map->info.palette_map) {
-        SDL_DestroyHashTable(map->info.palette_map);
+        SDL_DestroyPaletteMap(map->info.palette_map);
         map->info.palette_map = NULL;
     }
 }
@@ -1531,7 +1736,12 @@ bool SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
     } else {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             // BitField --> Palette
-            map->info.palette_map = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+            if (dstpal) {
+                map->info.palette_map = SDL_CreatePaletteMap(dstpal);
+                if (!map->info.palette_map) {
+                    return false;
+                }
+            }
         } else {
             // BitField --> BitField
             if (srcfmt == dstfmt) {
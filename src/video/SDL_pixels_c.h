@@ -50,7 +50,10 @@ extern bool SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst);
 // Miscellaneous functions
 extern void SDL_DitherPalette(SDL_Palette *palette);
 extern Uint8 SDL_FindColor(const SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
-extern Uint8 SDL_LookupRGBAColor(SDL_HashTable *palette_map, Uint32 pixelvalue, const SDL_Palette *pal);
+extern SDL_PaletteMap *SDL_CreatePaletteMap(const SDL_Palette *pal);
+extern Uint8 SDL_LookupRGBAColor(SDL_PaletteMap *palette_map, Uint32 pixelvalue, const SDL_Palette *pal);
+extern void SDL_LookupRGBAColors(SDL_PaletteMap *palette_map, const Uint32 *pixels, Uint8 *indices, int count);
+extern void SDL_DestroyPaletteMap(SDL_PaletteMap *palette_map);
 extern void SDL_DetectPalette(const SDL_Palette *pal, bool *is_opaque, bool *has_alpha_channel);
 extern SDL_Surface *SDL_DuplicatePixels(int width, int height, SDL_PixelFormat format, SDL_Colorspace colorspace, void *pixels, int pitch);
 
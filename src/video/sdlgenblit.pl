@@ -86,6 +86,29 @@ my %set_rgba_string = (
     "BGRA8888" => "__pixel_ = (__B << 24) | (__G << 16) | (__R << 8) | __A;",
 );
 
+# The byte offsets of the B, G, R and A channels within a little-endian pixel, or -1 if missing
+my %format_offsets = (
+    "XRGB8888" => [ 0, 1, 2, -1 ],
+    "XBGR8888" => [ 2, 1, 0, -1 ],
+    "ARGB8888" => [ 0, 1, 2, 3 ],
+    "RGBA8888" => [ 1, 2, 3, 0 ],
+    "ABGR8888" => [ 2, 1, 0, 3 ],
+    "BGRA8888" => [ 3, 2, 1, 0 ],
+);
+
+# The instruction sets we generate SIMD blitters for, best first
+my @simd_isas = (
+    "AVX2",
+    "SSE41",
+    "NEON",
+);
+
+my %simd_guard = (
+    "AVX2" => "defined(SDL_AVX2_INTRINSICS)",
+    "SSE41" => "defined(SDL_SSE4_1_INTRINSICS)",
+    "NEON" => "defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)",
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Can't open $name.new: $!";
@@ -639,6 +662,416 @@ __EOF__
 __EOF__
 }
 
+sub simd_order_to_bgra
+{
+    my $format = shift;
+    my $order = 0;
+
+    # Byte i of the shuffle picks which source byte becomes channel i
+    for (my $i = 0; $i < 4; ++$i) {
+        my $offset = $format_offsets{$format}[$i];
+        $order |= (($offset < 0) ? 0x80 : $offset) << ($i * 8);
+    }
+    return sprintf("0x%08X", $order);
+}
+
+sub simd_order_from_bgra
+{
+    my $format = shift;
+    my $order = 0x80808080;
+
+    # Byte i of the shuffle picks which channel lands in byte i
+    for (my $i = 0; $i < 4; ++$i) {
+        my $offset = $format_offsets{$format}[$i];
+        if ($offset >= 0) {
+            $order &= ~(0xFF << ($offset * 8));
+            $order |= $i << ($offset * 8);
+        }
+    }
+    return sprintf("0x%08X", $order);
+}
+
+sub output_simd_kernels
+{
+    print FILE <<'__EOF__';
+/* SIMD versions of the unscaled modulate and blend blitters.
+
+   Each pixel is shuffled into B, G, R, A byte order, widened to 16 bits per
+   channel, run through the same math as the scalar blitters above (so the
+   results are identical), then narrowed and shuffled into the destination
+   order. A single kernel per instruction set handles every format pair and
+   every modulate and blend flag; the per-format wrappers only supply the
+   byte orders. */
+
+#if defined(SDL_SSE4_1_INTRINSICS) || defined(SDL_AVX2_INTRINSICS) || (defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8))
+static void SDL_GetBlit8888Modulation(const SDL_BlitInfo *info, Uint16 modulate[4])
+{
+    const int flags = info->flags;
+
+    modulate[0] = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+    modulate[1] = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+    modulate[2] = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+    modulate[3] = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+}
+#endif
+
+#ifdef SDL_SSE4_1_INTRINSICS
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888Div255_SSE41(__m128i x)
+{
+    // Same as MULT_DIV_255()
+    x = _mm_add_epi16(x, _mm_set1_epi16(1));
+    x = _mm_add_epi16(x, _mm_srli_epi16(x, 8));
+    return _mm_srli_epi16(x, 8);
+}
+
+// Modulate and blend two pixels held in 16-bit B, G, R, A lanes
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888Pixels_SSE41(__m128i s, __m128i d, __m128i modulate, int flags)
+{
+    const int blend = (flags & SDL_COPY_BLEND_MASK);
+    __m128i sa, inv_sa;
+
+    if (flags & SDL_COPY_MODULATE_MASK) {
+        s = SDL_Blit8888Div255_SSE41(_mm_mullo_epi16(s, modulate));
+    }
+    if (!blend) {
+        return s;
+    }
+
+    sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xFF), 0xFF);
+    inv_sa = _mm_sub_epi16(_mm_set1_epi16(255), sa);
+    if (blend & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+        // Premultiply the color channels, leaving alpha alone
+        s = _mm_blend_epi16(SDL_Blit8888Div255_SSE41(_mm_mullo_epi16(s, sa)), s, 0x88);
+    }
+
+    // Results over 255 are clamped when the pixels are packed back into bytes
+    switch (blend) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        return _mm_add_epi16(SDL_Blit8888Div255_SSE41(_mm_mullo_epi16(d, inv_sa)), s);
+    case SDL_COPY_ADD:
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        return _mm_blend_epi16(_mm_add_epi16(s, d), d, 0x88);
+    case SDL_COPY_MOD:
+        return _mm_blend_epi16(SDL_Blit8888Div255_SSE41(_mm_mullo_epi16(s, d)), d, 0x88);
+    case SDL_COPY_MUL:
+        return _mm_blend_epi16(_mm_add_epi16(SDL_Blit8888Div255_SSE41(_mm_mullo_epi16(s, d)),
+                                             SDL_Blit8888Div255_SSE41(_mm_mullo_epi16(d, inv_sa))), d, 0x88);
+    default:
+        return d;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit8888_SSE41(SDL_BlitInfo *info, Uint32 src_order, Uint32 src_alpha, Uint32 dst_order, Uint32 out_order)
+{
+    const int flags = info->flags;
+    const __m128i offsets = _mm_set_epi8(12, 12, 12, 12, 8, 8, 8, 8, 4, 4, 4, 4, 0, 0, 0, 0);
+    const __m128i src_shuffle = _mm_add_epi8(_mm_set1_epi32((int)src_order), offsets);
+    const __m128i dst_shuffle = _mm_add_epi8(_mm_set1_epi32((int)dst_order), offsets);
+    const __m128i out_shuffle = _mm_add_epi8(_mm_set1_epi32((int)out_order), offsets);
+    const __m128i alpha_fill = _mm_set1_epi32((int)src_alpha);
+    const __m128i zero = _mm_setzero_si128();
+    Uint16 m[4];
+    __m128i modulate;
+
+    SDL_GetBlit8888Modulation(info, m);
+    modulate = _mm_set_epi16(m[3], m[2], m[1], m[0], m[3], m[2], m[1], m[0]);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            Uint32 srcbuf[4], dstbuf[4];
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            __m128i src128, dst128 = zero;
+            __m128i lo, hi;
+
+            if (n < 4) {
+                // Run the last few pixels through a temporary buffer
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+                SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            src128 = _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)s), src_shuffle), alpha_fill);
+            if (flags & SDL_COPY_BLEND_MASK) {
+                dst128 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)d), dst_shuffle);
+            }
+            lo = SDL_Blit8888Pixels_SSE41(_mm_unpacklo_epi8(src128, zero), _mm_unpacklo_epi8(dst128, zero), modulate, flags);
+            hi = SDL_Blit8888Pixels_SSE41(_mm_unpackhi_epi8(src128, zero), _mm_unpackhi_epi8(dst128, zero), modulate, flags);
+            _mm_storeu_si128((__m128i *)d, _mm_shuffle_epi8(_mm_packus_epi16(lo, hi), out_shuffle));
+
+            if (n < 4) {
+                SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif // SDL_SSE4_1_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888Div255_AVX2(__m256i x)
+{
+    // Same as MULT_DIV_255()
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(1));
+    x = _mm256_add_epi16(x, _mm256_srli_epi16(x, 8));
+    return _mm256_srli_epi16(x, 8);
+}
+
+// Modulate and blend four pixels held in 16-bit B, G, R, A lanes
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888Pixels_AVX2(__m256i s, __m256i d, __m256i modulate, int flags)
+{
+    const int blend = (flags & SDL_COPY_BLEND_MASK);
+    __m256i sa, inv_sa;
+
+    if (flags & SDL_COPY_MODULATE_MASK) {
+        s = SDL_Blit8888Div255_AVX2(_mm256_mullo_epi16(s, modulate));
+    }
+    if (!blend) {
+        return s;
+    }
+
+    sa = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, 0xFF), 0xFF);
+    inv_sa = _mm256_sub_epi16(_mm256_set1_epi16(255), sa);
+    if (blend & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+        // Premultiply the color channels, leaving alpha alone
+        s = _mm256_blend_epi16(SDL_Blit8888Div255_AVX2(_mm256_mullo_epi16(s, sa)), s, 0x88);
+    }
+
+    // Results over 255 are clamped when the pixels are packed back into bytes
+    switch (blend) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        return _mm256_add_epi16(SDL_Blit8888Div255_AVX2(_mm256_mullo_epi16(d, inv_sa)), s);
+    case SDL_COPY_ADD:
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        return _mm256_blend_epi16(_mm256_add_epi16(s, d), d, 0x88);
+    case SDL_COPY_MOD:
+        return _mm256_blend_epi16(SDL_Blit8888Div255_AVX2(_mm256_mullo_epi16(s, d)), d, 0x88);
+    case SDL_COPY_MUL:
+        return _mm256_blend_epi16(_mm256_add_epi16(SDL_Blit8888Div255_AVX2(_mm256_mullo_epi16(s, d)),
+                                                   SDL_Blit8888Div255_AVX2(_mm256_mullo_epi16(d, inv_sa))), d, 0x88);
+    default:
+        return d;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit8888_AVX2(SDL_BlitInfo *info, Uint32 src_order, Uint32 src_alpha, Uint32 dst_order, Uint32 out_order)
+{
+    const int flags = info->flags;
+    // The shuffles work within each 128-bit half, so the offsets repeat
+    const __m256i offsets = _mm256_set_epi8(12, 12, 12, 12, 8, 8, 8, 8, 4, 4, 4, 4, 0, 0, 0, 0,
+                                            12, 12, 12, 12, 8, 8, 8, 8, 4, 4, 4, 4, 0, 0, 0, 0);
+    const __m256i src_shuffle = _mm256_add_epi8(_mm256_set1_epi32((int)src_order), offsets);
+    const __m256i dst_shuffle = _mm256_add_epi8(_mm256_set1_epi32((int)dst_order), offsets);
+    const __m256i out_shuffle = _mm256_add_epi8(_mm256_set1_epi32((int)out_order), offsets);
+    const __m256i alpha_fill = _mm256_set1_epi32((int)src_alpha);
+    const __m256i zero = _mm256_setzero_si256();
+    Uint16 m[4];
+    __m256i modulate;
+
+    SDL_GetBlit8888Modulation(info, m);
+    modulate = _mm256_set_epi16(m[3], m[2], m[1], m[0], m[3], m[2], m[1], m[0],
+                                m[3], m[2], m[1], m[0], m[3], m[2], m[1], m[0]);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            Uint32 srcbuf[8], dstbuf[8];
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            __m256i src256, dst256 = zero;
+            __m256i lo, hi;
+
+            if (n < 8) {
+                // Run the last few pixels through a temporary buffer
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+                SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            src256 = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)s), src_shuffle), alpha_fill);
+            if (flags & SDL_COPY_BLEND_MASK) {
+                dst256 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)d), dst_shuffle);
+            }
+            lo = SDL_Blit8888Pixels_AVX2(_mm256_unpacklo_epi8(src256, zero), _mm256_unpacklo_epi8(dst256, zero), modulate, flags);
+            hi = SDL_Blit8888Pixels_AVX2(_mm256_unpackhi_epi8(src256, zero), _mm256_unpackhi_epi8(dst256, zero), modulate, flags);
+            _mm256_storeu_si256((__m256i *)d, _mm256_shuffle_epi8(_mm256_packus_epi16(lo, hi), out_shuffle));
+
+            if (n < 8) {
+                SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif // SDL_AVX2_INTRINSICS
+
+#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)
+
+static SDL_INLINE uint16x8_t SDL_Blit8888Div255_NEON(uint16x8_t x)
+{
+    // Same as MULT_DIV_255()
+    x = vaddq_u16(x, vdupq_n_u16(1));
+    x = vsraq_n_u16(x, x, 8);
+    return vshrq_n_u16(x, 8);
+}
+
+// Modulate and blend two pixels held in 16-bit B, G, R, A lanes
+static SDL_INLINE uint16x8_t SDL_Blit8888Pixels_NEON(uint16x8_t s, uint16x8_t d, uint16x8_t modulate, uint16x8_t alpha_lanes, int flags)
+{
+    const int blend = (flags & SDL_COPY_BLEND_MASK);
+    uint16x8_t sa, inv_sa;
+
+    if (flags & SDL_COPY_MODULATE_MASK) {
+        s = SDL_Blit8888Div255_NEON(vmulq_u16(s, modulate));
+    }
+    if (!blend) {
+        return s;
+    }
+
+    sa = vcombine_u16(vdup_lane_u16(vget_low_u16(s), 3), vdup_lane_u16(vget_high_u16(s), 3));
+    inv_sa = vsubq_u16(vdupq_n_u16(255), sa);
+    if (blend & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+        // Premultiply the color channels, leaving alpha alone
+        s = vbslq_u16(alpha_lanes, s, SDL_Blit8888Div255_NEON(vmulq_u16(s, sa)));
+    }
+
+    // Results over 255 are clamped when the pixels are narrowed back into bytes
+    switch (blend) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        return vaddq_u16(SDL_Blit8888Div255_NEON(vmulq_u16(d, inv_sa)), s);
+    case SDL_COPY_ADD:
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        return vbslq_u16(alpha_lanes, d, vaddq_u16(s, d));
+    case SDL_COPY_MOD:
+        return vbslq_u16(alpha_lanes, d, SDL_Blit8888Div255_NEON(vmulq_u16(s, d)));
+    case SDL_COPY_MUL:
+        return vbslq_u16(alpha_lanes, d, vaddq_u16(SDL_Blit8888Div255_NEON(vmulq_u16(s, d)),
+                                                   SDL_Blit8888Div255_NEON(vmulq_u16(d, inv_sa))));
+    default:
+        return d;
+    }
+}
+
+static void SDL_Blit8888_NEON(SDL_BlitInfo *info, Uint32 src_order, Uint32 src_alpha, Uint32 dst_order, Uint32 out_order)
+{
+    const int flags = info->flags;
+    const uint8x16_t offsets = vreinterpretq_u8_u64(vcombine_u64(
+        vcreate_u64(0x0404040400000000), vcreate_u64(0x0c0c0c0c08080808)));
+    const uint8x16_t src_shuffle = vaddq_u8(vreinterpretq_u8_u32(vdupq_n_u32(src_order)), offsets);
+    const uint8x16_t dst_shuffle = vaddq_u8(vreinterpretq_u8_u32(vdupq_n_u32(dst_order)), offsets);
+    const uint8x16_t out_shuffle = vaddq_u8(vreinterpretq_u8_u32(vdupq_n_u32(out_order)), offsets);
+    const uint8x16_t alpha_fill = vreinterpretq_u8_u32(vdupq_n_u32(src_alpha));
+    const uint16x8_t alpha_lanes = vreinterpretq_u16_u64(vdupq_n_u64(0xFFFF000000000000ULL));
+    Uint16 m[8];
+    uint16x8_t modulate;
+
+    SDL_GetBlit8888Modulation(info, m);
+    SDL_memcpy(&m[4], &m[0], 4 * sizeof(Uint16));
+    modulate = vld1q_u16(m);
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        while (n > 0) {
+            Uint32 srcbuf[4], dstbuf[4];
+            const Uint32 *s = src;
+            Uint32 *d = dst;
+            uint8x16_t src128, dst128 = vdupq_n_u8(0);
+            uint16x8_t lo, hi;
+
+            if (n < 4) {
+                // Run the last few pixels through a temporary buffer
+                SDL_zeroa(srcbuf);
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+                SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+                s = srcbuf;
+                d = dstbuf;
+            }
+
+            src128 = vorrq_u8(vqtbl1q_u8(vld1q_u8((const Uint8 *)s), src_shuffle), alpha_fill);
+            if (flags & SDL_COPY_BLEND_MASK) {
+                dst128 = vqtbl1q_u8(vld1q_u8((const Uint8 *)d), dst_shuffle);
+            }
+            lo = SDL_Blit8888Pixels_NEON(vmovl_u8(vget_low_u8(src128)), vmovl_u8(vget_low_u8(dst128)), modulate, alpha_lanes, flags);
+            hi = SDL_Blit8888Pixels_NEON(vmovl_u8(vget_high_u8(src128)), vmovl_u8(vget_high_u8(dst128)), modulate, alpha_lanes, flags);
+            vst1q_u8((Uint8 *)d, vqtbl1q_u8(vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)), out_shuffle));
+
+            if (n < 4) {
+                SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+                break;
+            }
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif // SDL_NEON_INTRINSICS
+
+__EOF__
+}
+
+sub output_simd_funcs
+{
+    my $isa = shift;
+
+    print FILE "#if $simd_guard{$isa}\n\n";
+    for (my $i = 0; $i <= $#src_formats; ++$i) {
+        my $src = $src_formats[$i];
+        my $src_order = simd_order_to_bgra($src);
+        my $src_alpha = ($src =~ /A/) ? "0x00000000" : "0xFF000000";
+        for (my $j = 0; $j <= $#dst_formats; ++$j) {
+            my $dst = $dst_formats[$j];
+            my $dst_order = simd_order_to_bgra($dst);
+            my $out_order = simd_order_from_bgra($dst);
+            output_copyfuncname("static void", $src, $dst, 1, 1, 0, 0, "_$isa(SDL_BlitInfo *info)\n");
+            print FILE <<__EOF__;
+{
+    SDL_Blit8888_$isa(info, $src_order, $src_alpha, $dst_order, $out_order);
+}
+
+__EOF__
+        }
+    }
+    print FILE "#endif\n\n";
+}
+
 sub output_copyfunc_h
 {
 }
@@ -665,6 +1098,16 @@ sub output_copyfunctable
     print FILE <<__EOF__;
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
 __EOF__
+    foreach my $isa (@simd_isas) {
+        print FILE "#if $simd_guard{$isa}\n";
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                print FILE "    { SDL_PIXELFORMAT_$src_formats[$i], SDL_PIXELFORMAT_$dst_formats[$j], (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_$isa,";
+                output_copyfuncname("", $src_formats[$i], $dst_formats[$j], 1, 1, 0, 0, "_$isa },\n");
+            }
+        }
+        print FILE "#endif\n";
+    }
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -752,5 +1195,9 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simd_kernels();
+foreach my $isa (@simd_isas) {
+    output_simd_funcs($isa);
+}
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
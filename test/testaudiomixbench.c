@@ -0,0 +1,274 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how long a playback device takes to mix many bound streams each
+   period, using the dummy audio driver running as fast as it can, for
+   streams that need a gain change, a format conversion and resampling.
+   Also checks that the streams add up to the expected mix. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_STREAMS 256
+#define SAMPLE_FRAMES 1024
+#define WARMUP_PERIODS 10
+
+typedef struct MixCase
+{
+    const char *name;
+    SDL_AudioFormat format;
+    int freq;
+} MixCase;
+
+static const MixCase cases[] = {
+    { "F32 48000Hz, gain", SDL_AUDIO_F32, 48000 },
+    { "S16 48000Hz, gain", SDL_AUDIO_S16, 48000 },
+    { "F32 44100Hz, gain + resample", SDL_AUDIO_F32, 44100 }
+};
+
+static const SDL_AudioSpec device_spec = { SDL_AUDIO_F32, 2, 48000 };
+
+/* Streams are fed from these without copying */
+typedef struct Feed
+{
+    Uint8 *data;
+    int len;
+} Feed;
+
+static Feed noise;
+static Feed positive, negative;
+
+static SDL_AtomicInt periods;
+static int total_periods;
+static Uint64 start_ticks, end_ticks;
+static SDL_AtomicInt done;
+static SDL_AudioStream *clock_stream;
+
+static float expected_sample;
+static SDL_AtomicInt wrong_samples;
+
+static void SDLCALL feed_stream(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    const Feed *feed = (const Feed *)userdata;
+
+    (void)total_amount;
+
+    /* The first stream keeps time for the whole mix */
+    if (stream == clock_stream) {
+        const int period = SDL_AddAtomicInt(&periods, 1) + 1;
+        if (period == WARMUP_PERIODS) {
+            start_ticks = SDL_GetTicksNS();
+        } else if (period == WARMUP_PERIODS + total_periods) {
+            end_ticks = SDL_GetTicksNS();
+            SDL_SetAtomicInt(&done, 1);
+        }
+    }
+
+    while (additional_amount > 0) {
+        const int len = SDL_min(additional_amount, feed->len);
+        SDL_PutAudioStreamDataNoCopy(stream, feed->data, len, NULL, NULL);
+        additional_amount -= len;
+    }
+}
+
+static void SDLCALL check_mix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    const int num_samples = buflen / (int)sizeof(float);
+    int i;
+
+    (void)userdata;
+    (void)spec;
+    for (i = 0; i < num_samples; ++i) {
+        if (SDL_fabsf(buffer[i] - expected_sample) > 0.0001f) {
+            SDL_AddAtomicInt(&wrong_samples, 1);
+        }
+    }
+}
+
+/* One second of audio in the given format, either noise or a constant */
+static bool fill_feed(Feed *feed, const SDL_AudioSpec *spec, Uint64 *seed, float constant)
+{
+    const int num_samples = spec->freq * spec->channels;
+    int i;
+
+    feed->len = num_samples * SDL_AUDIO_BYTESIZE(spec->format);
+    feed->data = (Uint8 *)SDL_realloc(feed->data, feed->len);
+    if (!feed->data) {
+        return false;
+    }
+    for (i = 0; i < num_samples; ++i) {
+        const float sample = seed ? (SDL_randf_r(seed) - 0.5f) : constant;
+        if (spec->format == SDL_AUDIO_S16) {
+            ((Sint16 *)feed->data)[i] = (Sint16)(sample * 32767.0f);
+        } else {
+            ((float *)feed->data)[i] = sample;
+        }
+    }
+    return true;
+}
+
+/* Binds streams to a fresh logical device and waits until it's mixed enough periods.
+   The first half of the streams play `feeds[0]` and the rest play `feeds[1]`. */
+static bool mix_streams(int num_streams, const SDL_AudioSpec *src_spec, Feed *feeds[2], float gain, SDL_AudioPostmixCallback postmix, double *ns_per_period)
+{
+    SDL_AudioStream *streams[MAX_STREAMS];
+    SDL_AudioDeviceID device;
+    bool result = true;
+    int i;
+
+    SDL_zeroa(streams);
+    SDL_SetAtomicInt(&periods, 0);
+    SDL_SetAtomicInt(&done, 0);
+    clock_stream = NULL;
+
+    device = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &device_spec);
+    if (!device) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open audio device: %s", SDL_GetError());
+        return false;
+    }
+    SDL_PauseAudioDevice(device);
+    if (postmix) {
+        SDL_SetAudioPostmixCallback(device, postmix, NULL);
+    }
+
+    for (i = 0; i < num_streams; ++i) {
+        streams[i] = SDL_CreateAudioStream(src_spec, NULL);
+        if (!streams[i] ||
+            !SDL_SetAudioStreamGain(streams[i], gain) ||
+            !SDL_SetAudioStreamGetCallback(streams[i], feed_stream, feeds[(i < num_streams / 2) ? 0 : 1]) ||
+            !SDL_BindAudioStream(device, streams[i])) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up audio stream: %s", SDL_GetError());
+            result = false;
+            break;
+        }
+    }
+
+    if (result) {
+        clock_stream = streams[0];
+        SDL_ResumeAudioDevice(device);
+        while (!SDL_GetAtomicInt(&done)) {
+            SDL_Delay(10);
+        }
+        *ns_per_period = (double)(end_ticks - start_ticks) / total_periods;
+    }
+
+    SDL_CloseAudioDevice(device);
+    for (i = 0; i < num_streams; ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    return result;
+}
+
+static int run_case(const MixCase *mix, int num_streams, Uint64 *seed)
+{
+    const SDL_AudioSpec src_spec = { mix->format, 2, mix->freq };
+    Feed *feeds[2] = { &noise, &noise };
+    double ns_per_period;
+
+    if (!fill_feed(&noise, &src_spec, seed, 0.0f) ||
+        !mix_streams(num_streams, &src_spec, feeds, 0.5f, NULL, &ns_per_period)) {
+        return 1;
+    }
+
+    SDL_Log("%3d streams, %-30s %8.1f us per %d-frame period, %5.2f ns per stream sample",
+            num_streams, mix->name, ns_per_period / 1000.0, SAMPLE_FRAMES,
+            ns_per_period / ((double)num_streams * SAMPLE_FRAMES * device_spec.channels));
+    return 0;
+}
+
+/* Half the streams play a positive constant and half play the same negative one. Each half adds
+   up to more than full scale, but the mix should come out as (nearly) silence before it's clamped. */
+static int check_sum(int num_streams)
+{
+    const SDL_AudioSpec src_spec = { SDL_AUDIO_F32, 2, 48000 };
+    const float value = 4.0f / num_streams;
+    Feed *feeds[2] = { &positive, &negative };
+    double ns_per_period;
+
+    if (num_streams < 2) {
+        return 0;
+    }
+    if (!fill_feed(&positive, &src_spec, NULL, value) || !fill_feed(&negative, &src_spec, NULL, -value)) {
+        return 1;
+    }
+
+    expected_sample = value * ((num_streams / 2) - (num_streams - (num_streams / 2)));
+    SDL_SetAtomicInt(&wrong_samples, 0);
+    if (!mix_streams(num_streams, &src_spec, feeds, 1.0f, check_mix, &ns_per_period)) {
+        return 1;
+    }
+    if (SDL_GetAtomicInt(&wrong_samples)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d mixed samples were wrong", SDL_GetAtomicInt(&wrong_samples));
+        return 1;
+    }
+    SDL_Log("%3d streams add up to the expected mix", num_streams);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint64 seed = 0;
+    int num_streams = 64;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    total_periods = 500;
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--streams") == 0 && argv[i + 1]) {
+                num_streams = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_STREAMS);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--periods") == 0 && argv[i + 1]) {
+                total_periods = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--mix-threads") == 0 && argv[i + 1]) {
+                SDL_SetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS, argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--streams N]", "[--periods N]", "[--mix-threads N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    /* Run the device as fast as it will go, so the time taken is all mixing */
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    SDL_SetHint(SDL_HINT_AUDIO_DUMMY_TIMESCALE, "0");
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES, "1024");
+    if (!SDL_Init(SDL_INIT_AUDIO)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    result |= check_sum(num_streams);
+    for (i = 0; i < (int)SDL_arraysize(cases) && result == 0; ++i) {
+        result |= run_case(&cases[i], num_streams, &seed);
+    }
+
+    SDL_free(noise.data);
+    SDL_free(positive.data);
+    SDL_free(negative.data);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
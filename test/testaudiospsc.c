@@ -0,0 +1,302 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how long a thread reading from an audio stream, standing in for
+   the audio device thread, waits in SDL_GetAudioStreamData while another
+   thread keeps putting small buffers into the same stream. Runs with the
+   stream's usual lock, then with SDL_SetAudioStreamSingleProducer, optionally
+   with extra busy threads so the producer gets preempted while it works.
+   The producer switches between mono and stereo as it goes, and the reader
+   checks that every frame comes out once, in order. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define FREQ 48000
+#define PERIOD_FRAMES 1024
+#define FORMAT_CHANGE_PUTS 64
+
+static const SDL_AudioSpec dst_spec = { SDL_AUDIO_S32, 2, FREQ };
+
+static SDL_AudioStream *stream;
+static int total_frames;
+static int put_frames;
+static int period_us;
+static SDL_AtomicInt stop_load;
+static SDL_AtomicInt stop_producer;
+static SDL_AtomicInt producer_failed;
+
+/* Each frame holds its index, so the reader can tell if any went missing */
+static Sint32 frame_value(int frame)
+{
+    return (Sint32)((Uint32)(frame % 65536) << 16);
+}
+
+static int SDLCALL load_thread(void *data)
+{
+    volatile Uint64 counter = 0;
+
+    (void)data;
+    while (!SDL_GetAtomicInt(&stop_load)) {
+        ++counter;
+    }
+    return 0;
+}
+
+static int SDLCALL producer_thread(void *data)
+{
+    const bool single_producer = *(const bool *)data;
+    /* Without the ring, keep about as much queued as the ring would hold */
+    const int max_queued = PERIOD_FRAMES * 4;
+    Sint32 *buf = (Sint32 *)SDL_malloc(put_frames * 2 * sizeof(Sint32));
+    int frame = 0;
+    int puts = 0;
+
+    if (!buf) {
+        SDL_SetAtomicInt(&producer_failed, 1);
+        return 1;
+    }
+
+    while (frame < total_frames && !SDL_GetAtomicInt(&stop_producer)) {
+        const int channels = ((puts / FORMAT_CHANGE_PUTS) % 2) ? 1 : 2;
+        const int frames = SDL_min(put_frames, total_frames - frame);
+        int i, j;
+
+        if ((puts % FORMAT_CHANGE_PUTS) == 0) {
+            const SDL_AudioSpec src_spec = { SDL_AUDIO_S32, channels, FREQ };
+            if (!SDL_SetAudioStreamFormat(stream, &src_spec, NULL)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't change stream format: %s", SDL_GetError());
+                SDL_SetAtomicInt(&producer_failed, 1);
+                break;
+            }
+        }
+
+        for (i = 0; i < frames; ++i) {
+            for (j = 0; j < channels; ++j) {
+                buf[i * channels + j] = frame_value(frame + i);
+            }
+        }
+
+        if (!single_producer) {
+            while (SDL_GetAudioStreamQueued(stream) > max_queued * (int)sizeof(Sint32) * 2 && !SDL_GetAtomicInt(&stop_producer)) {
+                SDL_DelayNS(50000);
+            }
+        }
+
+        /* A single producer finds out the ring is full when it tries to put */
+        while (!SDL_PutAudioStreamData(stream, buf, frames * channels * (int)sizeof(Sint32))) {
+            if (SDL_GetAtomicInt(&stop_producer)) {
+                break;
+            } else if (!single_producer) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't put audio data: %s", SDL_GetError());
+                SDL_SetAtomicInt(&producer_failed, 1);
+                SDL_free(buf);
+                return 1;
+            }
+            SDL_DelayNS(50000);
+        }
+
+        frame += frames;
+        ++puts;
+    }
+
+    SDL_FlushAudioStream(stream);
+    SDL_free(buf);
+    return 0;
+}
+
+static int SDLCALL compare_latency(const void *a, const void *b)
+{
+    const Uint64 x = *(const Uint64 *)a;
+    const Uint64 y = *(const Uint64 *)b;
+    return (x < y) ? -1 : (x > y) ? 1 : 0;
+}
+
+static int run_case(bool single_producer, int num_load_threads)
+{
+    /* Give up if the reader is starved for this long, and only keep this many latencies */
+    const Uint64 timeout_ns = SDL_NS_PER_SECOND * 30;
+    const int max_periods = (total_frames / PERIOD_FRAMES) * 16 + 1000;
+    Sint32 *buf = (Sint32 *)SDL_malloc(PERIOD_FRAMES * 2 * sizeof(Sint32));
+    Uint64 *latencies = (Uint64 *)SDL_calloc(max_periods, sizeof(Uint64));
+    SDL_Thread *load_threads[64];
+    SDL_Thread *producer = NULL;
+    int num_periods = 0;
+    Uint64 worst = 0;
+    Uint64 deadline;
+    int underruns = 0;
+    int frame = 0;
+    int result = 0;
+    int i;
+
+    SDL_SetAtomicInt(&stop_load, 0);
+    SDL_SetAtomicInt(&stop_producer, 0);
+    SDL_SetAtomicInt(&producer_failed, 0);
+    SDL_zeroa(load_threads);
+
+    stream = SDL_CreateAudioStream(&dst_spec, &dst_spec);
+    if (!buf || !latencies || !stream) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up: %s", SDL_GetError());
+        result = 1;
+        goto done;
+    }
+
+    if (single_producer) {
+        if (!SDL_SetAudioStreamSingleProducer(stream, PERIOD_FRAMES * 4 * (int)sizeof(Sint32) * 2)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't make the stream single producer: %s", SDL_GetError());
+            result = 1;
+            goto done;
+        }
+        if (SDL_SetAudioStreamSingleProducer(stream, 1024)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Stream was made single producer twice");
+            result = 1;
+            goto done;
+        }
+    }
+
+    for (i = 0; i < num_load_threads; ++i) {
+        load_threads[i] = SDL_CreateThread(load_thread, "load", NULL);
+    }
+    producer = SDL_CreateThread(producer_thread, "producer", &single_producer);
+    deadline = SDL_GetTicksNS() + timeout_ns;
+
+    /* Stand in for the device thread: read a period at a time, at a steady pace */
+    while (frame < total_frames && SDL_GetTicksNS() < deadline && !SDL_GetAtomicInt(&producer_failed)) {
+        const Uint64 start = SDL_GetTicksNS();
+        const int len = SDL_GetAudioStreamData(stream, buf, PERIOD_FRAMES * (int)sizeof(Sint32) * 2);
+        const int frames = SDL_max(len, 0) / ((int)sizeof(Sint32) * 2);
+        const Uint64 latency = SDL_GetTicksNS() - start;
+
+        worst = SDL_max(worst, latency);
+        if (num_periods < max_periods) {
+            latencies[num_periods++] = latency;
+        }
+
+        if (len < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't get audio data: %s", SDL_GetError());
+            result = 1;
+            break;
+        }
+        if (frames < PERIOD_FRAMES && frame + frames < total_frames) {
+            ++underruns;
+        }
+
+        for (i = 0; i < frames; ++i, ++frame) {
+            if (buf[i * 2] != frame_value(frame) || buf[i * 2 + 1] != frame_value(frame)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Frame %d came out as 0x%08x 0x%08x, expected 0x%08x",
+                             frame, (unsigned int)buf[i * 2], (unsigned int)buf[i * 2 + 1], (unsigned int)frame_value(frame));
+                result = 1;
+                break;
+            }
+        }
+        if (result) {
+            break;
+        }
+
+        SDL_DelayPrecise((Uint64)period_us * 1000);
+    }
+
+    if (!result && frame < total_frames) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only got %d of %d frames", frame, total_frames);
+        result = 1;
+    }
+
+    SDL_SetAtomicInt(&stop_producer, 1);
+    SDL_WaitThread(producer, NULL);
+    SDL_SetAtomicInt(&stop_load, 1);
+    for (i = 0; i < num_load_threads; ++i) {
+        SDL_WaitThread(load_threads[i], NULL);
+    }
+
+    if (SDL_GetAtomicInt(&producer_failed)) {
+        result = 1;
+    }
+
+    if (num_periods > 0) {
+        SDL_qsort(latencies, num_periods, sizeof(*latencies), compare_latency);
+        SDL_Log("%-15s %2d load threads: %5d periods, %4d underruns, median %7.2f us, 99.9%% %8.2f us, worst %8.2f us",
+                single_producer ? "single producer" : "locked", num_load_threads, num_periods, underruns,
+                latencies[num_periods / 2] / 1000.0,
+                latencies[SDL_min(num_periods - 1, (int)(num_periods * 0.999))] / 1000.0,
+                worst / 1000.0);
+    }
+
+done:
+    SDL_DestroyAudioStream(stream);
+    stream = NULL;
+    SDL_free(latencies);
+    SDL_free(buf);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_load_threads = -1;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    total_frames = FREQ * 2;
+    put_frames = 64;
+    period_us = 500;
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                total_frames = SDL_max(SDL_atoi(argv[i + 1]), PERIOD_FRAMES);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--put-frames") == 0 && argv[i + 1]) {
+                put_frames = SDL_clamp(SDL_atoi(argv[i + 1]), 1, PERIOD_FRAMES);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--period-us") == 0 && argv[i + 1]) {
+                period_us = SDL_max(SDL_atoi(argv[i + 1]), 0);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--load-threads") == 0 && argv[i + 1]) {
+                num_load_threads = SDL_clamp(SDL_atoi(argv[i + 1]), 0, 64);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--frames N]", "[--put-frames N]", "[--period-us N]", "[--load-threads N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* By default, keep every core busy so the producer gets preempted */
+    if (num_load_threads < 0) {
+        num_load_threads = SDL_min(SDL_GetNumLogicalCPUCores(), 64);
+    }
+
+    result |= run_case(false, 0);
+    result |= run_case(true, 0);
+    if (num_load_threads > 0) {
+        result |= run_case(false, num_load_threads);
+        result |= run_case(true, num_load_threads);
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
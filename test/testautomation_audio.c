@@ -1042,11 +1042,16 @@ static int SDLCALL audio_resampleLoss(void *arg)
     int rate_out;
     double signal_to_noise;
     double max_error;
+    SDL_AudioResampleQuality quality;
   } test_specs[] = {
-    { 50, 440, 0, 44100, 48000, 80, 0.0010 },
-    { 50, 5000, SDL_PI_D / 2, 20000, 10000, 999, 0.0001 },
-    { 50, 440, 0, 22050, 96000, 79, 0.0120 },
-    { 50, 440, 0, 96000, 22050, 80, 0.0002 },
+    { 50, 440, 0, 44100, 48000, 80, 0.0010, SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM },
+    { 50, 5000, SDL_PI_D / 2, 20000, 10000, 999, 0.0001, SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM },
+    { 50, 440, 0, 22050, 96000, 79, 0.0120, SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM },
+    { 50, 440, 0, 96000, 22050, 80, 0.0002, SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM },
+    { 50, 440, 0, 44100, 48000, 65, 0.0010, SDL_AUDIO_RESAMPLE_QUALITY_LOW },
+    { 50, 440, 0, 44100, 48000, 100, 0.0030, SDL_AUDIO_RESAMPLE_QUALITY_HIGH },
+    { 50, 440, 0, 48000, 16000, 88, 0.0200, SDL_AUDIO_RESAMPLE_QUALITY_HIGH },
+    { 50, 440, 0, 22050, 96000, 90, 0.0120, SDL_AUDIO_RESAMPLE_QUALITY_HIGH },
     { 0 }
   };
 
@@ -1080,8 +1085,8 @@ static int SDLCALL audio_resampleLoss(void *arg)
     SDL_zero(tmpspec1);
     SDL_zero(tmpspec2);
 
-    SDLTest_AssertPass("Test resampling of %i s %i Hz %f phase sine wave from sampling rate of %i Hz to %i Hz",
-                       spec->time, spec->freq, spec->phase, spec->rate_in, spec->rate_out);
+    SDLTest_AssertPass("Test resampling of %i s %i Hz %f phase sine wave from sampling rate of %i Hz to %i Hz with quality %i",
+                       spec->time, spec->freq, spec->phase, spec->rate_in, spec->rate_out, (int)spec->quality);
 
     tmpspec1.format = SDL_AUDIO_F32;
     tmpspec1.channels = num_channels;
@@ -1095,6 +1100,7 @@ static int SDLCALL audio_resampleLoss(void *arg)
     if (stream == NULL) {
       return TEST_ABORTED;
     }
+    SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, spec->quality);
 
     buf_in = (float *)SDL_malloc(len_in);
     SDLTest_AssertCheck(buf_in != NULL, "Expected input buffer to be created.");
@@ -1460,6 +1466,408 @@ cleanup:
 
     return status;
 }
+
+/* The scalar mixing that SDL_MixAudio has always done, as a reference for its SIMD versions */
+static void mixAudioReference(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, int num_samples, float fvolume)
+{
+    const int volume = (int)SDL_roundf(fvolume * 128);
+    const bool swap = (format != SDL_AUDIO_S16 && format != SDL_AUDIO_S32 && format != SDL_AUDIO_F32);
+    int i;
+
+    if (volume == 0) {
+        return;
+    }
+
+    for (i = 0; i < num_samples; i++) {
+        if (SDL_AUDIO_ISFLOAT(format)) {
+            Uint32 s, d;
+            float src_sample, dst_sample;
+            SDL_memcpy(&s, &src[i * 4], 4);
+            SDL_memcpy(&d, &dst[i * 4], 4);
+            if (swap) {
+                s = SDL_Swap32(s);
+                d = SDL_Swap32(d);
+            }
+            SDL_memcpy(&src_sample, &s, 4);
+            SDL_memcpy(&dst_sample, &d, 4);
+            src_sample *= fvolume;
+            dst_sample += src_sample;
+            if (dst_sample > 1.0f) {
+                dst_sample = 1.0f;
+            } else if (dst_sample < -1.0f) {
+                dst_sample = -1.0f;
+            }
+            SDL_memcpy(&d, &dst_sample, 4);
+            if (swap) {
+                d = SDL_Swap32(d);
+            }
+            SDL_memcpy(&dst[i * 4], &d, 4);
+        } else if (SDL_AUDIO_BITSIZE(format) == 32) {
+            Uint32 s, d;
+            Sint64 mixed;
+            SDL_memcpy(&s, &src[i * 4], 4);
+            SDL_memcpy(&d, &dst[i * 4], 4);
+            if (swap) {
+                s = SDL_Swap32(s);
+                d = SDL_Swap32(d);
+            }
+            mixed = (((Sint64)(Sint32)s * volume) / 128) + (Sint32)d;
+            d = (Uint32)(Sint32)SDL_clamp(mixed, SDL_MIN_SINT32, SDL_MAX_SINT32);
+            if (swap) {
+                d = SDL_Swap32(d);
+            }
+            SDL_memcpy(&dst[i * 4], &d, 4);
+        } else {
+            Uint16 s, d;
+            int mixed;
+            SDL_memcpy(&s, &src[i * 2], 2);
+            SDL_memcpy(&d, &dst[i * 2], 2);
+            if (swap) {
+                s = SDL_Swap16(s);
+                d = SDL_Swap16(d);
+            }
+            mixed = (Sint16)(((Sint16)s * volume) / 128) + (Sint16)d;
+            d = (Uint16)(Sint16)SDL_clamp(mixed, SDL_MIN_SINT16, SDL_MAX_SINT16);
+            if (swap) {
+                d = SDL_Swap16(d);
+            }
+            SDL_memcpy(&dst[i * 2], &d, 2);
+        }
+    }
+}
+
+static void fillMixAudioBuffer(Uint8 *buffer, SDL_AudioFormat format, int num_samples)
+{
+    int i;
+
+    if (!SDL_AUDIO_ISFLOAT(format)) {
+        for (i = 0; i < num_samples * SDL_AUDIO_BYTESIZE(format); i++) {
+            buffer[i] = SDLTest_RandomUint8();
+        }
+        return;
+    }
+
+    for (i = 0; i < num_samples; i++) {
+        float sample;
+        Uint32 bits;
+        switch (i % 16) {
+        case 0:
+            sample = 1.0f;
+            break;
+        case 1:
+            sample = -1.0f;
+            break;
+        case 2:
+            sample = -0.0f;
+            break;
+        default:
+            sample = SDLTest_RandomUnitFloat() * 4.0f - 2.0f;
+            break;
+        }
+        SDL_memcpy(&bits, &sample, 4);
+        if (format != SDL_AUDIO_F32) {
+            bits = SDL_Swap32(bits);
+        }
+        SDL_memcpy(&buffer[i * 4], &bits, 4);
+    }
+}
+
+static const SDL_AudioFormat g_mixAudioFormats[] = {
+    SDL_AUDIO_S16LE, SDL_AUDIO_S16BE, SDL_AUDIO_S32LE, SDL_AUDIO_S32BE, SDL_AUDIO_F32LE, SDL_AUDIO_F32BE
+};
+
+/**
+ * Check that SDL_MixAudio gives the same results as the scalar reference, whichever code path it takes
+ *
+ * \sa SDL_MixAudio
+ */
+static int SDLCALL audio_mixAudio(void *arg)
+{
+    static const float volumes[] = { 1.0f, 0.5f, 0.25f, 0.3f, 0.77f, 1.0f / 128, 1.0f / 512, 1.5f, 2.0f, -0.5f };
+    static const int lengths[] = { 1, 3, 7, 8, 15, 16, 17, 31, 33, 63, 257, 1031 };
+    const int max_samples = 1031 + 1;
+    Uint8 *src = (Uint8 *)SDL_malloc(max_samples * 4);
+    Uint8 *dst = (Uint8 *)SDL_malloc(max_samples * 4);
+    Uint8 *expected = (Uint8 *)SDL_malloc(max_samples * 4);
+    int f, v, l;
+
+    SDLTest_AssertCheck(src && dst && expected, "Allocate buffers");
+    if (!src || !dst || !expected) {
+        SDL_free(src);
+        SDL_free(dst);
+        SDL_free(expected);
+        return TEST_ABORTED;
+    }
+
+    for (f = 0; f < (int)SDL_arraysize(g_mixAudioFormats); f++) {
+        const SDL_AudioFormat format = g_mixAudioFormats[f];
+        const int sample_size = SDL_AUDIO_BYTESIZE(format);
+        int mismatches = 0;
+
+        for (v = 0; v < (int)SDL_arraysize(volumes); v++) {
+            for (l = 0; l < (int)SDL_arraysize(lengths); l++) {
+                const int num_samples = lengths[l];
+                /* Start one sample in, so the buffers aren't aligned */
+                Uint8 *src_samples = src + sample_size;
+                Uint8 *dst_samples = dst + sample_size;
+                bool result;
+
+                fillMixAudioBuffer(src, format, max_samples);
+                fillMixAudioBuffer(dst, format, max_samples);
+                SDL_memcpy(expected, dst, max_samples * sample_size);
+                mixAudioReference(expected + sample_size, src_samples, format, num_samples, volumes[v]);
+
+                /* A trailing partial sample is ignored */
+                result = SDL_MixAudio(dst_samples, src_samples, format, num_samples * sample_size + 1, volumes[v]);
+                if (!result || SDL_memcmp(dst, expected, max_samples * sample_size) != 0) {
+                    if (mismatches++ == 0) {
+                        SDLTest_LogError("SDL_MixAudio(%s) of %d samples at volume %f doesn't match the reference",
+                                         SDL_GetAudioFormatName(format), num_samples, volumes[v]);
+                    }
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Check SDL_MixAudio(%s) matches the reference exactly, got %d mismatches",
+                            SDL_GetAudioFormatName(format), mismatches);
+    }
+
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_free(expected);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Measure how fast SDL_MixAudio mixes each format
+ *
+ * \sa SDL_MixAudio
+ */
+static int SDLCALL audio_mixAudioThroughput(void *arg)
+{
+    const int num_samples = 16384;
+    const int iterations = 200;
+    Uint8 *src = (Uint8 *)SDL_malloc(num_samples * 4);
+    Uint8 *dst = (Uint8 *)SDL_malloc(num_samples * 4);
+    int f, i;
+
+    SDLTest_AssertCheck(src && dst, "Allocate buffers");
+    if (!src || !dst) {
+        SDL_free(src);
+        SDL_free(dst);
+        return TEST_ABORTED;
+    }
+
+    for (f = 0; f < (int)SDL_arraysize(g_mixAudioFormats); f++) {
+        const SDL_AudioFormat format = g_mixAudioFormats[f];
+        const Uint32 len = num_samples * SDL_AUDIO_BYTESIZE(format);
+        bool result = true;
+        Uint64 start, elapsed;
+
+        fillMixAudioBuffer(src, format, num_samples);
+        fillMixAudioBuffer(dst, format, num_samples);
+
+        start = SDL_GetTicksNS();
+        for (i = 0; i < iterations; i++) {
+            result &= SDL_MixAudio(dst, src, format, len, 0.5f);
+        }
+        elapsed = SDL_GetTicksNS() - start;
+
+        SDLTest_AssertCheck(result, "Check result from SDL_MixAudio(%s)", SDL_GetAudioFormatName(format));
+        SDLTest_Log("SDL_MixAudio(%s): %.2f ns per sample, %.1f MB/s", SDL_GetAudioFormatName(format),
+                    (double)elapsed / ((double)num_samples * iterations),
+                    ((double)len * iterations / (1024.0 * 1024.0)) / ((double)elapsed / SDL_NS_PER_SECOND));
+    }
+
+    SDL_free(src);
+    SDL_free(dst);
+    return TEST_COMPLETED;
+}
+
+/* What audio_postmixClamped's postmix callback has seen, written on the audio thread */
+static SDL_AtomicInt g_postmixCalls;
+static SDL_AtomicInt g_postmixLoudCalls;
+static SDL_AtomicInt g_postmixOutOfRange;
+
+static void SDLCALL audio_postmixCallback(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    const int num_samples = buflen / (int)sizeof(float);
+    bool loud = false;
+    int i;
+
+    for (i = 0; i < num_samples; i++) {
+        if (buffer[i] < -1.0f || buffer[i] > 1.0f) {
+            SDL_AddAtomicInt(&g_postmixOutOfRange, 1);
+        }
+        if (buffer[i] > 0.5f) {
+            loud = true;
+        }
+    }
+    SDL_AddAtomicInt(&g_postmixCalls, 1);
+    if (loud) {
+        SDL_AddAtomicInt(&g_postmixLoudCalls, 1);
+    }
+}
+
+/**
+ * Check that a postmix callback only sees samples from -1.0f to 1.0f, even when the streams sum past that
+ *
+ * \sa SDL_SetAudioPostmixCallback
+ */
+static int SDLCALL audio_postmixClamped(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int num_samples = 48000 * 2;
+    SDL_AudioStream *streams[2] = { NULL, NULL };
+    SDL_AudioDeviceID device;
+    float *samples;
+    Uint64 start;
+    int i;
+
+    samples = (float *)SDL_malloc(num_samples * sizeof(float));
+    SDLTest_AssertCheck(samples != NULL, "Allocate samples");
+    if (!samples) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < num_samples; i++) {
+        samples[i] = 0.75f;
+    }
+
+    device = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec);
+    SDLTest_AssertCheck(device != 0, "Validate result from SDL_OpenAudioDevice, got: %" SDL_PRIu32, device);
+    if (!device) {
+        SDL_free(samples);
+        return TEST_ABORTED;
+    }
+
+    SDL_SetAtomicInt(&g_postmixCalls, 0);
+    SDL_SetAtomicInt(&g_postmixLoudCalls, 0);
+    SDL_SetAtomicInt(&g_postmixOutOfRange, 0);
+    SDL_PauseAudioDevice(device);
+    SDLTest_AssertCheck(SDL_SetAudioPostmixCallback(device, audio_postmixCallback, NULL), "Call to SDL_SetAudioPostmixCallback");
+
+    /* Two streams at 0.75 sum to 1.5 */
+    for (i = 0; i < (int)SDL_arraysize(streams); i++) {
+        streams[i] = SDL_CreateAudioStream(&spec, &spec);
+        SDLTest_AssertCheck(streams[i] != NULL, "Validate result from SDL_CreateAudioStream");
+        if (streams[i]) {
+            SDL_PutAudioStreamData(streams[i], samples, num_samples * (int)sizeof(float));
+            SDL_BindAudioStream(device, streams[i]);
+        }
+    }
+    SDL_ResumeAudioDevice(device);
+
+    start = SDL_GetTicks();
+    while (SDL_GetAtomicInt(&g_postmixLoudCalls) < 2 && (SDL_GetTicks() - start) < 2000) {
+        SDL_Delay(10);
+    }
+    SDL_PauseAudioDevice(device);
+
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_postmixLoudCalls) > 0, "Check that the postmix callback saw the mix, got %d of %d calls",
+                        SDL_GetAtomicInt(&g_postmixLoudCalls), SDL_GetAtomicInt(&g_postmixCalls));
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_postmixOutOfRange) == 0, "Check that the postmix callback only saw samples from -1.0f to 1.0f, got %d outside",
+                        SDL_GetAtomicInt(&g_postmixOutOfRange));
+
+    SDL_CloseAudioDevice(device);
+    for (i = 0; i < (int)SDL_arraysize(streams); i++) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_free(samples);
+    return TEST_COMPLETED;
+}
+
+/* Which channels audio_mixInputChannelMap's postmix callback has heard, written on the audio thread */
+static SDL_AtomicInt g_chmapLeftCalls;
+static SDL_AtomicInt g_chmapRightCalls;
+
+static void SDLCALL audio_chmapPostmixCallback(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    const int num_frames = buflen / ((int)sizeof(float) * spec->channels);
+    bool left = false;
+    bool right = false;
+    int i;
+
+    for (i = 0; i < num_frames; i++) {
+        if (buffer[i * spec->channels] > 0.25f) {
+            left = true;
+        }
+        if (buffer[i * spec->channels + 1] > 0.25f) {
+            right = true;
+        }
+    }
+    if (left) {
+        SDL_AddAtomicInt(&g_chmapLeftCalls, 1);
+    }
+    if (right) {
+        SDL_AddAtomicInt(&g_chmapRightCalls, 1);
+    }
+}
+
+/**
+ * Check that a stream's input channel map is applied when it's mixed into a device, even when no conversion is needed
+ *
+ * \sa SDL_SetAudioStreamInputChannelMap
+ * \sa SDL_BindAudioStream
+ */
+static int SDLCALL audio_mixInputChannelMap(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int chmap[] = { 1, 0 };
+    const int num_frames = 48000;
+    SDL_AudioStream *stream = NULL;
+    SDL_AudioDeviceID device;
+    float *samples;
+    Uint64 start;
+    int i;
+
+    samples = (float *)SDL_malloc(num_frames * 2 * sizeof(float));
+    SDLTest_AssertCheck(samples != NULL, "Allocate samples");
+    if (!samples) {
+        return TEST_ABORTED;
+    }
+    /* Only the left channel is audible, until the channel map swaps it to the right */
+    for (i = 0; i < num_frames; i++) {
+        samples[i * 2] = 0.5f;
+        samples[i * 2 + 1] = 0.0f;
+    }
+
+    device = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec);
+    SDLTest_AssertCheck(device != 0, "Validate result from SDL_OpenAudioDevice, got: %" SDL_PRIu32, device);
+    if (!device) {
+        SDL_free(samples);
+        return TEST_ABORTED;
+    }
+
+    SDL_SetAtomicInt(&g_chmapLeftCalls, 0);
+    SDL_SetAtomicInt(&g_chmapRightCalls, 0);
+    SDL_PauseAudioDevice(device);
+    SDLTest_AssertCheck(SDL_SetAudioPostmixCallback(device, audio_chmapPostmixCallback, NULL), "Call to SDL_SetAudioPostmixCallback");
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    SDLTest_AssertCheck(stream != NULL, "Validate result from SDL_CreateAudioStream");
+    if (stream) {
+        SDLTest_AssertCheck(SDL_SetAudioStreamInputChannelMap(stream, chmap, SDL_arraysize(chmap)), "Call to SDL_SetAudioStreamInputChannelMap");
+        SDL_PutAudioStreamData(stream, samples, num_frames * 2 * (int)sizeof(float));
+        SDL_BindAudioStream(device, stream);
+    }
+    SDL_ResumeAudioDevice(device);
+
+    start = SDL_GetTicks();
+    while (SDL_GetAtomicInt(&g_chmapRightCalls) < 2 && (SDL_GetTicks() - start) < 2000) {
+        SDL_Delay(10);
+    }
+    SDL_PauseAudioDevice(device);
+
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_chmapRightCalls) > 0, "Check that the mix had the left input on the right channel, got %d calls",
+                        SDL_GetAtomicInt(&g_chmapRightCalls));
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_chmapLeftCalls) == 0, "Check that the mix had nothing on the left channel, got %d calls",
+                        SDL_GetAtomicInt(&g_chmapLeftCalls));
+
+    SDL_CloseAudioDevice(device);
+    SDL_DestroyAudioStream(stream);
+    SDL_free(samples);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1541,13 +1949,30 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_mixAudio, "audio_mixAudio", "Check SDL_MixAudio matches the scalar reference exactly.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_mixAudioThroughput, "audio_mixAudioThroughput", "Measure SDL_MixAudio throughput for each format.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_postmixClamped, "audio_postmixClamped", "Check that postmix callbacks get a clamped mix.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_mixInputChannelMap, "audio_mixInputChannelMap", "Check that mixing a bound stream applies its input channel map.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTestGetAudioFormatName,
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21,
+    &audioTest22, NULL
 };
 
 /* Audio test suite (global) */
@@ -203,6 +203,114 @@ static int SDLCALL events_addDelEventWatchWithUserdata(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Event filter that drops user events with an odd code and counts what it sees */
+static int g_batchWatchCount;
+static int g_batchSentinelCount;
+
+static bool SDLCALL events_dropOddUserEventFilter(void *userdata, SDL_Event *event)
+{
+    if (event->type != SDL_EVENT_USER) {
+        return true;
+    }
+    return (event->user.code % 2) == 0;
+}
+
+static bool SDLCALL events_countUserEventWatch(void *userdata, SDL_Event *event)
+{
+    if (event->type == SDL_EVENT_USER) {
+        ++g_batchWatchCount;
+    } else if (event->type == SDL_EVENT_POLL_SENTINEL) {
+        ++g_batchSentinelCount;
+    }
+    return true;
+}
+
+/**
+ * Pushes a batch of events through the filter and watchers.
+ *
+ * \sa SDL_PushEvents
+ * \sa SDL_SetEventFilter
+ */
+static int SDLCALL events_pushEventsBatch(void *arg)
+{
+    SDL_Event events[64];
+    SDL_Event event_out;
+    int result;
+    int i;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    for (i = 0; i < (int)SDL_arraysize(events); ++i) {
+        SDL_zero(events[i]);
+        events[i].type = SDL_EVENT_USER;
+        events[i].user.code = i;
+    }
+    events[5].common.timestamp = 12345;
+
+    /* Without a filter every event goes in, in order */
+    result = SDL_PushEvents(events, SDL_arraysize(events));
+    SDLTest_AssertPass("Call to SDL_PushEvents()");
+    SDLTest_AssertCheck(result == (int)SDL_arraysize(events), "Check result from SDL_PushEvents, expected: %d, got: %d", (int)SDL_arraysize(events), result);
+    SDLTest_AssertCheck(events[0].common.timestamp != 0, "Check that a missing timestamp was filled in");
+    SDLTest_AssertCheck(events[5].common.timestamp == 12345, "Check that an existing timestamp was kept");
+    for (i = 0; i < (int)SDL_arraysize(events); ++i) {
+        result = SDL_PeepEvents(&event_out, 1, SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+        if (result != 1 || event_out.user.code != i) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i == (int)SDL_arraysize(events), "Check that all events came out in order, got %d", i);
+
+    /* With a filter, rejected events are removed and never reach the watchers */
+    for (i = 0; i < (int)SDL_arraysize(events); ++i) {
+        events[i].user.code = i;
+    }
+    g_batchWatchCount = 0;
+    SDL_SetEventFilter(events_dropOddUserEventFilter, NULL);
+    SDL_AddEventWatch(events_countUserEventWatch, NULL);
+    result = SDL_PushEvents(events, SDL_arraysize(events));
+    SDLTest_AssertPass("Call to SDL_PushEvents() with an event filter");
+    SDL_RemoveEventWatch(events_countUserEventWatch, NULL);
+    SDL_SetEventFilter(NULL, NULL);
+    SDLTest_AssertCheck(result == (int)SDL_arraysize(events) / 2, "Check result from SDL_PushEvents, expected: %d, got: %d", (int)SDL_arraysize(events) / 2, result);
+    SDLTest_AssertCheck(g_batchWatchCount == (int)SDL_arraysize(events) / 2, "Check the event watch count, expected: %d, got: %d", (int)SDL_arraysize(events) / 2, g_batchWatchCount);
+    for (i = 0; i < (int)SDL_arraysize(events) / 2; ++i) {
+        if (events[i].user.code != i * 2) {
+            break;
+        }
+        result = SDL_PeepEvents(&event_out, 1, SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+        if (result != 1 || event_out.user.code != i * 2) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i == (int)SDL_arraysize(events) / 2, "Check that the accepted events were compacted and queued in order, got %d", i);
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER), "Check that no filtered events were queued");
+
+    /* The poll sentinel is queued without being filtered or watched, the same as with SDL_PushEvent() */
+    events[1].type = SDL_EVENT_POLL_SENTINEL;
+    g_batchWatchCount = 0;
+    g_batchSentinelCount = 0;
+    SDL_SetEventFilter(events_dropOddUserEventFilter, NULL);
+    SDL_AddEventWatch(events_countUserEventWatch, NULL);
+    result = SDL_PushEvents(events, 3);
+    SDL_RemoveEventWatch(events_countUserEventWatch, NULL);
+    SDL_SetEventFilter(NULL, NULL);
+    SDLTest_AssertCheck(result == 3, "Check result from SDL_PushEvents with a poll sentinel, expected: 3, got: %d", result);
+    SDLTest_AssertCheck(g_batchSentinelCount == 0, "Check that the watcher didn't see the poll sentinel, got: %d", g_batchSentinelCount);
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_POLL_SENTINEL), "Check that the poll sentinel was queued");
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* Bad parameters */
+    result = SDL_PushEvents(NULL, 1);
+    SDLTest_AssertCheck(result == -1, "Check result from SDL_PushEvents(NULL), expected: -1, got: %d", result);
+    result = SDL_PushEvents(events, 0);
+    SDLTest_AssertCheck(result == 0, "Check result from SDL_PushEvents(events, 0), expected: 0, got: %d", result);
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Runs callbacks on the main thread.
  *
@@ -323,6 +431,10 @@ static const SDLTest_TestCaseReference eventsTest_addDelEventWatchWithUserdata =
     events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_pushEventsBatch = {
+    events_pushEventsBatch, "events_pushEventsBatch", "Pushes a batch of events through the event filter and watchers", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
     events_mainThreadCallbacks, "events_mainThreadCallbacks", "Run callbacks on the main thread", TEST_ENABLED
 };
@@ -332,6 +444,7 @@ static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
+    &eventsTest_pushEventsBatch,
     &eventsTest_mainThreadCallbacks,
     NULL
 };
@@ -382,6 +382,167 @@ static int SDLCALL properties_testLocking(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Counts the allocations SDL has outstanding while properties_testAtoms sets made up names */
+static SDL_malloc_func atomTestMalloc;
+static SDL_calloc_func atomTestCalloc;
+static SDL_realloc_func atomTestRealloc;
+static SDL_free_func atomTestFree;
+static SDL_AtomicInt atomTestAllocations;
+
+static void *SDLCALL countingMalloc(size_t size)
+{
+    void *mem = atomTestMalloc(size);
+    if (mem) {
+        SDL_AddAtomicInt(&atomTestAllocations, 1);
+    }
+    return mem;
+}
+
+static void *SDLCALL countingCalloc(size_t nmemb, size_t size)
+{
+    void *mem = atomTestCalloc(nmemb, size);
+    if (mem) {
+        SDL_AddAtomicInt(&atomTestAllocations, 1);
+    }
+    return mem;
+}
+
+static void *SDLCALL countingRealloc(void *ptr, size_t size)
+{
+    void *mem = atomTestRealloc(ptr, size);
+    if (mem && !ptr) {
+        SDL_AddAtomicInt(&atomTestAllocations, 1);
+    }
+    return mem;
+}
+
+static void SDLCALL countingFree(void *ptr)
+{
+    if (ptr) {
+        SDL_AddAtomicInt(&atomTestAllocations, -1);
+    }
+    atomTestFree(ptr);
+}
+
+/**
+ * Test looking up properties by atom
+ */
+static int SDLCALL properties_testAtoms(void *arg)
+{
+    SDL_PropertiesID props;
+    SDL_PropertyAtom atom, atom2, number_atom, string_atom;
+    char key[32];
+    const char *value_string;
+    Sint64 value_number;
+    float value_float;
+    bool value_bool;
+    int i, count, allocations;
+
+    atom = SDL_GetPropertyAtom("atom.test");
+    SDLTest_AssertPass("Call to SDL_GetPropertyAtom()");
+    SDLTest_AssertCheck(atom != 0,
+        "Verify atom was created, got: %" SDL_PRIu32, atom);
+    atom2 = SDL_GetPropertyAtom("atom.test");
+    SDLTest_AssertCheck(atom2 == atom,
+        "Verify the same name gives the same atom, got: %" SDL_PRIu32 ", expected %" SDL_PRIu32, atom2, atom);
+    atom2 = SDL_GetPropertyAtom("atom.other");
+    SDLTest_AssertCheck(atom2 != 0 && atom2 != atom,
+        "Verify a different name gives a different atom, got: %" SDL_PRIu32, atom2);
+    atom2 = SDL_GetPropertyAtom("");
+    SDLTest_AssertCheck(atom2 == 0,
+        "Verify an empty name has no atom, got: %" SDL_PRIu32, atom2);
+
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, "atom.test", &props);
+    SDLTest_AssertCheck(SDL_GetPointerPropertyByAtom(props, atom, NULL) == &props,
+        "Verify pointer property set by name can be read by atom");
+    SDLTest_AssertCheck(SDL_GetPointerPropertyByAtom(props, 0, &atom) == &atom,
+        "Verify atom 0 returns the default value");
+
+    number_atom = SDL_GetPropertyAtom("atom.number");
+    string_atom = SDL_GetPropertyAtom("atom.string");
+    SDL_SetNumberProperty(props, "atom.number", 42);
+    SDL_SetStringProperty(props, "atom.string", "17");
+    value_string = SDL_GetStringPropertyByAtom(props, number_atom, NULL);
+    SDLTest_AssertCheck(value_string && SDL_strcmp(value_string, "42") == 0,
+        "Verify number property as string, got: %s, expected 42", value_string);
+    value_number = SDL_GetNumberPropertyByAtom(props, string_atom, 0);
+    SDLTest_AssertCheck(value_number == 17,
+        "Verify string property as number, got: %" SDL_PRIs64 ", expected 17", value_number);
+    value_float = SDL_GetFloatPropertyByAtom(props, number_atom, 0.0f);
+    SDLTest_AssertCheck(value_float == 42.0f,
+        "Verify number property as float, got: %f, expected 42", value_float);
+    value_bool = SDL_GetBooleanPropertyByAtom(props, number_atom, false);
+    SDLTest_AssertCheck(value_bool == true,
+        "Verify number property as boolean, got: %d, expected true", value_bool);
+
+    /* A property set before its name has an atom is still found by atom, and moves over when it's set again */
+    SDL_SetNumberProperty(props, "atom.late", 1);
+    atom2 = SDL_GetPropertyAtom("atom.late");
+    value_number = SDL_GetNumberPropertyByAtom(props, atom2, -1);
+    SDLTest_AssertCheck(value_number == 1,
+        "Verify property set before its name had an atom, got: %" SDL_PRIs64 ", expected 1", value_number);
+    SDL_SetNumberProperty(props, "atom.late", 2);
+    value_number = SDL_GetNumberPropertyByAtom(props, atom2, -1);
+    SDLTest_AssertCheck(value_number == 2,
+        "Verify property set again after its name got an atom, got: %" SDL_PRIs64 ", expected 2", value_number);
+    count = 0;
+    SDL_EnumerateProperties(props, count_properties, &count);
+    SDLTest_AssertCheck(count == 4,
+        "Verify count, expected 4, got: %d", count);
+    SDL_ClearProperty(props, "atom.late");
+    value_number = SDL_GetNumberPropertyByAtom(props, atom2, -1);
+    SDLTest_AssertCheck(value_number == -1 && !SDL_HasProperty(props, "atom.late"),
+        "Verify property was cleared, got: %" SDL_PRIs64 ", expected -1", value_number);
+
+    /* Enough properties that the group has to grow, with only some of the names
+       having atoms, then remove some from the middle */
+    for (i = 0; i < 100; ++i) {
+        SDL_snprintf(key, SDL_arraysize(key), "atom.many.%d", i);
+        if (i % 2) {
+            SDL_GetPropertyAtom(key);
+        }
+        SDL_SetNumberProperty(props, key, i);
+    }
+    for (i = 0; i < 100; i += 3) {
+        SDL_snprintf(key, SDL_arraysize(key), "atom.many.%d", i);
+        SDL_ClearProperty(props, key);
+    }
+    count = 0;
+    for (i = 0; i < 100; ++i) {
+        SDL_snprintf(key, SDL_arraysize(key), "atom.many.%d", i);
+        value_number = SDL_GetNumberPropertyByAtom(props, SDL_GetPropertyAtom(key), -1);
+        if (value_number != ((i % 3) ? i : -1)) {
+            ++count;
+        }
+    }
+    SDLTest_AssertCheck(count == 0,
+        "Verify properties after removing every third one, %d were wrong", count);
+    value_string = SDL_GetStringPropertyByAtom(props, string_atom, NULL);
+    SDLTest_AssertCheck(value_string && SDL_strcmp(value_string, "17") == 0,
+        "Verify string property after the group grew, got: %s, expected 17", value_string);
+
+    /* Names made up at run time don't stay allocated once their properties are gone */
+    SDL_SetNumberProperty(props, "atom.unique", 0);
+    SDL_ClearProperty(props, "atom.unique");
+    SDL_GetMemoryFunctions(&atomTestMalloc, &atomTestCalloc, &atomTestRealloc, &atomTestFree);
+    SDL_SetAtomicInt(&atomTestAllocations, 0);
+    SDL_SetMemoryFunctions(countingMalloc, countingCalloc, countingRealloc, countingFree);
+    for (i = 0; i < 1000; ++i) {
+        SDL_snprintf(key, SDL_arraysize(key), "atom.unique.%d", i);
+        SDL_SetNumberProperty(props, key, i);
+        SDL_ClearProperty(props, key);
+    }
+    SDL_SetMemoryFunctions(atomTestMalloc, atomTestCalloc, atomTestRealloc, atomTestFree);
+    allocations = SDL_GetAtomicInt(&atomTestAllocations);
+    SDLTest_AssertCheck(allocations == 0,
+        "Verify setting and clearing unique names doesn't keep memory, expected: 0, got: %d", allocations);
+
+    SDL_DestroyProperties(props);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Properties test cases */
@@ -401,12 +562,17 @@ static const SDLTest_TestCaseReference propertiesTestLocking = {
     properties_testLocking, "properties_testLocking", "Test property locking functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference propertiesTestAtoms = {
+    properties_testAtoms, "properties_testAtoms", "Test looking up properties by atom", TEST_ENABLED
+};
+
 /* Sequence of Properties test cases */
 static const SDLTest_TestCaseReference *propertiesTests[] = {
     &propertiesTestBasic,
     &propertiesTestCopy,
     &propertiesTestCleanup,
     &propertiesTestLocking,
+    &propertiesTestAtoms,
     NULL
 };
 
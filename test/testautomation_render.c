@@ -2102,6 +2102,427 @@ static int SDLCALL render_testTextureState(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests the frame statistics that SDL_RenderPresent publishes as renderer properties
+ *
+ * \sa SDL_GetRendererProperties
+ * \sa SDL_RenderPresent
+ */
+static int SDLCALL render_testRenderStats(void *arg)
+{
+    const Uint8 pixels[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+    const SDL_Rect viewport = { 1, 1, 8, 8 };
+    const bool software = (SDL_strcmp(SDL_GetRendererName(renderer), SDL_SOFTWARE_RENDERER) == 0);
+    SDL_PropertiesID props;
+    SDL_Texture *texture;
+    SDL_FRect rect;
+    Sint64 draw_commands, merged_draw_commands, dropped_state_commands, draw_calls;
+    int i;
+
+    /* Start from an empty frame */
+    SDL_RenderPresent(renderer);
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 1, 1);
+    SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result");
+    if (texture == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_UpdateTexture(texture, NULL, pixels, sizeof(pixels));
+
+    /* Rectangles with the same color can be drawn together */
+    SDL_SetRenderDrawColor(renderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+    rect.y = 0.0f;
+    rect.w = 4.0f;
+    rect.h = 4.0f;
+    for (i = 0; i < 8; ++i) {
+        rect.x = i * 4.0f;
+        SDL_RenderFillRect(renderer, &rect);
+    }
+
+    /* Changing the viewport and changing it back before drawing doesn't change anything */
+    SDL_SetRenderViewport(renderer, &viewport);
+    SDL_SetRenderViewport(renderer, NULL);
+    rect.x = 32.0f;
+    SDL_RenderFillRect(renderer, &rect);
+
+    /* Changing a texture that queued drawing still uses has to flush the queue */
+    SDL_RenderTexture(renderer, texture, NULL, &rect);
+    SDL_UpdateTexture(texture, NULL, pixels, sizeof(pixels));
+    SDL_RenderPresent(renderer);
+    SDLTest_AssertPass("Call to SDL_RenderPresent()");
+
+    props = SDL_GetRendererProperties(renderer);
+    draw_commands = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_DRAW_COMMANDS_NUMBER, -1);
+    merged_draw_commands = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_MERGED_DRAW_COMMANDS_NUMBER, -1);
+    dropped_state_commands = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_DROPPED_STATE_COMMANDS_NUMBER, -1);
+    draw_calls = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_DRAW_CALLS_NUMBER, -1);
+
+    SDLTest_AssertCheck(draw_commands == 10, "Validate draw commands, expected 10, got %" SDL_PRIs64, draw_commands);
+    SDLTest_AssertCheck(draw_calls > 0 && draw_calls <= draw_commands, "Validate draw calls, expected 1-%" SDL_PRIs64 ", got %" SDL_PRIs64, draw_commands, draw_calls);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_COMMANDS_NUMBER, -1) >= draw_commands, "Validate that all commands include the draw commands");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_VERTEX_BYTES_NUMBER, -1) > 0, "Validate that vertex data was queued");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_STATE_CHANGES_NUMBER, -1) > 0, "Validate that state changes were counted");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_TEXTURE_UPLOADS_NUMBER, -1) == 2, "Validate texture uploads, expected 2");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_FORCED_FLUSHES_NUMBER, -1) == 1, "Validate forced flushes, expected 1");
+    if (software) {
+        /* The rectangles become one draw, and the texture copy is another */
+        SDLTest_AssertCheck(merged_draw_commands == 8, "Validate merged draw commands, expected 8, got %" SDL_PRIs64, merged_draw_commands);
+        SDLTest_AssertCheck(dropped_state_commands == 2, "Validate dropped state commands, expected 2, got %" SDL_PRIs64, dropped_state_commands);
+        SDLTest_AssertCheck(draw_calls == 2, "Validate draw calls, expected 2, got %" SDL_PRIs64, draw_calls);
+    }
+
+    /* The next frame starts counting from zero */
+    SDL_RenderPresent(renderer);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_DRAW_COMMANDS_NUMBER, -1) == 0, "Validate that an empty frame has no draw commands");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_TEXTURE_UPLOADS_NUMBER, -1) == 0, "Validate that an empty frame has no texture uploads");
+
+    /* Clean up. */
+    SDL_DestroyTexture(texture);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that SDL_RenderTextureBatch draws the same as separate calls per sprite
+ *
+ * \sa SDL_RenderTextureBatch
+ * \sa SDL_RenderTextureRotated
+ */
+static int SDLCALL render_testRenderTextureBatch(void *arg)
+{
+    static const SDL_FlipMode flip_modes[] = { SDL_FLIP_NONE, SDL_FLIP_HORIZONTAL, SDL_FLIP_VERTICAL, SDL_FLIP_HORIZONTAL_AND_VERTICAL };
+    SDL_FRect srcrects[16], dstrects[16];
+    SDL_FColor colors[16];
+    double angles[16];
+    SDL_FlipMode flips[16];
+    const SDL_Rect screen = { 0, 0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H };
+    SDL_Texture *tface;
+    SDL_Surface *referenceSurface = NULL;
+    SDL_Surface *surface;
+    int i, j, ni, nj, count;
+    bool ret;
+
+    /* Need drawcolor or just skip test. */
+    SDLTest_AssertCheck(hasDrawColor(), "hasDrawColor)");
+
+    /* Create face surface. */
+    tface = loadTestFace();
+    SDLTest_AssertCheck(tface != NULL, "Verify loadTestFace() result");
+    if (tface == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* The same sprites as render_testBlit, in one call */
+    clearScreen();
+    ni = TESTRENDER_SCREEN_W - tface->w;
+    nj = TESTRENDER_SCREEN_H - tface->h;
+    for (j = 0; j <= nj; j += 4) {
+        count = 0;
+        for (i = 0; i <= ni && count < (int)SDL_arraysize(dstrects); i += 4) {
+            dstrects[count].x = (float)i;
+            dstrects[count].y = (float)j;
+            dstrects[count].w = (float)tface->w;
+            dstrects[count].h = (float)tface->h;
+            ++count;
+        }
+        ret = SDL_RenderTextureBatch(renderer, tface, NULL, dstrects, NULL, NULL, NULL, count);
+        SDLTest_AssertCheck(ret, "Validate result from SDL_RenderTextureBatch, expected: true, got: %s", ret ? "true" : "false");
+    }
+    referenceSurface = SDLTest_ImageBlit();
+    compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+    SDL_DestroySurface(referenceSurface);
+    referenceSurface = NULL;
+
+    /* Rotated, flipped and colored sprites, drawn one at a time */
+    count = (int)SDL_arraysize(dstrects);
+    for (i = 0; i < count; ++i) {
+        srcrects[i].x = (float)(i % 4) * 2.0f;
+        srcrects[i].y = (float)(i / 4) * 2.0f;
+        srcrects[i].w = (float)tface->w - 8.0f;
+        srcrects[i].h = (float)tface->h - 8.0f;
+        dstrects[i].x = (float)(i % 4) * 16.0f;
+        dstrects[i].y = (float)(i / 4) * 12.0f;
+        dstrects[i].w = 24.0f;
+        dstrects[i].h = 20.0f;
+        colors[i].r = 1.0f - i / 32.0f;
+        colors[i].g = (i % 2) ? 0.5f : 1.0f;
+        colors[i].b = 1.0f;
+        colors[i].a = 1.0f;
+        angles[i] = (i % 3) ? 90.0 * (i % 3) : 0.0;
+        flips[i] = flip_modes[i % SDL_arraysize(flip_modes)];
+    }
+    clearScreen();
+    for (i = 0; i < count; ++i) {
+        SDL_SetTextureColorModFloat(tface, colors[i].r, colors[i].g, colors[i].b);
+        SDL_RenderTextureRotated(renderer, tface, &srcrects[i], &dstrects[i], angles[i], NULL, flips[i]);
+    }
+    SDL_SetTextureColorModFloat(tface, 1.0f, 1.0f, 1.0f);
+    surface = SDL_RenderReadPixels(renderer, &screen);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels, got NULL, %s", SDL_GetError());
+    if (surface) {
+        referenceSurface = SDL_ConvertSurface(surface, RENDER_COMPARE_FORMAT);
+        SDL_DestroySurface(surface);
+    }
+
+    /* The same sprites in one call */
+    clearScreen();
+    ret = SDL_RenderTextureBatch(renderer, tface, srcrects, dstrects, colors, angles, flips, count);
+    SDLTest_AssertCheck(ret, "Validate result from SDL_RenderTextureBatch, expected: true, got: %s", ret ? "true" : "false");
+    if (referenceSurface) {
+        compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+    }
+
+    /* Nothing to draw isn't an error, but no destination is */
+    ret = SDL_RenderTextureBatch(renderer, tface, NULL, dstrects, NULL, NULL, NULL, 0);
+    SDLTest_AssertCheck(ret, "Validate that an empty batch succeeds");
+    ret = SDL_RenderTextureBatch(renderer, tface, NULL, NULL, NULL, NULL, NULL, count);
+    SDLTest_AssertCheck(!ret, "Validate that a batch without destination rectangles fails");
+
+    /* Make current */
+    SDL_RenderPresent(renderer);
+
+    /* Clean up. */
+    SDL_DestroyTexture(tface);
+    SDL_DestroySurface(referenceSurface);
+
+    return TEST_COMPLETED;
+}
+
+typedef struct RenderCommandListTestData
+{
+    SDL_RenderCommandList *list;
+    SDL_Texture *texture;
+    int index;
+    bool result;
+} RenderCommandListTestData;
+
+/* Counts the allocations SDL has outstanding while render_testRenderCommandLists replays frames */
+static SDL_malloc_func commandListTestMalloc;
+static SDL_calloc_func commandListTestCalloc;
+static SDL_realloc_func commandListTestRealloc;
+static SDL_free_func commandListTestFree;
+static SDL_AtomicInt commandListTestAllocations;
+
+static void *SDLCALL countingMalloc(size_t size)
+{
+    void *mem = commandListTestMalloc(size);
+    if (mem) {
+        SDL_AddAtomicInt(&commandListTestAllocations, 1);
+    }
+    return mem;
+}
+
+static void *SDLCALL countingCalloc(size_t nmemb, size_t size)
+{
+    void *mem = commandListTestCalloc(nmemb, size);
+    if (mem) {
+        SDL_AddAtomicInt(&commandListTestAllocations, 1);
+    }
+    return mem;
+}
+
+static void *SDLCALL countingRealloc(void *ptr, size_t size)
+{
+    void *mem = commandListTestRealloc(ptr, size);
+    if (mem && !ptr) {
+        SDL_AddAtomicInt(&commandListTestAllocations, 1);
+    }
+    return mem;
+}
+
+static void SDLCALL countingFree(void *ptr)
+{
+    if (ptr) {
+        SDL_AddAtomicInt(&commandListTestAllocations, -1);
+    }
+    commandListTestFree(ptr);
+}
+
+/* Draws part of the scene for render_testRenderCommandLists, into a list or straight to the renderer */
+static bool drawCommandListTestPart(SDL_RenderCommandList *list, SDL_Texture *texture, int index)
+{
+    const float x = index * 18.0f;
+    SDL_FRect rects[2];
+    SDL_FRect dstrect;
+    SDL_Vertex verts[3];
+    bool result = true;
+    int i;
+
+    rects[0].x = x;
+    rects[0].y = 2.0f;
+    rects[0].w = 16.0f;
+    rects[0].h = 8.0f;
+    rects[1] = rects[0];
+    rects[1].y = 12.0f;
+    dstrect.x = x;
+    dstrect.y = 22.0f;
+    dstrect.w = 16.0f;
+    dstrect.h = 16.0f;
+    for (i = 0; i < 3; ++i) {
+        verts[i].color.r = (i == 0) ? 1.0f : 0.0f;
+        verts[i].color.g = (i == 1) ? 1.0f : 0.0f;
+        verts[i].color.b = (i == 2) ? 1.0f : 0.0f;
+        verts[i].color.a = 1.0f;
+        verts[i].tex_coord.x = 0.0f;
+        verts[i].tex_coord.y = 0.0f;
+    }
+    verts[0].position.x = x;
+    verts[0].position.y = 40.0f;
+    verts[1].position.x = x + 16.0f;
+    verts[1].position.y = 44.0f;
+    verts[2].position.x = x + 4.0f;
+    verts[2].position.y = 56.0f;
+
+    if (list) {
+        result &= SDL_SetRenderCommandListDrawColorFloat(list, 0.25f * index, 1.0f, 0.5f, 1.0f);
+        result &= SDL_RecordRenderFillRects(list, rects, SDL_arraysize(rects));
+        result &= SDL_RecordRenderTexture(list, texture, NULL, &dstrect);
+        result &= SDL_RecordRenderGeometry(list, NULL, verts, SDL_arraysize(verts), NULL, 0);
+    } else {
+        result &= SDL_SetRenderDrawColorFloat(renderer, 0.25f * index, 1.0f, 0.5f, 1.0f);
+        result &= SDL_RenderFillRects(renderer, rects, SDL_arraysize(rects));
+        result &= SDL_RenderTexture(renderer, texture, NULL, &dstrect);
+        result &= SDL_RenderGeometry(renderer, NULL, verts, SDL_arraysize(verts), NULL, 0);
+    }
+    return result;
+}
+
+static int SDLCALL recordCommandListTestPart(void *data)
+{
+    RenderCommandListTestData *part = (RenderCommandListTestData *)data;
+
+    /* Finish in reverse order, so the order of recording differs from the order of drawing */
+    SDL_Delay((3 - part->index) * 10);
+    part->result = drawCommandListTestPart(part->list, part->texture, part->index);
+    return 0;
+}
+
+/**
+ * Tests that command lists recorded on other threads draw the same as drawing directly
+ *
+ * \sa SDL_CreateRenderCommandList
+ * \sa SDL_SubmitRenderCommandList
+ */
+static int SDLCALL render_testRenderCommandLists(void *arg)
+{
+    const SDL_Rect viewport = { 4, 2, 72, 58 };
+    const SDL_Rect screen = { 0, 0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H };
+    RenderCommandListTestData parts[4];
+    SDL_Thread *threads[SDL_arraysize(parts)];
+    SDL_Surface *referenceSurface = NULL;
+    SDL_Surface *surface;
+    SDL_Texture *tface;
+    SDL_Texture *target;
+    int allocations = 0;
+    int i, run;
+    bool ret;
+
+    parts[0].list = SDL_CreateRenderCommandList(renderer);
+    if (!parts[0].list) {
+        SDLTest_Log("Renderer doesn't support command lists: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDL_DestroyRenderCommandList(parts[0].list);
+
+    tface = loadTestFace();
+    SDLTest_AssertCheck(tface != NULL, "Verify loadTestFace() result");
+    if (tface == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Draw the scene directly */
+    clearScreen();
+    SDL_SetRenderViewport(renderer, &viewport);
+    SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+    for (i = 0; i < (int)SDL_arraysize(parts); ++i) {
+        ret = drawCommandListTestPart(NULL, tface, i);
+        SDLTest_AssertCheck(ret, "Validate drawing part %d directly", i);
+    }
+    SDL_SetRenderViewport(renderer, NULL);
+    surface = SDL_RenderReadPixels(renderer, &screen);
+    SDLTest_AssertCheck(surface != NULL, "Validate result from SDL_RenderReadPixels, got NULL, %s", SDL_GetError());
+    if (surface) {
+        referenceSurface = SDL_ConvertSurface(surface, RENDER_COMPARE_FORMAT);
+        SDL_DestroySurface(surface);
+    }
+
+    /* Record the same scene on several threads, twice, reusing the lists */
+    clearScreen();
+    SDL_SetRenderViewport(renderer, &viewport);
+    for (i = 0; i < (int)SDL_arraysize(parts); ++i) {
+        parts[i].list = SDL_CreateRenderCommandList(renderer);
+        parts[i].texture = tface;
+        parts[i].index = i;
+        SDLTest_AssertCheck(parts[i].list != NULL, "Validate result from SDL_CreateRenderCommandList, got NULL, %s", SDL_GetError());
+    }
+    SDL_SetRenderViewport(renderer, NULL);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+
+    for (run = 0; run < 2; ++run) {
+        for (i = 0; i < (int)SDL_arraysize(parts); ++i) {
+            parts[i].result = false;
+            threads[i] = SDL_CreateThread(recordCommandListTestPart, "RecordCommandList", &parts[i]);
+        }
+        for (i = 0; i < (int)SDL_arraysize(parts); ++i) {
+            SDL_WaitThread(threads[i], NULL);
+            SDLTest_AssertCheck(parts[i].result, "Validate recording part %d on a thread", i);
+        }
+
+        /* The renderer's own drawing between lists isn't affected by the lists' state */
+        SDL_RenderClear(renderer);
+        for (i = 0; i < (int)SDL_arraysize(parts); ++i) {
+            ret = SDL_SubmitRenderCommandList(parts[i].list);
+            SDLTest_AssertCheck(ret, "Validate result from SDL_SubmitRenderCommandList, expected: true, got: %s", ret ? "true" : "false");
+        }
+
+        if (referenceSurface) {
+            compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+        }
+    }
+
+    /* Once the lists have warmed up, replaying the same frame doesn't allocate any more memory */
+    SDL_GetMemoryFunctions(&commandListTestMalloc, &commandListTestCalloc, &commandListTestRealloc, &commandListTestFree);
+    SDL_SetAtomicInt(&commandListTestAllocations, 0);
+    SDL_SetMemoryFunctions(countingMalloc, countingCalloc, countingRealloc, countingFree);
+    for (run = 0; run < 20; ++run) {
+        if (run == 10) {
+            allocations = SDL_GetAtomicInt(&commandListTestAllocations);
+        }
+        for (i = 0; i < (int)SDL_arraysize(parts); ++i) {
+            drawCommandListTestPart(parts[i].list, tface, i);
+            SDL_SubmitRenderCommandList(parts[i].list);
+        }
+        SDL_FlushRenderer(renderer);
+    }
+    allocations = SDL_GetAtomicInt(&commandListTestAllocations) - allocations;
+    SDL_SetMemoryFunctions(commandListTestMalloc, commandListTestCalloc, commandListTestRealloc, commandListTestFree);
+    SDLTest_AssertCheck(allocations == 0, "Validate that replaying command lists doesn't allocate, expected: 0, got: %d", allocations);
+
+    /* An empty list changes nothing, and a list can't be submitted to another target */
+    ret = SDL_SubmitRenderCommandList(parts[0].list);
+    SDLTest_AssertCheck(ret, "Validate that submitting an empty list succeeds");
+    target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, 8, 8);
+    if (target) {
+        SDL_SetRenderTarget(renderer, target);
+        ret = SDL_SubmitRenderCommandList(parts[0].list);
+        SDLTest_AssertCheck(!ret, "Validate that submitting to a different render target fails");
+        SDL_SetRenderTarget(renderer, NULL);
+        SDL_DestroyTexture(target);
+    }
+
+    /* Make current */
+    SDL_RenderPresent(renderer);
+
+    /* Clean up. */
+    for (i = 0; i < (int)SDL_arraysize(parts); ++i) {
+        SDL_DestroyRenderCommandList(parts[i].list);
+    }
+    SDL_DestroyTexture(tface);
+    SDL_DestroySurface(referenceSurface);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -2169,6 +2590,18 @@ static const SDLTest_TestCaseReference renderTestGetSetTextureScaleMode = {
     render_testGetSetTextureScaleMode, "render_testGetSetTextureScaleMode", "Tests setting/getting texture scale mode", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestRenderStats = {
+    render_testRenderStats, "render_testRenderStats", "Tests the frame statistics in the renderer properties", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestRenderTextureBatch = {
+    render_testRenderTextureBatch, "render_testRenderTextureBatch", "Tests drawing many copies of a texture at once", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestRenderCommandLists = {
+    render_testRenderCommandLists, "render_testRenderCommandLists", "Tests command lists recorded on other threads", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference renderTestRGBSurfaceNoAlpha = {
     render_testRGBSurfaceNoAlpha, "render_testRGBSurfaceNoAlpha", "Tests RGB surface with no alpha using software renderer", TEST_ENABLED
 };
@@ -2192,6 +2625,9 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestTextureState,
     &renderTestGetSetTextureScaleMode,
     &renderTestRGBSurfaceNoAlpha,
+    &renderTestRenderStats,
+    &renderTestRenderTextureBatch,
+    &renderTestRenderCommandLists,
     NULL
 };
 
@@ -1462,6 +1462,95 @@ static int SDLCALL surface_testPalettization(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests that converting to a large palette picks the same color as SDL_MapRGBA()
+ */
+static int SDLCALL surface_testPalettizationLarge(void *arg)
+{
+    const SDL_PixelFormat formats[] = {
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_XRGB8888,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_ARGB4444
+    };
+    const int w = 256, h = 64;
+    SDL_Palette *palette;
+    SDL_Color palette_colors[256];
+    SDL_Surface *source, *output;
+    int i, f, x, y, pass;
+    int mismatches;
+
+    palette = SDL_CreatePalette(SDL_arraysize(palette_colors));
+    SDLTest_AssertCheck(palette != NULL, "SDL_CreatePalette()");
+    if (!palette) {
+        return TEST_ABORTED;
+    }
+
+    for (f = 0; f < SDL_arraysize(formats); f++) {
+        source = SDL_CreateSurface(w, h, formats[f]);
+        SDLTest_AssertCheck(source != NULL, "SDL_CreateSurface(%s)", SDL_GetPixelFormatName(formats[f]));
+        if (!source) {
+            continue;
+        }
+        for (y = 0; y < h; y++) {
+            Uint32 value = 0;
+            for (x = 0; x < w; x++) {
+                /* Short runs of identical pixels, to exercise the lookup shortcuts */
+                if (x % 3 == 0) {
+                    value = SDLTest_RandomUint32();
+                }
+                SDL_WriteSurfacePixel(source, x, y, (Uint8)(value >> 24), (Uint8)(value >> 16), (Uint8)(value >> 8), (y & 1) ? SDL_ALPHA_OPAQUE : (Uint8)value);
+            }
+        }
+
+        /* The second pass changes the palette under an existing mapping */
+        output = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_INDEX8);
+        SDLTest_AssertCheck(output != NULL, "SDL_CreateSurface(SDL_PIXELFORMAT_INDEX8)");
+        if (!output) {
+            SDL_DestroySurface(source);
+            continue;
+        }
+        SDL_SetSurfacePalette(output, palette);
+        SDL_SetSurfaceBlendMode(source, SDL_BLENDMODE_NONE);
+        for (pass = 0; pass < 2; pass++) {
+            for (i = 0; i < SDL_arraysize(palette_colors); i++) {
+                palette_colors[i].r = (Uint8)SDLTest_RandomUint8();
+                palette_colors[i].g = (Uint8)SDLTest_RandomUint8();
+                palette_colors[i].b = (Uint8)SDLTest_RandomUint8();
+                palette_colors[i].a = (i % 16 == 0) ? (Uint8)SDLTest_RandomUint8() : SDL_ALPHA_OPAQUE;
+            }
+            /* Duplicate entries have to resolve to the first one */
+            palette_colors[200] = palette_colors[100];
+            SDL_SetPaletteColors(palette, palette_colors, 0, SDL_arraysize(palette_colors));
+
+            SDL_BlitSurface(source, NULL, output, NULL);
+
+            mismatches = 0;
+            for (y = 0; y < h; y++) {
+                const Uint8 *row = (const Uint8 *)output->pixels + y * output->pitch;
+                for (x = 0; x < w; x++) {
+                    Uint8 r, g, b, a;
+                    Uint32 expected;
+                    SDL_ReadSurfacePixel(source, x, y, &r, &g, &b, &a);
+                    expected = SDL_MapRGBA(SDL_GetPixelFormatDetails(SDL_PIXELFORMAT_INDEX8), palette, r, g, b, a);
+                    if (row[x] != expected) {
+                        if (mismatches++ == 0) {
+                            SDLTest_AssertCheck(false, "%s: expected index %u at (%d,%d), got %u", SDL_GetPixelFormatName(formats[f]), (unsigned int)expected, x, y, row[x]);
+                        }
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "%s pass %d: %d pixels differ from SDL_MapRGBA()", SDL_GetPixelFormatName(formats[f]), pass, mismatches);
+        }
+        SDL_DestroySurface(output);
+        SDL_DestroySurface(source);
+    }
+    SDL_DestroyPalette(palette);
+
+    return TEST_COMPLETED;
+}
+
 static int SDLCALL surface_testClearSurface(void *arg)
 {
     SDL_PixelFormat formats[] = {
@@ -1722,6 +1811,10 @@ static const SDLTest_TestCaseReference surfaceTestPalettization = {
     surface_testPalettization, "surface_testPalettization", "Test surface palettization.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestPalettizationLarge = {
+    surface_testPalettizationLarge, "surface_testPalettizationLarge", "Test palettization against SDL_MapRGBA() with a full palette.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestClearSurface = {
     surface_testClearSurface, "surface_testClearSurface", "Test clear surface operations.", TEST_ENABLED
 };
@@ -1760,6 +1853,7 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestFlip,
     &surfaceTestPalette,
     &surfaceTestPalettization,
+    &surfaceTestPalettizationLarge,
     &surfaceTestClearSurface,
     &surfaceTestPremultiplyAlpha,
     &surfaceTestScale,
@@ -0,0 +1,261 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks that the SIMD versions of the generated 8888 blitters produce
+   exactly the same pixels as the scalar ones for every format pair, blend
+   mode and color/alpha modulation, and reports their throughput. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct BlitVariant
+{
+    const char *name;
+    const char *cpu_feature_mask;
+} BlitVariant;
+
+static const BlitVariant variants[] = {
+    { "scalar", "-sse41,-avx2,-neon" },
+    { "SSE4.1/NEON", "-avx2" },
+    { "best available", "all" }
+};
+
+static const SDL_PixelFormat src_formats[] = {
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_XBGR8888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_BGRA8888
+};
+
+static const SDL_PixelFormat dst_formats[] = {
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_XBGR8888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_ABGR8888
+};
+
+static const SDL_BlendMode blend_modes[] = {
+    SDL_BLENDMODE_NONE,
+    SDL_BLENDMODE_BLEND,
+    SDL_BLENDMODE_BLEND_PREMULTIPLIED,
+    SDL_BLENDMODE_ADD,
+    SDL_BLENDMODE_ADD_PREMULTIPLIED,
+    SDL_BLENDMODE_MOD,
+    SDL_BLENDMODE_MUL
+};
+
+typedef struct Modulation
+{
+    Uint8 r, g, b, a;
+} Modulation;
+
+static const Modulation modulations[] = {
+    { 255, 255, 255, 255 },
+    { 200, 100, 50, 255 },
+    { 255, 255, 255, 128 },
+    { 17, 255, 230, 77 }
+};
+
+static void select_variant(const BlitVariant *variant)
+{
+    /* CPU features are detected once and cached until SDL_Quit(). */
+    SDL_Quit();
+    SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, variant->cpu_feature_mask);
+}
+
+static void fill_random(SDL_Surface *surface, Uint64 seed)
+{
+    int y;
+    int x;
+
+    for (y = 0; y < surface->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < surface->w; ++x) {
+            Uint32 pixel = SDL_rand_bits_r(&seed);
+            /* Make sure fully transparent and fully opaque pixels show up often */
+            switch (x % 8) {
+            case 0:
+                pixel |= 0xFF0000FF;
+                break;
+            case 1:
+                pixel &= 0x00FFFF00;
+                break;
+            default:
+                break;
+            }
+            row[x] = pixel;
+        }
+    }
+}
+
+/* Run every combination, leaving the results one after another in the output buffer */
+static bool blit_all(int width, int height, Uint32 *output, int iterations, double *mpix_per_sec)
+{
+    SDL_Surface *src, *dst;
+    Uint64 elapsed = 0;
+    Uint64 pixels = 0;
+    int s, d, b, m, i, y;
+
+    for (s = 0; s < (int)SDL_arraysize(src_formats); ++s) {
+        for (d = 0; d < (int)SDL_arraysize(dst_formats); ++d) {
+            src = SDL_CreateSurface(width, height, src_formats[s]);
+            dst = SDL_CreateSurface(width, height, dst_formats[d]);
+            if (!src || !dst) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s", SDL_GetError());
+                SDL_DestroySurface(src);
+                SDL_DestroySurface(dst);
+                return false;
+            }
+            fill_random(src, 1 + s);
+
+            for (b = 0; b < (int)SDL_arraysize(blend_modes); ++b) {
+                for (m = 0; m < (int)SDL_arraysize(modulations); ++m) {
+                    Uint64 start;
+
+                    SDL_SetSurfaceBlendMode(src, blend_modes[b]);
+                    SDL_SetSurfaceColorMod(src, modulations[m].r, modulations[m].g, modulations[m].b);
+                    SDL_SetSurfaceAlphaMod(src, modulations[m].a);
+
+                    for (i = 0; i < iterations; ++i) {
+                        /* Blending reads the destination, so start from the same pixels every time */
+                        fill_random(dst, 100 + d);
+                        start = SDL_GetTicksNS();
+                        if (!SDL_BlitSurface(src, NULL, dst, NULL)) {
+                            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_BlitSurface failed: %s", SDL_GetError());
+                            SDL_DestroySurface(src);
+                            SDL_DestroySurface(dst);
+                            return false;
+                        }
+                        elapsed += SDL_GetTicksNS() - start;
+                        pixels += (Uint64)width * height;
+                    }
+
+                    if (output) {
+                        for (y = 0; y < height; ++y) {
+                            SDL_memcpy(output, (Uint8 *)dst->pixels + y * dst->pitch, width * sizeof(Uint32));
+                            output += width;
+                        }
+                    }
+                }
+            }
+            SDL_DestroySurface(src);
+            SDL_DestroySurface(dst);
+        }
+    }
+
+    *mpix_per_sec = ((double)pixels / 1000000.0) / ((double)SDL_max(elapsed, 1) / SDL_NS_PER_SECOND);
+    return true;
+}
+
+static int check_variant(const BlitVariant *variant, const Uint32 *reference, Uint32 *output, int width, int height)
+{
+    const int combination_size = width * height;
+    const int num_combinations = (int)(SDL_arraysize(src_formats) * SDL_arraysize(dst_formats) * SDL_arraysize(blend_modes) * SDL_arraysize(modulations));
+    double mpix_per_sec;
+    int i, j;
+
+    select_variant(variant);
+    if (!blit_all(width, height, output, 1, &mpix_per_sec)) {
+        return 1;
+    }
+    for (i = 0; i < num_combinations; ++i) {
+        for (j = 0; j < combination_size; ++j) {
+            const int offset = i * combination_size + j;
+            const int b = (i / (int)SDL_arraysize(modulations)) % (int)SDL_arraysize(blend_modes);
+            const int d = (i / (int)(SDL_arraysize(modulations) * SDL_arraysize(blend_modes))) % (int)SDL_arraysize(dst_formats);
+            const int s = i / (int)(SDL_arraysize(modulations) * SDL_arraysize(blend_modes) * SDL_arraysize(dst_formats));
+            /* The padding byte of XRGB and XBGR isn't defined, so don't compare it */
+            const Uint32 mask = SDL_ISPIXELFORMAT_ALPHA(dst_formats[d]) ? 0xFFFFFFFF : 0x00FFFFFF;
+            if ((output[offset] & mask) != (reference[offset] & mask)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: %s -> %s, blend mode 0x%x, modulation %d, pixel %d: 0x%08" SDL_PRIx32 " != 0x%08" SDL_PRIx32,
+                             variant->name, SDL_GetPixelFormatName(src_formats[s]), SDL_GetPixelFormatName(dst_formats[d]),
+                             (unsigned int)blend_modes[b], i % (int)SDL_arraysize(modulations), j, output[offset], reference[offset]);
+                return 1;
+            }
+        }
+    }
+    SDL_Log("%s: output matches the scalar blitters", variant->name);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint32 *reference = NULL;
+    Uint32 *output = NULL;
+    size_t output_size;
+    int width = 1920;
+    int height = 1080;
+    int iterations = 2;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1] && argv[i + 2]) {
+                width = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                height = SDL_max(SDL_atoi(argv[i + 2]), 1);
+                consumed = 3;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--size W H]", "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    /* The correctness check keeps every result around, so it uses a small size with odd widths to cover the tails */
+    output_size = SDL_arraysize(src_formats) * SDL_arraysize(dst_formats) * SDL_arraysize(blend_modes) * SDL_arraysize(modulations) * 37 * 5;
+    reference = (Uint32 *)SDL_malloc(output_size * sizeof(Uint32));
+    output = (Uint32 *)SDL_malloc(output_size * sizeof(Uint32));
+    if (!reference || !output) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        result = 1;
+        goto done;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(variants) && result == 0; ++i) {
+        result |= check_variant(&variants[i], reference, (i == 0) ? reference : output, 37, 5);
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(variants) && result == 0; ++i) {
+        double mpix_per_sec;
+
+        select_variant(&variants[i]);
+        if (!blit_all(width, height, NULL, iterations, &mpix_per_sec)) {
+            result = 1;
+            break;
+        }
+        SDL_Log("%-16s %dx%d, all formats, blend modes and modulations: %8.1f MPix/s", variants[i].name, width, height, mpix_per_sec);
+    }
+
+done:
+    SDL_free(reference);
+    SDL_free(output);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
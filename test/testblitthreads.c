@@ -0,0 +1,195 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Reports software blit and pixel conversion throughput on large surfaces
+   with different values of SDL_HINT_SURFACE_BLIT_THREADS, and checks that
+   the banded blits produce exactly the same pixels as a single thread. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef enum BlitOperation
+{
+    BLIT_COPY,
+    BLIT_CONVERT,
+    BLIT_BLEND,
+    CONVERT_PIXELS
+} BlitOperation;
+
+typedef struct BlitCase
+{
+    const char *name;
+    BlitOperation operation;
+    SDL_PixelFormat src_format;
+    SDL_PixelFormat dst_format;
+} BlitCase;
+
+static const BlitCase cases[] = {
+    { "SDL_BlitSurface XRGB8888 -> XRGB8888", BLIT_COPY, SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888 },
+    { "SDL_BlitSurface XRGB8888 -> RGB565", BLIT_CONVERT, SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_RGB565 },
+    { "SDL_BlitSurface ABGR8888 -> XRGB8888", BLIT_CONVERT, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888 },
+    { "SDL_BlitSurface ARGB8888 blend", BLIT_BLEND, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888 },
+    { "SDL_ConvertPixels ABGR8888 -> RGB24", CONVERT_PIXELS, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB24 }
+};
+
+static const int thread_counts[] = { 1, 2, 4, 8 };
+
+static void fill_random(SDL_Surface *surface, Uint64 *seed)
+{
+    int y;
+    int x;
+
+    for (y = 0; y < surface->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < (surface->pitch / 4); ++x) {
+            row[x] = SDL_rand_bits_r(seed);
+        }
+    }
+}
+
+static bool run_operation(const BlitCase *blit, SDL_Surface *src, SDL_Surface *dst)
+{
+    switch (blit->operation) {
+    case BLIT_COPY:
+    case BLIT_CONVERT:
+    case BLIT_BLEND:
+        return SDL_BlitSurface(src, NULL, dst, NULL);
+    case CONVERT_PIXELS:
+        return SDL_ConvertPixels(src->w, src->h, src->format, src->pixels, src->pitch, dst->format, dst->pixels, dst->pitch);
+    }
+    return false;
+}
+
+static bool surfaces_match(SDL_Surface *a, SDL_Surface *b)
+{
+    const size_t row_bytes = (size_t)a->w * SDL_BYTESPERPIXEL(a->format);
+    int y;
+
+    for (y = 0; y < a->h; ++y) {
+        if (SDL_memcmp((Uint8 *)a->pixels + y * a->pitch, (Uint8 *)b->pixels + y * b->pitch, row_bytes) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Row %d differs from the single-threaded result", y);
+            return false;
+        }
+    }
+    return true;
+}
+
+static int run_case(const BlitCase *blit, int width, int height, int iterations, int max_threads, Uint64 *seed)
+{
+    SDL_Surface *src, *dst, *reference;
+    int result = 0;
+    int i, j;
+
+    src = SDL_CreateSurface(width, height, blit->src_format);
+    dst = SDL_CreateSurface(width, height, blit->dst_format);
+    reference = SDL_CreateSurface(width, height, blit->dst_format);
+    if (!src || !dst || !reference) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s", SDL_GetError());
+        result = 1;
+        goto done;
+    }
+    fill_random(src, seed);
+    SDL_SetSurfaceBlendMode(src, (blit->operation == BLIT_BLEND) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+
+    for (i = 0; i < (int)SDL_arraysize(thread_counts) && result == 0; ++i) {
+        const int num_threads = thread_counts[i];
+        SDL_Surface *target = (num_threads == 1) ? reference : dst;
+        Uint64 start, elapsed = 0;
+        char value[16];
+
+        if (num_threads > max_threads) {
+            break;
+        }
+        (void)SDL_snprintf(value, sizeof(value), "%d", num_threads);
+        SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, value);
+
+        for (j = 0; j < iterations; ++j) {
+            /* Blending reads the destination, so start from the same pixels every time */
+            SDL_FillSurfaceRect(target, NULL, SDL_MapSurfaceRGB(target, 32, 64, 128));
+            start = SDL_GetTicksNS();
+            if (!run_operation(blit, src, target)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s failed: %s", blit->name, SDL_GetError());
+                result = 1;
+                break;
+            }
+            elapsed += SDL_GetTicksNS() - start;
+        }
+        if (result != 0) {
+            break;
+        }
+        if (target != reference && !surfaces_match(reference, target)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: %d threads gave a different result", blit->name, num_threads);
+            result = 1;
+            break;
+        }
+
+        SDL_Log("%-40s %dx%d, %d thread%s: %8.1f MPix/s", blit->name, width, height, num_threads, (num_threads == 1) ? " " : "s",
+                ((double)width * height * iterations / 1000000.0) / ((double)SDL_max(elapsed, 1) / SDL_NS_PER_SECOND));
+    }
+
+done:
+    SDL_ResetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+    SDL_DestroySurface(reference);
+    SDL_DestroySurface(dst);
+    SDL_DestroySurface(src);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint64 seed = 0;
+    int width = 3840;
+    int height = 2160;
+    int iterations = 10;
+    int max_threads = 8;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1] && argv[i + 2]) {
+                width = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                height = SDL_max(SDL_atoi(argv[i + 2]), 1);
+                consumed = 3;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--max-threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--size W H]", "[--iterations N]", "[--max-threads N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    SDL_Log("%d logical CPU cores", SDL_GetNumLogicalCPUCores());
+    for (i = 0; i < (int)SDL_arraysize(cases); ++i) {
+        result |= run_case(&cases[i], width, height, iterations, max_threads, &seed);
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,180 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks SDL_crc32() against the original bit-at-a-time algorithm and
+   reports its throughput with each of the CPU-specific code paths. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define BUFFER_SIZE (1024 * 1024)
+
+typedef struct CRCVariant
+{
+    const char *name;
+    const char *cpu_feature_mask;
+} CRCVariant;
+
+static const CRCVariant variants[] = {
+    { "table (slice-by-8)", "-pclmul,-arm-crc32" },
+    { "best available", "all" }
+};
+
+static const size_t bench_sizes[] = { 16, 256, 4096, BUFFER_SIZE };
+
+static Uint32 reference_crc32(Uint32 crc, const Uint8 *data, size_t len)
+{
+    size_t i;
+    for (i = 0; i < len; ++i) {
+        Uint32 r = (Uint8)crc ^ data[i];
+        int bit;
+        for (bit = 0; bit < 8; ++bit) {
+            r = (r & 1 ? 0 : (Uint32)0xEDB88320L) ^ r >> 1;
+        }
+        crc = (r ^ (Uint32)0xFF000000L) ^ crc >> 8;
+    }
+    return crc;
+}
+
+static void select_variant(const CRCVariant *variant)
+{
+    /* CPU features are detected once and cached until SDL_Quit(). */
+    SDL_Quit();
+    SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, variant->cpu_feature_mask);
+}
+
+static int check_variant(const CRCVariant *variant, const Uint8 *buffer, Uint64 *seed)
+{
+    size_t len;
+    size_t offset;
+    int i;
+
+    select_variant(variant);
+
+    for (len = 0; len <= 1024; len += (len < 300) ? 1 : 37) {
+        for (offset = 0; offset < 8; ++offset) {
+            const Uint32 initial = (offset & 1) ? SDL_rand_bits_r(seed) : 0;
+            const Uint32 expected = reference_crc32(initial, buffer + offset, len);
+            const Uint32 actual = SDL_crc32(initial, buffer + offset, len);
+            if (actual != expected) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: crc32 mismatch, len=%d offset=%d: 0x%08" SDL_PRIx32 " != 0x%08" SDL_PRIx32,
+                             variant->name, (int)len, (int)offset, actual, expected);
+                return 1;
+            }
+        }
+    }
+
+    /* Feeding data in pieces has to give the same result as all at once. */
+    for (i = 0; i < 100; ++i) {
+        const size_t total = (size_t)SDL_rand_r(seed, 64 * 1024);
+        const size_t split = total ? (size_t)SDL_rand_r(seed, (Sint32)total) : 0;
+        const Uint32 expected = SDL_crc32(0, buffer, total);
+        const Uint32 actual = SDL_crc32(SDL_crc32(0, buffer, split), buffer + split, total - split);
+        if (actual != expected) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: chained crc32 mismatch, total=%d split=%d", variant->name, (int)total, (int)split);
+            return 1;
+        }
+    }
+
+    SDL_Log("%s: output matches the reference implementation", variant->name);
+    return 0;
+}
+
+static double measure_mb_per_sec(Uint32 (*func)(Uint32, const Uint8 *, size_t), const Uint8 *buffer, size_t len, Uint64 total_bytes)
+{
+    const Uint64 iterations = SDL_max(total_bytes / len, 1);
+    Uint64 start, elapsed;
+    Uint32 crc = 0;
+    Uint64 i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        crc = func(crc, buffer, len);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    if (crc == 0x12345678) { /* keep the compiler from discarding the work */
+        SDL_Log("(lucky crc)");
+    }
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    return ((double)(iterations * len) / (1024.0 * 1024.0)) / ((double)elapsed / (double)SDL_GetPerformanceFrequency());
+}
+
+static Uint32 call_SDL_crc32(Uint32 crc, const Uint8 *data, size_t len)
+{
+    return SDL_crc32(crc, data, len);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint8 *buffer;
+    Uint64 seed = 0;
+    Uint64 total_bytes = 256 * 1024 * 1024;
+    int result = 0;
+    int i;
+    int j;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--megabytes") == 0 && argv[i + 1]) {
+                total_bytes = (Uint64)SDL_atoi(argv[i + 1]) * 1024 * 1024;
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--megabytes N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    buffer = (Uint8 *)SDL_malloc(BUFFER_SIZE + 8);
+    if (!buffer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        return 1;
+    }
+    for (i = 0; i < BUFFER_SIZE + 8; ++i) {
+        buffer[i] = (Uint8)SDL_rand_bits_r(&seed);
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(variants); ++i) {
+        result |= check_variant(&variants[i], buffer, &seed);
+    }
+
+    if (result == 0) {
+        for (j = 0; j < (int)SDL_arraysize(bench_sizes); ++j) {
+            const size_t len = bench_sizes[j];
+            /* the reference is very slow, so give it a fraction of the data. */
+            SDL_Log("%8d byte blocks: %-20s %9.1f MB/s", (int)len, "reference (bitwise)", measure_mb_per_sec(reference_crc32, buffer, len, total_bytes / 16));
+            for (i = 0; i < (int)SDL_arraysize(variants); ++i) {
+                select_variant(&variants[i]);
+                SDL_Log("%8d byte blocks: %-20s %9.1f MB/s", (int)len, variants[i].name, measure_mb_per_sec(call_SDL_crc32, buffer, len, total_bytes));
+            }
+        }
+    }
+
+    SDL_free(buffer);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
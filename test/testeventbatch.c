@@ -0,0 +1,189 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Compares the per-event cost of SDL_PushEvent() against SDL_PushEvents()
+   with a few batch sizes, with and without an event watcher installed, and
+   checks that the batched events come out of the queue in order. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define EVENTS_PER_ROUND 4096
+
+static const int batch_sizes[] = { 1, 16, 256, EVENTS_PER_ROUND };
+
+static int watched;
+
+static bool SDLCALL count_watch(void *userdata, SDL_Event *event)
+{
+    (void)userdata;
+    (void)event;
+    ++watched;
+    return true;
+}
+
+static void fill_events(SDL_Event *events, Uint32 event_type)
+{
+    int i;
+
+    SDL_memset(events, 0, EVENTS_PER_ROUND * sizeof(*events));
+    for (i = 0; i < EVENTS_PER_ROUND; ++i) {
+        events[i].type = event_type;
+        events[i].user.code = i;
+    }
+}
+
+/* Pull the round back out of the queue, making sure nothing was lost or reordered */
+static bool drain_events(Uint32 event_type)
+{
+    SDL_Event events[256];
+    int expected = 0;
+    int count, i;
+
+    while ((count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, event_type, event_type)) > 0) {
+        for (i = 0; i < count; ++i) {
+            if (events[i].user.code != expected) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Got event %d, expected %d", (int)events[i].user.code, expected);
+                return false;
+            }
+            ++expected;
+        }
+    }
+    if (expected != EVENTS_PER_ROUND) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Got %d events, expected %d", expected, EVENTS_PER_ROUND);
+        return false;
+    }
+    return true;
+}
+
+/* batch_size 0 means one SDL_PushEvent() call per event */
+static bool measure(SDL_Event *events, Uint32 event_type, int batch_size, int rounds, double *ns_per_event)
+{
+    Uint64 elapsed = 0;
+    int round, i;
+
+    for (round = 0; round < rounds; ++round) {
+        Uint64 start;
+
+        fill_events(events, event_type);
+        start = SDL_GetTicksNS();
+        if (batch_size == 0) {
+            for (i = 0; i < EVENTS_PER_ROUND; ++i) {
+                if (!SDL_PushEvent(&events[i])) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_PushEvent failed: %s", SDL_GetError());
+                    return false;
+                }
+            }
+        } else {
+            for (i = 0; i < EVENTS_PER_ROUND; i += batch_size) {
+                const int count = SDL_min(batch_size, EVENTS_PER_ROUND - i);
+                if (SDL_PushEvents(&events[i], count) != count) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_PushEvents failed: %s", SDL_GetError());
+                    return false;
+                }
+            }
+        }
+        elapsed += SDL_GetTicksNS() - start;
+
+        if (!drain_events(event_type)) {
+            return false;
+        }
+    }
+
+    *ns_per_event = (double)elapsed / ((double)rounds * EVENTS_PER_ROUND);
+    return true;
+}
+
+static int run(bool lockfree, bool with_watch, int rounds)
+{
+    SDL_Event *events;
+    Uint32 event_type;
+    double single_ns, batch_ns;
+    int result = 0;
+    int i;
+
+    SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, lockfree ? "1" : "0");
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+    event_type = SDL_RegisterEvents(1);
+
+    events = (SDL_Event *)SDL_malloc(EVENTS_PER_ROUND * sizeof(*events));
+    if (!events) {
+        SDL_Quit();
+        return 1;
+    }
+
+    if (with_watch) {
+        SDL_AddEventWatch(count_watch, NULL);
+    }
+
+    SDL_Log("%s queue, %s:", lockfree ? "lock-free" : "locked", with_watch ? "one event watcher" : "no event watchers");
+    if (!measure(events, event_type, 0, rounds, &single_ns)) {
+        result = 1;
+    } else {
+        SDL_Log("    SDL_PushEvent            %7.1f ns/event", single_ns);
+    }
+    for (i = 0; i < (int)SDL_arraysize(batch_sizes) && result == 0; ++i) {
+        if (!measure(events, event_type, batch_sizes[i], rounds, &batch_ns)) {
+            result = 1;
+        } else {
+            SDL_Log("    SDL_PushEvents, batch %4d %7.1f ns/event (%.2fx)", batch_sizes[i], batch_ns, single_ns / batch_ns);
+        }
+    }
+
+    if (with_watch) {
+        SDL_RemoveEventWatch(count_watch, NULL);
+    }
+    SDL_free(events);
+    SDL_Quit();
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int rounds = 100;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--rounds") == 0 && argv[i + 1]) {
+                rounds = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--rounds N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    result |= run(false, false, rounds);
+    result |= run(false, true, rounds);
+    result |= run(true, false, rounds);
+    result |= run(true, true, rounds);
+
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
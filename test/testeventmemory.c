@@ -0,0 +1,222 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures the cost of events that carry temporary memory, using clipboard
+   updates, and counts how many heap allocations each one takes. Updates are
+   also sent from another thread, which exits before the events are read, to
+   check that the memory outlives the thread that allocated it. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static const char *mime_types[] = {
+    "text/plain;charset=utf-8",
+    "text/plain",
+    "application/x-testeventmemory"
+};
+
+static SDL_malloc_func real_malloc;
+static SDL_calloc_func real_calloc;
+static SDL_realloc_func real_realloc;
+static SDL_free_func real_free;
+static SDL_AtomicInt num_allocations;
+
+static void * SDLCALL counting_malloc(size_t size)
+{
+    SDL_AddAtomicInt(&num_allocations, 1);
+    return real_malloc(size);
+}
+
+static void * SDLCALL counting_calloc(size_t nmemb, size_t size)
+{
+    SDL_AddAtomicInt(&num_allocations, 1);
+    return real_calloc(nmemb, size);
+}
+
+static void * SDLCALL counting_realloc(void *mem, size_t size)
+{
+    if (!mem) {
+        SDL_AddAtomicInt(&num_allocations, 1);
+    }
+    return real_realloc(mem, size);
+}
+
+static void SDLCALL counting_free(void *mem)
+{
+    real_free(mem);
+}
+
+static const void * SDLCALL clipboard_callback(void *userdata, const char *mime_type, size_t *size)
+{
+    static const char text[] = "testeventmemory";
+    (void)userdata;
+    (void)mime_type;
+    *size = sizeof(text) - 1;
+    return text;
+}
+
+static bool set_clipboard(void)
+{
+    if (!SDL_SetClipboardData(clipboard_callback, NULL, NULL, mime_types, SDL_arraysize(mime_types))) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set clipboard data: %s", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+/* Reads all pending events, returns the number of clipboard updates or -1 if one was damaged */
+static int read_events(void)
+{
+    SDL_Event event;
+    int updates = 0;
+    int i;
+
+    while (SDL_PollEvent(&event)) {
+        if (event.type != SDL_EVENT_CLIPBOARD_UPDATE || !event.clipboard.owner) {
+            continue;
+        }
+        if (event.clipboard.num_mime_types != SDL_arraysize(mime_types)) {
+            return -1;
+        }
+        for (i = 0; i < (int)SDL_arraysize(mime_types); ++i) {
+            if (SDL_strcmp(event.clipboard.mime_types[i], mime_types[i]) != 0) {
+                return -1;
+            }
+        }
+        ++updates;
+    }
+    return updates;
+}
+
+static int SDLCALL update_thread(void *data)
+{
+    int count = *(int *)data;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        if (!set_clipboard()) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int run(int batch, int rounds)
+{
+    Uint64 start, elapsed;
+    int allocations;
+    int updates = 0;
+    int round, i;
+
+    /* Warm up, so the event queue and the clipboard state are already allocated */
+    if (!set_clipboard() || read_events() != 1) {
+        return 1;
+    }
+
+    SDL_SetAtomicInt(&num_allocations, 0);
+    start = SDL_GetTicksNS();
+    for (round = 0; round < rounds; ++round) {
+        int read;
+
+        for (i = 0; i < batch; ++i) {
+            if (!set_clipboard()) {
+                return 1;
+            }
+        }
+        read = read_events();
+        if (read != batch) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Expected %d clipboard updates, got %d", batch, read);
+            return 1;
+        }
+        updates += read;
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    allocations = SDL_GetAtomicInt(&num_allocations);
+
+    SDL_Log("%d clipboard updates in batches of %d: %.1f ns and %.2f heap allocations per update",
+            updates, batch, (double)elapsed / updates, (double)allocations / updates);
+    return 0;
+}
+
+static int run_threaded(int count)
+{
+    SDL_Thread *thread;
+    int status = 1;
+    int read;
+
+    thread = SDL_CreateThread(update_thread, "Clipboard", &count);
+    if (!thread) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+        return 1;
+    }
+    SDL_WaitThread(thread, &status);
+    if (status != 0) {
+        return 1;
+    }
+
+    read = read_events();
+    if (read != count) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Expected %d clipboard updates from another thread, got %d", count, read);
+        return 1;
+    }
+    SDL_Log("%d clipboard updates from a thread that has exited: OK", read);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int rounds = 10000;
+    int result = 0;
+    int i;
+
+    /* This has to happen before anything is allocated */
+    SDL_GetOriginalMemoryFunctions(&real_malloc, &real_calloc, &real_realloc, &real_free);
+    if (!SDL_SetMemoryFunctions(counting_malloc, counting_calloc, counting_realloc, counting_free)) {
+        return 1;
+    }
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--rounds") == 0 && argv[i + 1]) {
+                rounds = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--rounds N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    result |= run(1, rounds);
+    result |= run(100, SDL_max(rounds / 100, 1));
+    result |= run_threaded(1000);
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,236 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Event queue throughput: several threads push user events as fast as they
+   can while the main thread drains the queue. Checks that every event
+   arrives exactly once and in order for each thread, with and without
+   SDL_HINT_EVENT_QUEUE_LOCKFREE. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_PRODUCERS 64
+#define PEEP_BATCH 256
+
+typedef struct QueueVariant
+{
+    const char *name;
+    const char *lockfree;
+    bool use_poll;
+} QueueVariant;
+
+static const QueueVariant variants[] = {
+    { "locked list, SDL_PeepEvents", "0", false },
+    { "lock-free ring, SDL_PeepEvents", "1", false },
+    { "locked list, SDL_PollEvent", "0", true },
+    { "lock-free ring, SDL_PollEvent", "1", true }
+};
+
+typedef struct Producer
+{
+    SDL_Thread *thread;
+    int index;
+    int num_events;
+    Uint32 event_type;
+    int next_expected;
+    int queue_full;
+} Producer;
+
+static SDL_AtomicInt start_flag;
+static SDL_AtomicInt stop_flag;
+
+static int SDLCALL producer_thread(void *data)
+{
+    Producer *producer = (Producer *)data;
+    SDL_Event event;
+    int i;
+
+    while (!SDL_GetAtomicInt(&start_flag)) {
+        SDL_Delay(0);
+    }
+
+    SDL_zero(event);
+    event.type = producer->event_type;
+    event.user.code = producer->index;
+    for (i = 0; i < producer->num_events; ++i) {
+        event.common.timestamp = 0;
+        event.user.data1 = (void *)(intptr_t)i;
+        while (!SDL_PushEvent(&event)) {
+            /* The queue is full, give the consumer a chance to catch up */
+            if (SDL_GetAtomicInt(&stop_flag)) {
+                return 0;
+            }
+            ++producer->queue_full;
+            SDL_Delay(0);
+        }
+    }
+    return 0;
+}
+
+static bool check_event(const SDL_Event *event, Producer *producers, int num_producers, Uint32 event_type)
+{
+    Producer *producer;
+    int sequence;
+
+    if (event->type != event_type) {
+        return true; /* something from SDL itself, ignore it */
+    }
+    if (event->user.code < 0 || event->user.code >= num_producers) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Event from unknown producer %d", (int)event->user.code);
+        return false;
+    }
+    producer = &producers[event->user.code];
+    sequence = (int)(intptr_t)event->user.data1;
+    if (sequence != producer->next_expected) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Producer %d: got event %d, expected %d", producer->index, sequence, producer->next_expected);
+        return false;
+    }
+    ++producer->next_expected;
+    return true;
+}
+
+static int run_variant(const QueueVariant *variant, int num_producers, int events_per_producer)
+{
+    Producer producers[MAX_PRODUCERS];
+    SDL_Event events[PEEP_BATCH];
+    Uint32 event_type;
+    Uint64 start, elapsed;
+    int received = 0;
+    int queue_full = 0;
+    int result = 0;
+    int i;
+
+    SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, variant->lockfree);
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+    event_type = SDL_RegisterEvents(1);
+
+    SDL_SetAtomicInt(&start_flag, 0);
+    SDL_SetAtomicInt(&stop_flag, 0);
+    for (i = 0; i < num_producers; ++i) {
+        char name[32];
+        SDL_zero(producers[i]);
+        producers[i].index = i;
+        producers[i].num_events = events_per_producer;
+        producers[i].event_type = event_type;
+        (void)SDL_snprintf(name, sizeof(name), "Producer%d", i);
+        producers[i].thread = SDL_CreateThread(producer_thread, name, &producers[i]);
+        if (!producers[i].thread) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+            num_producers = i;
+            result = 1;
+            break;
+        }
+    }
+
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&start_flag, 1);
+    while (received < num_producers * events_per_producer && result == 0) {
+        int count = 0;
+        if (variant->use_poll) {
+            while (received < num_producers * events_per_producer && SDL_PollEvent(&events[0])) {
+                if (!check_event(&events[0], producers, num_producers, event_type)) {
+                    result = 1;
+                    break;
+                }
+                if (events[0].type == event_type) {
+                    ++received;
+                }
+                ++count;
+            }
+        } else {
+            count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, event_type, event_type);
+            for (i = 0; i < count; ++i) {
+                if (!check_event(&events[i], producers, num_producers, event_type)) {
+                    result = 1;
+                    break;
+                }
+            }
+            received += SDL_max(count, 0);
+        }
+        if (count <= 0) {
+            SDL_Delay(0);
+        }
+        if ((SDL_GetTicksNS() - start) > 60 * SDL_NS_PER_SECOND) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Timed out after %d of %d events", received, num_producers * events_per_producer);
+            result = 1;
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_SetAtomicInt(&stop_flag, 1);
+    for (i = 0; i < num_producers; ++i) {
+        SDL_WaitThread(producers[i].thread, NULL);
+        queue_full += producers[i].queue_full;
+    }
+
+    if (result == 0) {
+        const int total = num_producers * events_per_producer;
+        SDL_Log("%-32s %2d threads: %8.2f M events/s, %6.1f ns/event, queue full %d times",
+                variant->name, num_producers,
+                (double)total / ((double)elapsed / SDL_NS_PER_SECOND) / 1000000.0,
+                (double)elapsed / total, queue_full);
+    }
+
+    SDL_Quit();
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_producers = 0;
+    int events_per_producer = 200000;
+    int result = 0;
+    int i, j;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                num_producers = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_PRODUCERS);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--events") == 0 && argv[i + 1]) {
+                events_per_producer = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--threads N]", "[--events N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(variants) && result == 0; ++i) {
+        if (num_producers > 0) {
+            result |= run_variant(&variants[i], num_producers, events_per_producer);
+        } else {
+            static const int default_producers[] = { 1, 4, 8 };
+            for (j = 0; j < (int)SDL_arraysize(default_producers); ++j) {
+                result |= run_variant(&variants[i], default_producers[j], events_per_producer);
+            }
+        }
+    }
+
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
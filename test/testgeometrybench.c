@@ -0,0 +1,201 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Reports SDL_RenderGeometry() throughput with the software renderer,
+   drawing into an offscreen surface, for solid, gradient, textured and
+   blended triangles of a few sizes. The CRC of each result is logged so
+   changes to the rasterizer's output are easy to spot. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define TRIANGLES_PER_BATCH 1024
+
+typedef struct GeometryCase
+{
+    const char *name;
+    bool gradient;
+    bool textured;
+    SDL_BlendMode blend;
+} GeometryCase;
+
+static const GeometryCase cases[] = {
+    { "solid", false, false, SDL_BLENDMODE_NONE },
+    { "gradient", true, false, SDL_BLENDMODE_NONE },
+    { "solid, blended", false, false, SDL_BLENDMODE_BLEND },
+    { "textured", false, true, SDL_BLENDMODE_NONE },
+    { "textured, gradient", true, true, SDL_BLENDMODE_NONE },
+    { "textured, blended", true, true, SDL_BLENDMODE_BLEND }
+};
+
+static const int triangle_sizes[] = { 8, 64, 512 };
+
+static SDL_Texture *create_texture(SDL_Renderer *renderer)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int x, y;
+
+    surface = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_XRGB8888);
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < surface->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < surface->w; ++x) {
+            row[x] = ((x ^ y) & 8) ? 0x00FF00FF : (Uint32)((x * 4) << 16 | (y * 4) << 8 | 0x40);
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    return texture;
+}
+
+static void make_batch(SDL_Vertex *verts, int size, int width, int height, bool gradient, Uint64 *seed)
+{
+    int i, j;
+
+    for (i = 0; i < TRIANGLES_PER_BATCH; ++i) {
+        const float x = (float)SDL_rand_r(seed, width);
+        const float y = (float)SDL_rand_r(seed, height);
+        for (j = 0; j < 3; ++j) {
+            SDL_Vertex *v = &verts[i * 3 + j];
+            v->position.x = x + (float)SDL_rand_r(seed, size * 2 + 1) - size + SDL_randf_r(seed);
+            v->position.y = y + (float)SDL_rand_r(seed, size * 2 + 1) - size + SDL_randf_r(seed);
+            if (gradient) {
+                v->color.r = SDL_randf_r(seed);
+                v->color.g = SDL_randf_r(seed);
+                v->color.b = SDL_randf_r(seed);
+                v->color.a = 0.25f + SDL_randf_r(seed) * 0.75f;
+            } else {
+                v->color.r = 0.75f;
+                v->color.g = 0.5f;
+                v->color.b = 0.25f;
+                v->color.a = 0.75f;
+            }
+            v->tex_coord.x = (j == 1) ? 1.0f : 0.0f;
+            v->tex_coord.y = (j == 2) ? 1.0f : 0.0f;
+        }
+    }
+}
+
+static int run_case(SDL_Renderer *renderer, SDL_Surface *surface, const GeometryCase *geometry, int size, Uint64 total_pixels)
+{
+    SDL_Vertex *verts;
+    SDL_Texture *texture = NULL;
+    Uint64 seed = (Uint64)size;
+    Uint64 start, elapsed;
+    Uint64 triangles = 0;
+    Uint32 crc;
+    int batches, i;
+
+    verts = (SDL_Vertex *)SDL_malloc(TRIANGLES_PER_BATCH * 3 * sizeof(*verts));
+    if (!verts) {
+        return 1;
+    }
+    if (geometry->textured) {
+        texture = create_texture(renderer);
+        if (!texture) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture: %s", SDL_GetError());
+            SDL_free(verts);
+            return 1;
+        }
+        SDL_SetTextureBlendMode(texture, geometry->blend);
+    }
+    SDL_SetRenderDrawBlendMode(renderer, geometry->blend);
+
+    /* Roughly the same number of pixels for each size */
+    batches = (int)SDL_max(total_pixels / ((Uint64)size * size / 2 * TRIANGLES_PER_BATCH), 1);
+
+    SDL_SetRenderDrawColor(renderer, 0x20, 0x40, 0x60, 0xFF);
+    SDL_RenderClear(renderer);
+    SDL_FlushRenderer(renderer);
+
+    elapsed = 0;
+    for (i = 0; i < batches; ++i) {
+        make_batch(verts, size, surface->w, surface->h, geometry->gradient, &seed);
+        start = SDL_GetTicksNS();
+        SDL_RenderGeometry(renderer, texture, verts, TRIANGLES_PER_BATCH * 3, NULL, 0);
+        SDL_FlushRenderer(renderer);
+        elapsed += SDL_GetTicksNS() - start;
+        triangles += TRIANGLES_PER_BATCH;
+    }
+
+    crc = SDL_crc32(0, surface->pixels, (size_t)surface->pitch * surface->h);
+    SDL_Log("%-20s %4dpx: %9.1f Ktri/s, %8.1f Mpix/s, crc 0x%08" SDL_PRIx32,
+            geometry->name, size,
+            ((double)triangles / 1000.0) / ((double)SDL_max(elapsed, 1) / SDL_NS_PER_SECOND),
+            ((double)triangles * size * size / 2 / 1000000.0) / ((double)SDL_max(elapsed, 1) / SDL_NS_PER_SECOND),
+            crc);
+
+    SDL_DestroyTexture(texture);
+    SDL_free(verts);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_Surface *surface;
+    SDL_Renderer *renderer;
+    Uint64 total_pixels = 50 * 1000 * 1000;
+    int width = 1280;
+    int height = 720;
+    int result = 0;
+    int i, j;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1] && argv[i + 2]) {
+                width = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                height = SDL_max(SDL_atoi(argv[i + 2]), 1);
+                consumed = 3;
+            } else if (SDL_strcmp(argv[i], "--megapixels") == 0 && argv[i + 1]) {
+                total_pixels = (Uint64)SDL_max(SDL_atoi(argv[i + 1]), 1) * 1000 * 1000;
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--size W H]", "[--megapixels N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    surface = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    renderer = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    if (!renderer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create renderer: %s", SDL_GetError());
+        SDL_DestroySurface(surface);
+        return 1;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(cases); ++i) {
+        for (j = 0; j < (int)SDL_arraysize(triangle_sizes); ++j) {
+            result |= run_case(renderer, surface, &cases[i], triangle_sizes[j], total_pixels);
+        }
+    }
+
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
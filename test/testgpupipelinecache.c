@@ -0,0 +1,316 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how long it takes to create a set of graphics pipelines on a
+   fresh GPU device (cold), and again on a device created with the pipeline
+   cache saved from the first one (warm). Also checks that a damaged cache is
+   ignored rather than breaking device creation.
+
+   With --cache FILE the cache is loaded from and saved to FILE, so running
+   the program twice shows a real cold and warm start. Mesa drivers keep
+   their own shader cache on disk; set MESA_SHADER_CACHE_DISABLE=true to
+   measure SDL's cache alone. This runs headless with
+   SDL_VIDEO_DRIVER=offscreen, for example on lavapipe, and does nothing if
+   there is no Vulkan device. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "testgpu/testgpu_spirv.h"
+
+static SDL_GPUDevice *create_device(const void *cache, size_t cache_size)
+{
+    SDL_PropertiesID props = SDL_CreateProperties();
+    SDL_GPUDevice *device;
+
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_DEBUGMODE_BOOLEAN, false);
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VERBOSE_BOOLEAN, false);
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_SHADERS_SPIRV_BOOLEAN, true);
+    SDL_SetStringProperty(props, SDL_PROP_GPU_DEVICE_CREATE_NAME_STRING, "vulkan");
+    if (cache) {
+        SDL_SetPointerProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_POINTER, (void *)cache);
+        SDL_SetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_PIPELINECACHE_SIZE_NUMBER, (Sint64)cache_size);
+    }
+    device = SDL_CreateGPUDeviceWithProperties(props);
+    SDL_DestroyProperties(props);
+    return device;
+}
+
+static SDL_GPUShader *create_shader(SDL_GPUDevice *device, bool is_vertex)
+{
+    SDL_GPUShaderCreateInfo createinfo;
+
+    SDL_zero(createinfo);
+    createinfo.code = is_vertex ? cube_vert_spv : cube_frag_spv;
+    createinfo.code_size = is_vertex ? cube_vert_spv_len : cube_frag_spv_len;
+    createinfo.entrypoint = "main";
+    createinfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
+    createinfo.stage = is_vertex ? SDL_GPU_SHADERSTAGE_VERTEX : SDL_GPU_SHADERSTAGE_FRAGMENT;
+    createinfo.num_uniform_buffers = is_vertex ? 1 : 0;
+    return SDL_CreateGPUShader(device, &createinfo);
+}
+
+/* Each index gets a different combination of state, so the driver has to compile a new pipeline */
+static void fill_pipeline_info(int index, SDL_GPUShader *vertex_shader, SDL_GPUShader *fragment_shader,
+                               SDL_GPUGraphicsPipelineCreateInfo *info, SDL_GPUColorTargetDescription *color_target,
+                               SDL_GPUVertexBufferDescription *vertex_buffer, SDL_GPUVertexAttribute *vertex_attributes)
+{
+    static const SDL_GPUTextureFormat formats[] = {
+        SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+        SDL_GPU_TEXTUREFORMAT_B8G8R8A8_UNORM,
+        SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT,
+        SDL_GPU_TEXTUREFORMAT_R10G10B10A2_UNORM
+    };
+    static const SDL_GPUCullMode cull_modes[] = {
+        SDL_GPU_CULLMODE_NONE,
+        SDL_GPU_CULLMODE_FRONT,
+        SDL_GPU_CULLMODE_BACK
+    };
+    const int blend_mode = index % 4;
+
+    SDL_zerop(info);
+    SDL_zerop(color_target);
+
+    color_target->format = formats[(index / 4) % SDL_arraysize(formats)];
+    if (blend_mode != 0) {
+        color_target->blend_state.enable_blend = true;
+        color_target->blend_state.color_blend_op = SDL_GPU_BLENDOP_ADD;
+        color_target->blend_state.alpha_blend_op = SDL_GPU_BLENDOP_ADD;
+        color_target->blend_state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+        color_target->blend_state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+        if (blend_mode == 1) {
+            color_target->blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
+            color_target->blend_state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+        } else if (blend_mode == 2) {
+            color_target->blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
+            color_target->blend_state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+        } else {
+            color_target->blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_ZERO;
+            color_target->blend_state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_COLOR;
+        }
+    }
+
+    info->target_info.num_color_targets = 1;
+    info->target_info.color_target_descriptions = color_target;
+    if ((index / 16) % 2) {
+        info->target_info.depth_stencil_format = SDL_GPU_TEXTUREFORMAT_D16_UNORM;
+        info->target_info.has_depth_stencil_target = true;
+        info->depth_stencil_state.enable_depth_test = true;
+        info->depth_stencil_state.enable_depth_write = true;
+        info->depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL;
+    }
+
+    info->rasterizer_state.cull_mode = cull_modes[(index / 32) % SDL_arraysize(cull_modes)];
+    info->primitive_type = ((index / 96) % 2) ? SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP : SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+    info->multisample_state.sample_count = SDL_GPU_SAMPLECOUNT_1;
+    info->vertex_shader = vertex_shader;
+    info->fragment_shader = fragment_shader;
+
+    vertex_buffer->slot = 0;
+    vertex_buffer->input_rate = SDL_GPU_VERTEXINPUTRATE_VERTEX;
+    vertex_buffer->instance_step_rate = 0;
+    vertex_buffer->pitch = sizeof(float) * 6;
+
+    vertex_attributes[0].buffer_slot = 0;
+    vertex_attributes[0].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+    vertex_attributes[0].location = 0;
+    vertex_attributes[0].offset = 0;
+
+    vertex_attributes[1].buffer_slot = 0;
+    vertex_attributes[1].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+    vertex_attributes[1].location = 1;
+    vertex_attributes[1].offset = sizeof(float) * 3;
+
+    info->vertex_input_state.num_vertex_buffers = 1;
+    info->vertex_input_state.vertex_buffer_descriptions = vertex_buffer;
+    info->vertex_input_state.num_vertex_attributes = 2;
+    info->vertex_input_state.vertex_attributes = vertex_attributes;
+}
+
+/* Creates a device and the pipelines, returns the time taken or 0 on failure, and the resulting cache */
+static Uint64 run_case(const char *name, int num_pipelines, const void *cache, size_t cache_size, void **saved, size_t *saved_size)
+{
+    SDL_GPUDevice *device;
+    SDL_GPUShader *vertex_shader = NULL;
+    SDL_GPUShader *fragment_shader = NULL;
+    SDL_GPUGraphicsPipeline **pipelines;
+    Uint64 start, device_ns, elapsed = 0;
+    int i;
+
+    pipelines = (SDL_GPUGraphicsPipeline **)SDL_calloc(num_pipelines, sizeof(*pipelines));
+    if (!pipelines) {
+        return 0;
+    }
+
+    start = SDL_GetTicksNS();
+    device = create_device(cache, cache_size);
+    if (!device) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: couldn't create GPU device: %s", name, SDL_GetError());
+        goto done;
+    }
+    device_ns = SDL_GetTicksNS() - start;
+
+    vertex_shader = create_shader(device, true);
+    fragment_shader = create_shader(device, false);
+    if (!vertex_shader || !fragment_shader) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: couldn't create shaders: %s", name, SDL_GetError());
+        goto done;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_pipelines; ++i) {
+        SDL_GPUGraphicsPipelineCreateInfo info;
+        SDL_GPUColorTargetDescription color_target;
+        SDL_GPUVertexBufferDescription vertex_buffer;
+        SDL_GPUVertexAttribute vertex_attributes[2];
+
+        fill_pipeline_info(i, vertex_shader, fragment_shader, &info, &color_target, &vertex_buffer, vertex_attributes);
+        pipelines[i] = SDL_CreateGPUGraphicsPipeline(device, &info);
+        if (!pipelines[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: couldn't create pipeline %d: %s", name, i, SDL_GetError());
+            goto done;
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    if (saved) {
+        *saved = SDL_GetGPUPipelineCacheData(device, saved_size);
+        if (!*saved) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: couldn't get pipeline cache: %s", name, SDL_GetError());
+            elapsed = 0;
+            goto done;
+        }
+    }
+
+    SDL_Log("%-14s device %7.2f ms, %4d pipelines %9.2f ms (%7.3f ms each)",
+            name, device_ns / 1e6, num_pipelines, elapsed / 1e6, elapsed / 1e6 / num_pipelines);
+
+done:
+    if (device) {
+        for (i = 0; i < num_pipelines; ++i) {
+            if (pipelines[i]) {
+                SDL_ReleaseGPUGraphicsPipeline(device, pipelines[i]);
+            }
+        }
+        if (vertex_shader) {
+            SDL_ReleaseGPUShader(device, vertex_shader);
+        }
+        if (fragment_shader) {
+            SDL_ReleaseGPUShader(device, fragment_shader);
+        }
+        SDL_DestroyGPUDevice(device);
+    }
+    SDL_free(pipelines);
+    return elapsed;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    const char *cache_file = NULL;
+    int num_pipelines = 64;
+    void *cache = NULL;
+    size_t cache_size = 0;
+    void *saved = NULL;
+    size_t saved_size = 0;
+    Uint64 cold, warm;
+    int result = 1;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--pipelines") == 0 && argv[i + 1]) {
+                num_pipelines = SDL_clamp(SDL_atoi(argv[i + 1]), 1, 192);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--cache") == 0 && argv[i + 1]) {
+                cache_file = argv[i + 1];
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--pipelines N]", "[--cache FILE]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (!SDL_GPUSupportsShaderFormats(SDL_GPU_SHADERFORMAT_SPIRV, "vulkan")) {
+        SDL_Log("No Vulkan device available, skipping");
+        result = 0;
+        goto done;
+    }
+
+    if (cache_file) {
+        cache = SDL_LoadFile(cache_file, &cache_size);
+        if (cache) {
+            SDL_Log("Loaded %u bytes of pipeline cache from %s", (unsigned int)cache_size, cache_file);
+        }
+    }
+
+    /* Without a cache file this is a cold start, with one it's a warm start from a previous run */
+    cold = run_case(cache ? "from file" : "cold", num_pipelines, cache, cache_size, &saved, &saved_size);
+    if (!cold) {
+        goto done;
+    }
+    SDL_Log("Pipeline cache is %u bytes", (unsigned int)saved_size);
+
+    warm = run_case("warm", num_pipelines, saved, saved_size, NULL, NULL);
+    if (!warm) {
+        goto done;
+    }
+    SDL_Log("Warm pipeline creation is %.1fx as fast", (double)cold / warm);
+
+    /* Damaged caches must be ignored, not handed to the driver */
+    if (saved_size > 0) {
+        ((Uint8 *)saved)[saved_size - 1] ^= 0xFF;
+        if (!run_case("corrupt", num_pipelines, saved, saved_size, NULL, NULL)) {
+            goto done;
+        }
+        ((Uint8 *)saved)[saved_size - 1] ^= 0xFF;
+        if (!run_case("truncated", num_pipelines, saved, saved_size / 2, NULL, NULL)) {
+            goto done;
+        }
+        if (!run_case("garbage", num_pipelines, cube_vert_spv, cube_vert_spv_len, NULL, NULL)) {
+            goto done;
+        }
+    }
+
+    if (cache_file) {
+        if (!SDL_SaveFile(cache_file, saved, saved_size)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't save pipeline cache to %s: %s", cache_file, SDL_GetError());
+            goto done;
+        }
+        SDL_Log("Saved pipeline cache to %s", cache_file);
+    }
+
+    result = 0;
+
+done:
+    SDL_free(saved);
+    SDL_free(cache);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,289 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmarks the internal SDL_HashTable: insert, find (hits and misses),
+   iterate and remove from 1e3 up to 1e7 entries, and lookups from several
+   reader threads while a writer keeps changing a thread-safe table. The
+   table isn't exported from SDL, so it's built straight into this test. */
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_hashtable.c"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_READERS 16
+
+/* Keys are IDs, and never 0. The value is derived from the key, so lookups can be checked. */
+#define KEY(i) ((const void *)(uintptr_t)((Uint32)(i) * 2 + 1))
+#define MISSING_KEY(i) ((const void *)(uintptr_t)((Uint32)(i) * 2 + 2))
+#define VALUE(key) ((const void *)((uintptr_t)(key) ^ 0x5a5a5a5a))
+
+static double ns_per_op(Uint64 start, int ops)
+{
+    return (double)(SDL_GetTicksNS() - start) / SDL_max(ops, 1);
+}
+
+typedef struct IterateData
+{
+    Uint64 sum;
+    int count;
+} IterateData;
+
+static bool SDLCALL iterate_item(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    IterateData *data = (IterateData *)userdata;
+    (void)table;
+    data->sum += (uintptr_t)key;
+    data->count += (value == VALUE(key));
+    return true;
+}
+
+static int run_single(int num_items)
+{
+    SDL_HashTable *table;
+    IterateData iterated;
+    const void *value;
+    Uint64 start, expected_sum = 0;
+    double insert_ns, find_ns, miss_ns, iterate_ns, remove_ns;
+    int found = 0, missed = 0;
+    int i;
+
+    table = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!table) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create hash table: %s", SDL_GetError());
+        return 1;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_items; ++i) {
+        if (!SDL_InsertIntoHashTable(table, KEY(i), VALUE(KEY(i)), false)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Insert %d failed: %s", i, SDL_GetError());
+            SDL_DestroyHashTable(table);
+            return 1;
+        }
+    }
+    insert_ns = ns_per_op(start, num_items);
+
+    /* Look up in a scattered order, so successive lookups don't share cache lines */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_items; ++i) {
+        const void *key = KEY(((Uint32)i * 2654435761u) % (Uint32)num_items);
+        found += (SDL_FindInHashTable(table, key, &value) && value == VALUE(key));
+    }
+    find_ns = ns_per_op(start, num_items);
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_items; ++i) {
+        missed += !SDL_FindInHashTable(table, MISSING_KEY(i), NULL);
+    }
+    miss_ns = ns_per_op(start, num_items);
+
+    SDL_zero(iterated);
+    start = SDL_GetTicksNS();
+    SDL_IterateHashTable(table, iterate_item, &iterated);
+    iterate_ns = ns_per_op(start, num_items);
+    for (i = 0; i < num_items; ++i) {
+        expected_sum += (uintptr_t)KEY(i);
+    }
+
+    /* Remove every other item, then make sure the rest are still there */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_items; i += 2) {
+        if (!SDL_RemoveFromHashTable(table, KEY(i))) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Remove %d failed", i);
+            SDL_DestroyHashTable(table);
+            return 1;
+        }
+    }
+    remove_ns = ns_per_op(start, (num_items + 1) / 2);
+    for (i = 0; i < num_items; ++i) {
+        if (SDL_FindInHashTable(table, KEY(i), NULL) != ((i % 2) != 0)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Item %d is in the wrong state after removal", i);
+            SDL_DestroyHashTable(table);
+            return 1;
+        }
+    }
+    SDL_DestroyHashTable(table);
+
+    if (found != num_items || missed != num_items || iterated.count != num_items || iterated.sum != expected_sum) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d items: found %d, missed %d, iterated %d", num_items, found, missed, iterated.count);
+        return 1;
+    }
+
+    SDL_Log("%9d items: insert %6.1f, find %6.1f, miss %6.1f, iterate %5.1f, remove %6.1f ns/op",
+            num_items, insert_ns, find_ns, miss_ns, iterate_ns, remove_ns);
+    return 0;
+}
+
+typedef struct Reader
+{
+    SDL_Thread *thread;
+    SDL_HashTable *table;
+    int num_items;
+    int lookups;
+    int failures;
+} Reader;
+
+static SDL_AtomicInt start_flag;
+static SDL_AtomicInt stop_flag;
+
+static int SDLCALL reader_thread(void *data)
+{
+    Reader *reader = (Reader *)data;
+    const void *value;
+    Uint32 i = (Uint32)(uintptr_t)reader;
+
+    while (!SDL_GetAtomicInt(&start_flag)) {
+        SDL_Delay(0);
+    }
+    while (!SDL_GetAtomicInt(&stop_flag)) {
+        const void *key = KEY((i * 2654435761u) % (Uint32)reader->num_items);
+        /* The writer only touches keys past num_items, so these are always there */
+        if (!SDL_FindInHashTable(reader->table, key, &value) || value != VALUE(key)) {
+            ++reader->failures;
+        }
+        ++reader->lookups;
+        ++i;
+    }
+    return 0;
+}
+
+static int run_threaded(int num_items, int num_readers, int milliseconds)
+{
+    Reader readers[MAX_READERS];
+    SDL_HashTable *table;
+    Uint64 start, elapsed;
+    int writes = 0;
+    int lookups = 0;
+    int result = 0;
+    int i;
+
+    table = SDL_CreateHashTable(0, true, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!table) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create hash table: %s", SDL_GetError());
+        return 1;
+    }
+    for (i = 0; i < num_items; ++i) {
+        SDL_InsertIntoHashTable(table, KEY(i), VALUE(KEY(i)), false);
+    }
+
+    SDL_SetAtomicInt(&start_flag, 0);
+    SDL_SetAtomicInt(&stop_flag, 0);
+    for (i = 0; i < num_readers; ++i) {
+        SDL_zero(readers[i]);
+        readers[i].table = table;
+        readers[i].num_items = num_items;
+        readers[i].thread = SDL_CreateThread(reader_thread, "Reader", &readers[i]);
+        if (!readers[i].thread) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+            num_readers = i;
+            result = 1;
+            break;
+        }
+    }
+
+    /* This thread is the writer, adding and removing a small set of extra keys */
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&start_flag, 1);
+    while ((SDL_GetTicksNS() - start) < SDL_MS_TO_NS(milliseconds)) {
+        const void *key = KEY(num_items + (writes % 1024));
+        if ((writes / 1024) % 2 == 0) {
+            SDL_InsertIntoHashTable(table, key, VALUE(key), true);
+        } else {
+            SDL_RemoveFromHashTable(table, key);
+        }
+        ++writes;
+    }
+    SDL_SetAtomicInt(&stop_flag, 1);
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < num_readers; ++i) {
+        SDL_WaitThread(readers[i].thread, NULL);
+        lookups += readers[i].lookups;
+        if (readers[i].failures) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reader %d: %d lookups failed", i, readers[i].failures);
+            result = 1;
+        }
+    }
+    SDL_DestroyHashTable(table);
+
+    if (result == 0) {
+        SDL_Log("%9d items, %2d readers + 1 writer: %7.2f M lookups/s, %7.2f M writes/s",
+                num_items, num_readers,
+                (double)lookups / ((double)elapsed / SDL_NS_PER_SECOND) / 1000000.0,
+                (double)writes / ((double)elapsed / SDL_NS_PER_SECOND) / 1000000.0);
+    }
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int max_items = 10000000;
+    int milliseconds = 500;
+    int result = 0;
+    int i, n;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--max-items") == 0 && argv[i + 1]) {
+                max_items = SDL_max(SDL_atoi(argv[i + 1]), 1000);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--milliseconds") == 0 && argv[i + 1]) {
+                milliseconds = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--max-items N]", "[--milliseconds N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    for (n = 1000; n <= max_items && result == 0; n *= 10) {
+        result |= run_single(n);
+    }
+    for (n = 1; n <= 8 && result == 0; n *= 2) {
+        result |= run_threaded(SDL_min(100000, max_items), n, milliseconds);
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
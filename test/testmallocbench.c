@@ -0,0 +1,210 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how SDL_malloc() and SDL_free() scale with the number of
+   threads, both when threads free their own small allocations and when
+   they free memory that another thread allocated. If SDL was built with
+   SDL_TRACK_ALLOCATION_COUNT, also checks that the count adds up. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_THREADS 16
+#define BATCH_SIZE 64
+#define MAX_ALLOCATION_SIZE 512
+
+typedef struct Worker
+{
+    SDL_Thread *thread;
+    int index;
+    int num_threads;
+    int rounds;
+    bool handoff;
+    int failures;
+} Worker;
+
+static SDL_AtomicInt start_flag;
+
+/* In handoff mode, each thread passes its batch to the next one through here */
+static void *mailboxes[MAX_THREADS];
+
+static void **allocate_batch(Uint64 *seed, int index)
+{
+    void **batch = (void **)SDL_malloc(BATCH_SIZE * sizeof(*batch));
+    int i;
+
+    if (!batch) {
+        return NULL;
+    }
+    for (i = 0; i < BATCH_SIZE; ++i) {
+        const size_t size = 8 + SDL_rand_r(seed, MAX_ALLOCATION_SIZE - 8);
+        batch[i] = SDL_malloc(size);
+        if (batch[i]) {
+            *(Uint8 *)batch[i] = (Uint8)index;
+        }
+    }
+    return batch;
+}
+
+static int free_batch(void **batch)
+{
+    int failures = 0;
+    int i;
+
+    for (i = 0; i < BATCH_SIZE; ++i) {
+        if (!batch[i]) {
+            ++failures;
+        }
+        SDL_free(batch[i]);
+    }
+    SDL_free(batch);
+    return failures;
+}
+
+static int SDLCALL worker_thread(void *data)
+{
+    Worker *worker = (Worker *)data;
+    Uint64 seed = worker->index;
+    int round;
+
+    while (!SDL_GetAtomicInt(&start_flag)) {
+        SDL_Delay(0);
+    }
+
+    for (round = 0; round < worker->rounds; ++round) {
+        void **batch = allocate_batch(&seed, worker->index);
+        if (!batch) {
+            ++worker->failures;
+            continue;
+        }
+
+        if (worker->handoff) {
+            void **next = (void **)&mailboxes[(worker->index + 1) % worker->num_threads];
+            void **mine = (void **)&mailboxes[worker->index];
+
+            while (!SDL_CompareAndSwapAtomicPointer(next, NULL, batch)) {
+                SDL_Delay(0);
+            }
+            while ((batch = (void **)SDL_GetAtomicPointer(mine)) == NULL) {
+                SDL_Delay(0);
+            }
+            SDL_SetAtomicPointer(mine, NULL);
+        }
+        worker->failures += free_batch(batch);
+    }
+    return 0;
+}
+
+static int run(int num_threads, bool handoff, int rounds)
+{
+    Worker workers[MAX_THREADS];
+    Uint64 start, elapsed;
+    const int allocations_before = SDL_GetNumAllocations();
+    int allocations_after;
+    int result = 0;
+    int i;
+
+    SDL_zeroa(mailboxes);
+    SDL_SetAtomicInt(&start_flag, 0);
+    for (i = 0; i < num_threads; ++i) {
+        SDL_zero(workers[i]);
+        workers[i].index = i;
+        workers[i].num_threads = num_threads;
+        workers[i].rounds = rounds;
+        workers[i].handoff = handoff;
+        workers[i].thread = SDL_CreateThread(worker_thread, "Allocate", &workers[i]);
+        if (!workers[i].thread) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+            /* The handoff ring needs every thread, so let the others run on their own */
+            SDL_SetAtomicInt(&start_flag, 1);
+            for (--i; i >= 0; --i) {
+                SDL_WaitThread(workers[i].thread, NULL);
+            }
+            return 1;
+        }
+    }
+
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&start_flag, 1);
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WaitThread(workers[i].thread, NULL);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < num_threads; ++i) {
+        if (workers[i].failures) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Thread %d: %d allocations failed", i, workers[i].failures);
+            result = 1;
+        }
+    }
+
+    /* Thread creation might have allocated too, but that's all gone by now */
+    allocations_after = SDL_GetNumAllocations();
+    if (allocations_after != allocations_before) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d allocations before, %d after", allocations_before, allocations_after);
+        result = 1;
+    }
+
+    if (result == 0) {
+        const double allocations = (double)num_threads * rounds * (BATCH_SIZE + 1);
+        SDL_Log("%2d thread%s freed by %-7s thread: %7.2f M allocations/s",
+                num_threads, (num_threads == 1) ? ", " : "s,", handoff ? "another" : "the same",
+                allocations / ((double)elapsed / SDL_NS_PER_SECOND) / 1000000.0);
+    }
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int max_threads = 8;
+    int rounds = 20000;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--max-threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_THREADS);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--rounds") == 0 && argv[i + 1]) {
+                rounds = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--max-threads N]", "[--rounds N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (SDL_GetNumAllocations() < 0) {
+        SDL_Log("SDL isn't tracking the number of allocations, so it won't be checked");
+    }
+    for (i = 1; i <= max_threads && result == 0; i *= 2) {
+        result |= run(i, false, rounds);
+        result |= run(i, true, rounds);
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
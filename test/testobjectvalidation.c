@@ -0,0 +1,233 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures the overhead of handle validation on cheap API calls with
+   SDL_HINT_INVALID_PARAM_CHECKS set to "1" and "2", from one and several
+   threads, with lots of live objects. Also checks that full validation
+   catches textures that were destroyed and handles of the wrong type. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_THREADS 16
+
+typedef struct Worker
+{
+    SDL_Thread *thread;
+    SDL_Texture **textures;
+    int num_textures;
+    int calls;
+    int failures;
+} Worker;
+
+static SDL_AtomicInt start_flag;
+
+static int SDLCALL worker_thread(void *data)
+{
+    Worker *worker = (Worker *)data;
+    float w, h;
+    int i;
+
+    while (!SDL_GetAtomicInt(&start_flag)) {
+        SDL_Delay(0);
+    }
+    for (i = 0; i < worker->calls; ++i) {
+        if (!SDL_GetTextureSize(worker->textures[i % worker->num_textures], &w, &h)) {
+            ++worker->failures;
+        }
+    }
+    return 0;
+}
+
+static bool measure(SDL_Texture **textures, int num_textures, int num_threads, int calls, double *ns_per_call)
+{
+    Worker workers[MAX_THREADS];
+    Uint64 start, elapsed;
+    bool result = true;
+    int i;
+
+    SDL_SetAtomicInt(&start_flag, 0);
+    for (i = 0; i < num_threads; ++i) {
+        SDL_zero(workers[i]);
+        workers[i].textures = textures;
+        workers[i].num_textures = num_textures;
+        workers[i].calls = calls;
+        if (i > 0) {
+            workers[i].thread = SDL_CreateThread(worker_thread, "Validate", &workers[i]);
+            if (!workers[i].thread) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+                num_threads = i;
+                result = false;
+                break;
+            }
+        }
+    }
+
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&start_flag, 1);
+    worker_thread(&workers[0]);
+    for (i = 1; i < num_threads; ++i) {
+        SDL_WaitThread(workers[i].thread, NULL);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < num_threads; ++i) {
+        if (workers[i].failures) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d calls on valid textures failed", workers[i].failures);
+            result = false;
+        }
+    }
+    *ns_per_call = (double)elapsed / ((double)calls * num_threads);
+    return result;
+}
+
+/* With full checks, stale and mistyped handles have to be rejected */
+static bool check_invalid_handles(SDL_Renderer *renderer)
+{
+    SDL_Texture *texture;
+    float w, h;
+    bool result = true;
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 1, 1);
+    if (!texture) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture: %s", SDL_GetError());
+        return false;
+    }
+    if (SDL_GetTextureSize((SDL_Texture *)renderer, &w, &h)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "A renderer was accepted as a texture");
+        result = false;
+    }
+    if (SDL_GetRendererName((SDL_Renderer *)texture) != NULL) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "A texture was accepted as a renderer");
+        result = false;
+    }
+    SDL_DestroyTexture(texture);
+    /* The pointer isn't dereferenced, the registry no longer knows about it */
+    if (SDL_GetTextureSize(texture, &w, &h)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "A destroyed texture was accepted");
+        result = false;
+    }
+    return result;
+}
+
+static int run(const char *checks, int num_textures, int max_threads, int calls)
+{
+    SDL_Surface *surface = NULL;
+    SDL_Renderer *renderer = NULL;
+    SDL_Texture **textures = NULL;
+    Uint64 start;
+    double create_ns, destroy_ns;
+    int result = 0;
+    int i;
+
+    SDL_SetHint(SDL_HINT_INVALID_PARAM_CHECKS, checks);
+
+    textures = (SDL_Texture **)SDL_calloc(num_textures, sizeof(*textures));
+    surface = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_XRGB8888);
+    if (textures && surface) {
+        renderer = SDL_CreateSoftwareRenderer(surface);
+    }
+    if (!renderer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create renderer: %s", SDL_GetError());
+        result = 1;
+        goto done;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_textures; ++i) {
+        textures[i] = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 1, 1);
+        if (!textures[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture: %s", SDL_GetError());
+            result = 1;
+            goto done;
+        }
+    }
+    create_ns = (double)(SDL_GetTicksNS() - start) / num_textures;
+
+    SDL_Log("SDL_INVALID_PARAM_CHECKS=%s, %d live textures, create %.1f ns/texture", checks, num_textures, create_ns);
+    for (i = 1; i <= max_threads && result == 0; i *= 2) {
+        double ns_per_call;
+        if (!measure(textures, num_textures, i, calls, &ns_per_call)) {
+            result = 1;
+        } else {
+            SDL_Log("    SDL_GetTextureSize, %2d thread%s %7.1f ns/call overall", i, (i == 1) ? " " : "s", ns_per_call);
+        }
+    }
+
+    if (result == 0 && SDL_strcmp(checks, "2") == 0 && !check_invalid_handles(renderer)) {
+        result = 1;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_textures; ++i) {
+        SDL_DestroyTexture(textures[i]);
+        textures[i] = NULL;
+    }
+    destroy_ns = (double)(SDL_GetTicksNS() - start) / num_textures;
+    SDL_Log("    destroy %.1f ns/texture", destroy_ns);
+
+done:
+    if (textures) {
+        for (i = 0; i < num_textures; ++i) {
+            SDL_DestroyTexture(textures[i]);
+        }
+    }
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(surface);
+    SDL_free(textures);
+    SDL_Quit();
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_textures = 10000;
+    int max_threads = 8;
+    int calls = 2000000;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--textures") == 0 && argv[i + 1]) {
+                num_textures = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--calls") == 0 && argv[i + 1]) {
+                calls = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--max-threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_THREADS);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--textures N]", "[--calls N]", "[--max-threads N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    result |= run("1", num_textures, max_threads, calls);
+    result |= run("2", num_textures, max_threads, calls);
+
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
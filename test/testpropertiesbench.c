@@ -0,0 +1,211 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures property lookups from several reader threads, by name and by
+   atom, with and without another thread setting and clearing properties in
+   the same group, and checks that readers only ever see values that were
+   actually set. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_READERS 16
+#define NUM_NAMES 16
+#define NUM_WRITER_NAMES 64
+
+static char names[NUM_NAMES][32];
+static SDL_PropertyAtom atoms[NUM_NAMES];
+static SDL_PropertyAtom pointer_atom;
+static char writer_names[NUM_WRITER_NAMES][32];
+
+/* The writer flips this property between the two, readers should never see anything else */
+#define POINTER_NAME "bench.pointer"
+static int pointer_a, pointer_b;
+
+typedef struct Reader
+{
+    SDL_Thread *thread;
+    SDL_PropertiesID props;
+    bool by_atom;
+    int lookups;
+    int failures;
+} Reader;
+
+static SDL_AtomicInt start_flag;
+static SDL_AtomicInt stop_flag;
+
+static int SDLCALL reader_thread(void *data)
+{
+    Reader *reader = (Reader *)data;
+    const SDL_PropertiesID props = reader->props;
+    int i = 0;
+
+    while (!SDL_GetAtomicInt(&start_flag)) {
+        SDL_Delay(0);
+    }
+    while (!SDL_GetAtomicInt(&stop_flag)) {
+        const int index = i % NUM_NAMES;
+        Sint64 number;
+        void *pointer;
+
+        if (reader->by_atom) {
+            number = SDL_GetNumberPropertyByAtom(props, atoms[index], -1);
+            pointer = SDL_GetPointerPropertyByAtom(props, pointer_atom, NULL);
+        } else {
+            number = SDL_GetNumberProperty(props, names[index], -1);
+            pointer = SDL_GetPointerProperty(props, POINTER_NAME, NULL);
+        }
+        if (number != index * 1000 || (pointer != &pointer_a && pointer != &pointer_b)) {
+            ++reader->failures;
+        }
+        reader->lookups += 2;
+        ++i;
+    }
+    return 0;
+}
+
+static int run(int num_readers, bool by_atom, bool with_writer, int milliseconds)
+{
+    Reader readers[MAX_READERS];
+    SDL_PropertiesID props;
+    Uint64 start, elapsed;
+    int writes = 0;
+    int lookups = 0;
+    int result = 0;
+    int i;
+
+    props = SDL_CreateProperties();
+    if (!props) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create properties: %s", SDL_GetError());
+        return 1;
+    }
+    for (i = 0; i < NUM_NAMES; ++i) {
+        SDL_SetNumberProperty(props, names[i], i * 1000);
+    }
+    SDL_SetPointerProperty(props, POINTER_NAME, &pointer_a);
+
+    SDL_SetAtomicInt(&start_flag, 0);
+    SDL_SetAtomicInt(&stop_flag, 0);
+    for (i = 0; i < num_readers; ++i) {
+        SDL_zero(readers[i]);
+        readers[i].props = props;
+        readers[i].by_atom = by_atom;
+        readers[i].thread = SDL_CreateThread(reader_thread, "Reader", &readers[i]);
+        if (!readers[i].thread) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+            num_readers = i;
+            result = 1;
+            break;
+        }
+    }
+
+    /* This thread is the writer, or just waits if there isn't one */
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&start_flag, 1);
+    while ((SDL_GetTicksNS() - start) < SDL_MS_TO_NS(milliseconds)) {
+        if (!with_writer) {
+            SDL_Delay(1);
+            continue;
+        }
+        /* Add and remove other properties, so entries move around the group */
+        if ((writes / NUM_WRITER_NAMES) % 2 == 0) {
+            SDL_SetNumberProperty(props, writer_names[writes % NUM_WRITER_NAMES], writes);
+        } else {
+            SDL_ClearProperty(props, writer_names[writes % NUM_WRITER_NAMES]);
+        }
+        SDL_SetPointerProperty(props, POINTER_NAME, (writes % 2) ? &pointer_a : &pointer_b);
+        writes += 1;
+    }
+    SDL_SetAtomicInt(&stop_flag, 1);
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < num_readers; ++i) {
+        SDL_WaitThread(readers[i].thread, NULL);
+        lookups += readers[i].lookups;
+        if (readers[i].failures) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Reader %d: %d lookups returned the wrong value", i, readers[i].failures);
+            result = 1;
+        }
+    }
+    SDL_DestroyProperties(props);
+
+    if (result == 0) {
+        const double seconds = (double)elapsed / SDL_NS_PER_SECOND;
+        if (with_writer) {
+            SDL_Log("%2d readers, by %-4s + 1 writer: %8.2f M lookups/s, %7.2f M writes/s",
+                    num_readers, by_atom ? "atom" : "name",
+                    (double)lookups / seconds / 1000000.0, (double)writes * 2 / seconds / 1000000.0);
+        } else {
+            SDL_Log("%2d readers, by %-4s, no writer: %8.2f M lookups/s",
+                    num_readers, by_atom ? "atom" : "name", (double)lookups / seconds / 1000000.0);
+        }
+    }
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int max_readers = 8;
+    int milliseconds = 500;
+    int result = 0;
+    int i, n;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--max-readers") == 0 && argv[i + 1]) {
+                max_readers = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_READERS);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--milliseconds") == 0 && argv[i + 1]) {
+                milliseconds = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--max-readers N]", "[--milliseconds N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    for (i = 0; i < NUM_NAMES; ++i) {
+        (void)SDL_snprintf(names[i], sizeof(names[i]), "bench.number.%d", i);
+        atoms[i] = SDL_GetPropertyAtom(names[i]);
+    }
+    for (i = 0; i < NUM_WRITER_NAMES; ++i) {
+        (void)SDL_snprintf(writer_names[i], sizeof(writer_names[i]), "bench.writer.%d", i);
+    }
+    pointer_atom = SDL_GetPropertyAtom(POINTER_NAME);
+    if (!pointer_atom || !atoms[0]) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't get property atoms: %s", SDL_GetError());
+        return 1;
+    }
+
+    for (n = 1; n <= max_readers && result == 0; n *= 2) {
+        result |= run(n, false, false, milliseconds);
+        result |= run(n, true, false, milliseconds);
+        result |= run(n, false, true, milliseconds);
+        result |= run(n, true, true, milliseconds);
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,323 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how the time to build a frame scales with the number of threads
+   recording it. Every frame draws a field of spinning quads. The quads are
+   split between worker threads, each working out the vertices of its quads
+   and recording them into its own SDL_RenderCommandList, then the main thread
+   submits the lists in order and presents. Runs with 1, 2, 4... threads up to
+   the number of cores, and checks that every run draws exactly the same. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_THREADS 64
+#define BATCH_OBJECTS 256
+#define OBJECT_SIZE 6.0f
+
+typedef struct Worker
+{
+    SDL_Thread *thread;
+    SDL_Semaphore *start;
+    SDL_Semaphore *done;
+    SDL_RenderCommandList *list;
+    int first_object;
+    int num_objects;
+    bool result;
+} Worker;
+
+static SDL_Renderer *renderer;
+static Worker workers[MAX_THREADS];
+static SDL_AtomicInt quit_workers;
+static int num_objects;
+static int work;
+static int frame;
+static int viewport_w;
+static int viewport_h;
+
+/* A fixed pseudo-random number for each object, so every run draws the same scene */
+static Uint32 object_hash(Uint32 x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+/* Stands in for the scene traversal, animation and culling an application does for each object */
+static float object_spin(Uint32 hash)
+{
+    float spin = (float)(hash & 0xFF) / 255.0f;
+    int i;
+
+    for (i = 0; i < work; ++i) {
+        spin = SDL_sinf(spin + 0.5f) * 0.5f + 0.5f;
+    }
+    return spin;
+}
+
+static bool record_objects(SDL_RenderCommandList *list, int first_object, int count)
+{
+    SDL_Vertex vertices[BATCH_OBJECTS * 4];
+    int indices[BATCH_OBJECTS * 6];
+    int i, j;
+
+    for (i = 0; i < count; i += BATCH_OBJECTS) {
+        const int batch = SDL_min(count - i, BATCH_OBJECTS);
+
+        for (j = 0; j < batch; ++j) {
+            const Uint32 hash = object_hash((Uint32)(first_object + i + j));
+            const float x = (float)(hash % (Uint32)viewport_w);
+            const float y = (float)((hash >> 12) % (Uint32)viewport_h);
+            const float angle = (frame * 0.05f) + object_spin(hash) * SDL_PI_F * 2.0f;
+            const float c = SDL_cosf(angle) * OBJECT_SIZE;
+            const float s = SDL_sinf(angle) * OBJECT_SIZE;
+            SDL_Vertex *v = &vertices[j * 4];
+            int *index = &indices[j * 6];
+            int k;
+
+            v[0].position.x = x - c + s;
+            v[0].position.y = y - s - c;
+            v[1].position.x = x + c + s;
+            v[1].position.y = y + s - c;
+            v[2].position.x = x + c - s;
+            v[2].position.y = y + s + c;
+            v[3].position.x = x - c - s;
+            v[3].position.y = y - s + c;
+            for (k = 0; k < 4; ++k) {
+                v[k].color.r = (float)((hash >> 4) & 0xFF) / 255.0f;
+                v[k].color.g = (float)((hash >> 12) & 0xFF) / 255.0f;
+                v[k].color.b = (float)((hash >> 20) & 0xFF) / 255.0f;
+                v[k].color.a = 1.0f;
+                v[k].tex_coord.x = 0.0f;
+                v[k].tex_coord.y = 0.0f;
+            }
+
+            index[0] = j * 4 + 0;
+            index[1] = j * 4 + 1;
+            index[2] = j * 4 + 2;
+            index[3] = j * 4 + 0;
+            index[4] = j * 4 + 2;
+            index[5] = j * 4 + 3;
+        }
+
+        if (!SDL_RecordRenderGeometry(list, NULL, vertices, batch * 4, indices, batch * 6)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int SDLCALL worker_thread(void *data)
+{
+    Worker *worker = (Worker *)data;
+
+    for (;;) {
+        SDL_WaitSemaphore(worker->start);
+        if (SDL_GetAtomicInt(&quit_workers)) {
+            break;
+        }
+        worker->result = record_objects(worker->list, worker->first_object, worker->num_objects);
+        SDL_SignalSemaphore(worker->done);
+    }
+    return 0;
+}
+
+static Uint32 frame_crc(void)
+{
+    SDL_Surface *surface = SDL_RenderReadPixels(renderer, NULL);
+    SDL_Surface *converted;
+    Uint32 crc = 0;
+
+    if (!surface) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't read pixels: %s", SDL_GetError());
+        return 0;
+    }
+    converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_XRGB8888);
+    SDL_DestroySurface(surface);
+    if (converted) {
+        SDLTest_Crc32Context context;
+        int y;
+
+        SDLTest_Crc32Init(&context);
+        SDLTest_Crc32CalcStart(&context, &crc);
+        for (y = 0; y < converted->h; ++y) {
+            SDLTest_Crc32CalcBuffer(&context, (CrcUint8 *)converted->pixels + y * converted->pitch, converted->w * 4, &crc);
+        }
+        SDLTest_Crc32CalcEnd(&context, &crc);
+        SDLTest_Crc32Done(&context);
+        SDL_DestroySurface(converted);
+    }
+    return crc;
+}
+
+static int run_case(int num_threads, int num_frames, double *record_ms, double *frame_ms, Uint32 *crc)
+{
+    Uint64 record_ns = 0;
+    Uint64 start = SDL_GetTicksNS();
+    int i;
+
+    for (i = 0; i < num_threads; ++i) {
+        workers[i].first_object = (int)((Sint64)num_objects * i / num_threads);
+        workers[i].num_objects = (int)((Sint64)num_objects * (i + 1) / num_threads) - workers[i].first_object;
+    }
+
+    for (frame = 0; frame < num_frames; ++frame) {
+        const Uint64 record_start = SDL_GetTicksNS();
+
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
+        SDL_RenderClear(renderer);
+
+        for (i = 0; i < num_threads; ++i) {
+            SDL_SignalSemaphore(workers[i].start);
+        }
+        for (i = 0; i < num_threads; ++i) {
+            SDL_WaitSemaphore(workers[i].done);
+        }
+        record_ns += SDL_GetTicksNS() - record_start;
+
+        for (i = 0; i < num_threads; ++i) {
+            if (!workers[i].result) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't record: %s", SDL_GetError());
+                return 1;
+            }
+            if (!SDL_SubmitRenderCommandList(workers[i].list)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't submit: %s", SDL_GetError());
+                return 1;
+            }
+        }
+
+        if (frame == num_frames - 1) {
+            *crc = frame_crc();
+        }
+        SDL_RenderPresent(renderer);
+    }
+
+    *record_ms = (double)record_ns / num_frames / SDL_NS_PER_MS;
+    *frame_ms = (double)(SDL_GetTicksNS() - start) / num_frames / SDL_NS_PER_MS;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int num_frames = 100;
+    int max_threads = -1;
+    double first_record_ms = 0.0;
+    Uint32 first_crc = 0;
+    int num_workers = 0;
+    int result = 0;
+    int num_threads;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, SDL_INIT_VIDEO);
+    if (!state) {
+        return 1;
+    }
+
+    num_objects = 20000;
+    work = 32;
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                num_frames = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--objects") == 0 && argv[i + 1]) {
+                num_objects = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--work") == 0 && argv[i + 1]) {
+                work = SDL_max(SDL_atoi(argv[i + 1]), 0);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_THREADS);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--frames N]", "[--objects N]", "[--work N]", "[--threads N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDLTest_CommonInit(state)) {
+        return 1;
+    }
+    renderer = state->renderers[0];
+    SDL_GetCurrentRenderOutputSize(renderer, &viewport_w, &viewport_h);
+    viewport_w = SDL_max(viewport_w, 1);
+    viewport_h = SDL_max(viewport_h, 1);
+
+    if (max_threads < 0) {
+        max_threads = SDL_clamp(SDL_GetNumLogicalCPUCores(), 1, MAX_THREADS);
+    }
+
+    SDL_Log("Recording %d objects with the %s renderer", num_objects, SDL_GetRendererName(renderer));
+
+    SDL_SetAtomicInt(&quit_workers, 0);
+    for (i = 0; i < max_threads; ++i) {
+        Worker *worker = &workers[i];
+
+        worker->list = SDL_CreateRenderCommandList(renderer);
+        if (!worker->list) {
+            SDL_Log("Skipping, this renderer doesn't support command lists: %s", SDL_GetError());
+            goto done;
+        }
+        worker->start = SDL_CreateSemaphore(0);
+        worker->done = SDL_CreateSemaphore(0);
+        worker->thread = SDL_CreateThread(worker_thread, "recorder", worker);
+        if (!worker->start || !worker->done || !worker->thread) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't start worker: %s", SDL_GetError());
+            result = 1;
+            goto done;
+        }
+        ++num_workers;
+    }
+
+    for (num_threads = 1; num_threads <= max_threads; num_threads = (num_threads == max_threads) ? max_threads + 1 : SDL_min(num_threads * 2, max_threads)) {
+        double record_ms = 0.0, frame_ms = 0.0;
+        Uint32 crc = 0;
+
+        if (run_case(num_threads, num_frames, &record_ms, &frame_ms, &crc) != 0) {
+            result = 1;
+            break;
+        }
+        if (num_threads == 1) {
+            first_record_ms = record_ms;
+            first_crc = crc;
+        } else if (crc != first_crc) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d threads drew a different frame, crc 0x%08" SDL_PRIx32 " instead of 0x%08" SDL_PRIx32, num_threads, crc, first_crc);
+            result = 1;
+        }
+        SDL_Log("%2d threads: %8.3f ms per frame, %8.3f ms recording, %5.2fx faster recording",
+                num_threads, frame_ms, record_ms, (record_ms > 0.0) ? first_record_ms / record_ms : 0.0);
+    }
+
+done:
+    SDL_SetAtomicInt(&quit_workers, 1);
+    for (i = 0; i < num_workers; ++i) {
+        SDL_SignalSemaphore(workers[i].start);
+        SDL_WaitThread(workers[i].thread, NULL);
+    }
+    for (i = 0; i < max_threads; ++i) {
+        SDL_DestroySemaphore(workers[i].start);
+        SDL_DestroySemaphore(workers[i].done);
+        SDL_DestroyRenderCommandList(workers[i].list);
+    }
+    SDLTest_CommonQuit(state);
+    return result;
+}
@@ -0,0 +1,256 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Reports the throughput of each audio stream resampler quality, along
+   with how well it rejects frequencies that would alias: a tone above the
+   output Nyquist frequency when downsampling, or the image of a tone near
+   the input Nyquist frequency when upsampling. Also checks that a tone in
+   the passband comes through at the right level. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct Quality
+{
+    const char *name;
+    SDL_AudioResampleQuality quality;
+    double min_attenuation_db; /* for downsampling */
+} Quality;
+
+static const Quality qualities[] = {
+    { "low", SDL_AUDIO_RESAMPLE_QUALITY_LOW, 0.0 },
+    { "medium", SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 0.0 },
+    { "high", SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 90.0 }
+};
+
+typedef struct Ratio
+{
+    int src_freq;
+    int dst_freq;
+} Ratio;
+
+/* 22050 <-> 48000 don't have their own polyphase filters */
+static const Ratio ratios[] = {
+    { 44100, 48000 },
+    { 48000, 44100 },
+    { 16000, 48000 },
+    { 48000, 16000 },
+    { 22050, 48000 },
+    { 48000, 22050 }
+};
+
+static SDL_AudioStream *create_stream(const Ratio *ratio, int channels, const Quality *quality)
+{
+    const SDL_AudioSpec src_spec = { SDL_AUDIO_F32, channels, ratio->src_freq };
+    const SDL_AudioSpec dst_spec = { SDL_AUDIO_F32, channels, ratio->dst_freq };
+    SDL_AudioStream *stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+
+    if (!stream || !SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, quality->quality)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create audio stream: %s", SDL_GetError());
+        SDL_DestroyAudioStream(stream);
+        return NULL;
+    }
+    return stream;
+}
+
+/* Resamples all of `src` in one go, returns the number of output frames */
+static int resample(SDL_AudioStream *stream, const float *src, int src_frames, float *dst, int dst_frames, int channels)
+{
+    const int frame_size = channels * (int)sizeof(float);
+    int total = 0;
+
+    if (!SDL_PutAudioStreamData(stream, src, src_frames * frame_size) || !SDL_FlushAudioStream(stream)) {
+        return -1;
+    }
+    while (total < dst_frames) {
+        const int len = SDL_GetAudioStreamData(stream, dst + total * channels, SDL_min(dst_frames - total, 1024) * frame_size);
+        if (len <= 0) {
+            break;
+        }
+        total += len / frame_size;
+    }
+    return total;
+}
+
+/* Amplitude of a tone at `freq` in `buf`, using a Hann window to keep the rest of the signal from leaking in */
+static double measure_tone(const float *buf, int frames, double freq, int sample_rate)
+{
+    const double w = 2.0 * SDL_PI_D * freq / sample_rate;
+    double re = 0.0, im = 0.0, window_sum = 0.0;
+    int i;
+
+    for (i = 0; i < frames; ++i) {
+        const double window = 0.5 - 0.5 * SDL_cos(2.0 * SDL_PI_D * i / (frames - 1));
+        re += buf[i] * window * SDL_cos(w * i);
+        im -= buf[i] * window * SDL_sin(w * i);
+        window_sum += window;
+    }
+    return 2.0 * SDL_sqrt(re * re + im * im) / window_sum;
+}
+
+/* Resamples one second of a sine wave at `freq`, and measures the amplitude of `measure_freq` in the output */
+static double resample_tone(const Ratio *ratio, const Quality *quality, double freq, double measure_freq)
+{
+    const int src_frames = ratio->src_freq;
+    const int dst_frames = ratio->dst_freq;
+    /* Skip where the filter is ramping up and down at either end */
+    const int skip = dst_frames / 10;
+    SDL_AudioStream *stream = create_stream(ratio, 1, quality);
+    float *src = (float *)SDL_malloc(src_frames * sizeof(float));
+    float *dst = (float *)SDL_malloc(dst_frames * sizeof(float));
+    double amplitude = -1.0;
+    int i;
+
+    if (stream && src && dst) {
+        for (i = 0; i < src_frames; ++i) {
+            src[i] = (float)SDL_sin(2.0 * SDL_PI_D * freq * i / ratio->src_freq);
+        }
+        if (resample(stream, src, src_frames, dst, dst_frames, 1) == dst_frames) {
+            amplitude = measure_tone(dst + skip, dst_frames - skip * 2, measure_freq, ratio->dst_freq);
+        }
+    }
+
+    SDL_DestroyAudioStream(stream);
+    SDL_free(src);
+    SDL_free(dst);
+    return amplitude;
+}
+
+static double to_db(double amplitude)
+{
+    return 20.0 * SDL_log10(SDL_max(amplitude, 1e-12));
+}
+
+static int check_quality(const Ratio *ratio, const Quality *quality, double *out_attenuation_db)
+{
+    const double passband_freq = 1000.0;
+    const double passband_db = to_db(resample_tone(ratio, quality, passband_freq, passband_freq));
+    double tone_freq, alias_freq;
+
+    if (SDL_fabs(passband_db) > 0.1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d -> %d, %s: %.0fHz came out at %.2fdB",
+                     ratio->src_freq, ratio->dst_freq, quality->name, passband_freq, passband_db);
+        return 1;
+    }
+
+    if (ratio->dst_freq < ratio->src_freq) {
+        /* Halfway between the output Nyquist frequency and the highest frequency it can alias from */
+        tone_freq = (ratio->dst_freq * 0.5 + SDL_min(ratio->src_freq * 0.5, ratio->dst_freq)) * 0.5;
+        alias_freq = ratio->dst_freq - tone_freq;
+    } else {
+        /* The image of a tone at 90% of the input Nyquist frequency */
+        tone_freq = ratio->src_freq * 0.45;
+        alias_freq = ratio->src_freq - tone_freq;
+        if (alias_freq > ratio->dst_freq * 0.5) {
+            alias_freq = ratio->dst_freq - alias_freq;
+        }
+    }
+
+    *out_attenuation_db = -to_db(resample_tone(ratio, quality, tone_freq, alias_freq));
+
+    if (ratio->dst_freq < ratio->src_freq && *out_attenuation_db < quality->min_attenuation_db) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d -> %d, %s: only %.1fdB stopband attenuation, expected %.1fdB",
+                     ratio->src_freq, ratio->dst_freq, quality->name, *out_attenuation_db, quality->min_attenuation_db);
+        return 1;
+    }
+    return 0;
+}
+
+/* Output frames per second, resampling `seconds` of stereo noise */
+static double bench_quality(const Ratio *ratio, const Quality *quality, int seconds, Uint64 *seed)
+{
+    const int channels = 2;
+    const int src_frames = ratio->src_freq;
+    const int dst_frames = ratio->dst_freq + 1;
+    SDL_AudioStream *stream = create_stream(ratio, channels, quality);
+    float *src = (float *)SDL_malloc(src_frames * channels * sizeof(float));
+    float *dst = (float *)SDL_malloc(dst_frames * channels * sizeof(float));
+    Uint64 elapsed = 0;
+    Sint64 frames = 0;
+    int i;
+
+    if (stream && src && dst) {
+        for (i = 0; i < src_frames * channels; ++i) {
+            src[i] = SDL_randf_r(seed) - 0.5f;
+        }
+        for (i = 0; i < seconds; ++i) {
+            const Uint64 start = SDL_GetTicksNS();
+            const int len = resample(stream, src, src_frames, dst, dst_frames, channels);
+            elapsed += SDL_GetTicksNS() - start;
+            if (len < 0) {
+                frames = 0;
+                break;
+            }
+            frames += len;
+            SDL_ClearAudioStream(stream);
+        }
+    }
+
+    SDL_DestroyAudioStream(stream);
+    SDL_free(src);
+    SDL_free(dst);
+    return elapsed ? (double)frames * SDL_NS_PER_SECOND / elapsed : 0.0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint64 seed = 0;
+    int seconds = 10;
+    int result = 0;
+    int i, j;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--seconds") == 0 && argv[i + 1]) {
+                seconds = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--seconds N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(ratios); ++i) {
+        for (j = 0; j < (int)SDL_arraysize(qualities); ++j) {
+            double attenuation_db = 0.0;
+            double frames_per_second;
+
+            result |= check_quality(&ratios[i], &qualities[j], &attenuation_db);
+            frames_per_second = bench_quality(&ratios[i], &qualities[j], seconds, &seed);
+
+            SDL_Log("%5d -> %5d Hz, %-6s %7.2f Mframes/s (stereo), %6.1f dB %s rejection",
+                    ratios[i].src_freq, ratios[i].dst_freq, qualities[j].name, frames_per_second / 1e6,
+                    attenuation_db, (ratios[i].dst_freq < ratios[i].src_freq) ? "alias" : "image");
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
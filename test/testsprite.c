@@ -36,7 +36,12 @@ static SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
 static Uint64 next_fps_check;
 static Uint32 frames;
 static const int fps_check_delay = 5000;
+static Sint64 draw_commands;
+static Sint64 merged_draw_commands;
+static Sint64 dropped_state_commands;
+static Sint64 draw_calls;
 static int use_rendergeometry = 0;
+static bool use_batch;
 static bool suspend_when_occluded;
 
 /* Number of iterations to move sprites - used for visual tests. */
@@ -85,6 +90,7 @@ static void MoveSprites(SDL_Renderer *renderer, SDL_Texture *sprite)
     SDL_Rect viewport;
     SDL_FRect temp;
     SDL_FRect *position, *velocity;
+    SDL_PropertiesID props;
 
     /* Query the sizes */
     SDL_SetRenderViewport(renderer, NULL);
@@ -231,7 +237,10 @@ static void MoveSprites(SDL_Renderer *renderer, SDL_Texture *sprite)
     }
 
     /* Draw sprites */
-    if (use_rendergeometry == 0) {
+    if (use_batch) {
+        /* Queue all the sprites with a single call */
+        SDL_RenderTextureBatch(renderer, sprite, NULL, positions, NULL, NULL, NULL, num_sprites);
+    } else if (use_rendergeometry == 0) {
         for (i = 0; i < num_sprites; ++i) {
             position = &positions[i];
 
@@ -389,6 +398,13 @@ static void MoveSprites(SDL_Renderer *renderer, SDL_Texture *sprite)
 
     /* Update the screen! */
     SDL_RenderPresent(renderer);
+
+    /* Keep track of how many draws the renderer managed to join together */
+    props = SDL_GetRendererProperties(renderer);
+    draw_commands += SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_DRAW_COMMANDS_NUMBER, 0);
+    merged_draw_commands += SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_MERGED_DRAW_COMMANDS_NUMBER, 0);
+    dropped_state_commands += SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_DROPPED_STATE_COMMANDS_NUMBER, 0);
+    draw_calls += SDL_GetNumberProperty(props, SDL_PROP_RENDERER_STATS_DRAW_CALLS_NUMBER, 0);
 }
 
 SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
@@ -471,6 +487,9 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
                     }
                 }
                 consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--batch") == 0) {
+                use_batch = true;
+                consumed = 1;
             } else if (SDL_isdigit(*argv[i])) {
                 num_sprites = SDL_atoi(argv[i]);
                 consumed = 1;
@@ -487,6 +506,7 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
                 "[--suspend-when-occluded]",
                 "[--iterations N]",
                 "[--use-rendergeometry mode1|mode2]",
+                "[--batch]",
                 "[num_sprites]",
                 "[icon.bmp]",
                 NULL
@@ -590,9 +610,20 @@ SDL_AppResult SDL_AppIterate(void *appstate)
         /* Print out some timing information */
         const Uint64 then = next_fps_check - fps_check_delay;
         const double fps = ((double)frames * 1000) / (now - then);
-        SDL_Log("%2.2f frames per second", fps);
+        SDL_Log("%2.2f frames per second, %.0f sprites per second", fps, fps * num_sprites);
+        if (frames > 0) {
+            SDL_Log("%.1f draws per frame, %.1f after merging, %.1f state changes skipped, %.1f draw calls",
+                    (double)draw_commands / frames,
+                    (double)(draw_commands - merged_draw_commands) / frames,
+                    (double)dropped_state_commands / frames,
+                    (double)draw_calls / frames);
+        }
         next_fps_check = now + fps_check_delay;
         frames = 0;
+        draw_commands = 0;
+        merged_draw_commands = 0;
+        dropped_state_commands = 0;
+        draw_calls = 0;
     }
 
     return SDL_APP_CONTINUE;
@@ -0,0 +1,248 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Draws testsprite-style frames with the software renderer into an offscreen
+   surface with different values of SDL_HINT_RENDER_SOFTWARE_THREADS, reports
+   the frame rate, and checks that the tiled renderer produces exactly the
+   same pixels as a single thread. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define SPRITE_SIZE 48
+
+static const int thread_counts[] = { 1, 2, 4, 8 };
+
+static SDL_Texture *create_sprite(SDL_Renderer *renderer)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int x, y;
+
+    surface = SDL_CreateSurface(SPRITE_SIZE, SPRITE_SIZE, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        return NULL;
+    }
+    /* A soft edged disc, so blending has something to do */
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            const int dx = x - SPRITE_SIZE / 2;
+            const int dy = y - SPRITE_SIZE / 2;
+            const int d = SDL_max(0, (SPRITE_SIZE / 2) * (SPRITE_SIZE / 2) - (dx * dx + dy * dy));
+            const Uint32 a = (Uint32)SDL_min(255, d / 2);
+            row[x] = (a << 24) | ((Uint32)(x * 5) << 16) | ((Uint32)(y * 5) << 8) | 0x80;
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    return texture;
+}
+
+static void draw_frame(SDL_Renderer *renderer, SDL_Texture *sprite, int frame, int num_sprites, int width, int height)
+{
+    Uint64 seed = (Uint64)frame + 1;
+    SDL_Vertex verts[3];
+    SDL_FRect rect;
+    SDL_Rect clip;
+    int i;
+
+    SDL_SetRenderDrawColor(renderer, 0xA0, 0xA0, 0xA0, 0xFF);
+    SDL_RenderClear(renderer);
+
+    /* Sprites */
+    for (i = 0; i < num_sprites; ++i) {
+        rect.x = (float)SDL_rand_r(&seed, width + SPRITE_SIZE) - SPRITE_SIZE / 2;
+        rect.y = (float)SDL_rand_r(&seed, height + SPRITE_SIZE) - SPRITE_SIZE / 2;
+        rect.w = SPRITE_SIZE;
+        rect.h = SPRITE_SIZE;
+        SDL_SetTextureColorMod(sprite, (Uint8)(128 + i % 128), 255, (Uint8)(255 - i % 128));
+        SDL_RenderTexture(renderer, sprite, NULL, &rect);
+    }
+
+    /* Blended rectangles and points */
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    for (i = 0; i < 32; ++i) {
+        SDL_SetRenderDrawColor(renderer, (Uint8)(i * 8), 0x40, (Uint8)(255 - i * 8), 0x60);
+        rect.x = (float)SDL_rand_r(&seed, width);
+        rect.y = (float)SDL_rand_r(&seed, height);
+        rect.w = (float)SDL_rand_r(&seed, width / 4);
+        rect.h = (float)SDL_rand_r(&seed, height / 4);
+        SDL_RenderFillRect(renderer, &rect);
+        SDL_RenderPoint(renderer, rect.x, rect.y + rect.h);
+    }
+
+    /* Gradient triangles, one of them clipped */
+    for (i = 0; i < 8; ++i) {
+        int j;
+        for (j = 0; j < 3; ++j) {
+            verts[j].position.x = (float)SDL_rand_r(&seed, width);
+            verts[j].position.y = (float)SDL_rand_r(&seed, height);
+            verts[j].color.r = (j == 0) ? 1.0f : 0.0f;
+            verts[j].color.g = (j == 1) ? 1.0f : 0.0f;
+            verts[j].color.b = (j == 2) ? 1.0f : 0.0f;
+            verts[j].color.a = 0.75f;
+            verts[j].tex_coord.x = (j == 1) ? 1.0f : 0.0f;
+            verts[j].tex_coord.y = (j == 2) ? 1.0f : 0.0f;
+        }
+        if (i == 0) {
+            clip.x = width / 4;
+            clip.y = height / 4;
+            clip.w = width / 2;
+            clip.h = height / 2;
+            SDL_SetRenderClipRect(renderer, &clip);
+        }
+        SDL_RenderGeometry(renderer, (i & 1) ? sprite : NULL, verts, 3, NULL, 0);
+        if (i == 0) {
+            SDL_SetRenderClipRect(renderer, NULL);
+        }
+    }
+
+    /* Lines and a rotated sprite, which the tiled renderer draws on the rendering thread */
+    SDL_SetRenderDrawColor(renderer, 0xFF, 0xFF, 0x00, 0xC0);
+    SDL_RenderLine(renderer, 0.0f, 0.0f, (float)width - 1, (float)height - 1);
+    SDL_RenderLine(renderer, (float)width - 1, 0.0f, 0.0f, (float)height - 1);
+    rect.x = (float)(width / 2);
+    rect.y = (float)(height / 2);
+    rect.w = SPRITE_SIZE * 3;
+    rect.h = SPRITE_SIZE * 3;
+    SDL_RenderTextureRotated(renderer, sprite, NULL, &rect, frame * 7.0, NULL, SDL_FLIP_NONE);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+
+    SDL_RenderPresent(renderer);
+}
+
+static int run(int width, int height, int frames, int num_sprites, int max_threads)
+{
+    SDL_Surface *reference;
+    SDL_Surface *target;
+    int result = 0;
+    int i, frame;
+
+    reference = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    target = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    if (!reference || !target) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s", SDL_GetError());
+        result = 1;
+        goto done;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(thread_counts) && result == 0; ++i) {
+        const int num_threads = thread_counts[i];
+        SDL_Surface *surface = (num_threads == 1) ? reference : target;
+        SDL_Renderer *renderer;
+        SDL_Texture *sprite;
+        Uint64 start, elapsed;
+        char value[16];
+        int y;
+
+        if (num_threads > max_threads) {
+            break;
+        }
+        (void)SDL_snprintf(value, sizeof(value), "%d", num_threads);
+        SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, value);
+
+        renderer = SDL_CreateSoftwareRenderer(surface);
+        if (!renderer) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create renderer: %s", SDL_GetError());
+            result = 1;
+            break;
+        }
+        sprite = create_sprite(renderer);
+        if (!sprite) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create texture: %s", SDL_GetError());
+            SDL_DestroyRenderer(renderer);
+            result = 1;
+            break;
+        }
+        SDL_SetTextureBlendMode(sprite, SDL_BLENDMODE_BLEND);
+
+        start = SDL_GetTicksNS();
+        for (frame = 0; frame < frames; ++frame) {
+            draw_frame(renderer, sprite, frame, num_sprites, width, height);
+        }
+        elapsed = SDL_GetTicksNS() - start;
+
+        SDL_DestroyTexture(sprite);
+        SDL_DestroyRenderer(renderer);
+
+        if (surface != reference) {
+            for (y = 0; y < height; ++y) {
+                if (SDL_memcmp((Uint8 *)reference->pixels + y * reference->pitch, (Uint8 *)target->pixels + y * target->pitch, width * 4) != 0) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d threads: row %d differs from the single-threaded result", num_threads, y);
+                    result = 1;
+                    break;
+                }
+            }
+        }
+
+        SDL_Log("%dx%d, %d sprites, %d thread%s: %8.1f frames/s", width, height, num_sprites, num_threads, (num_threads == 1) ? " " : "s",
+                (double)frames / ((double)SDL_max(elapsed, 1) / SDL_NS_PER_SECOND));
+    }
+
+done:
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    SDL_DestroySurface(target);
+    SDL_DestroySurface(reference);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int width = 1920;
+    int height = 1080;
+    int frames = 100;
+    int num_sprites = 1000;
+    int max_threads = 8;
+    int result;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1] && argv[i + 2]) {
+                width = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                height = SDL_max(SDL_atoi(argv[i + 2]), 1);
+                consumed = 3;
+            } else if (SDL_strcmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                frames = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--sprites") == 0 && argv[i + 1]) {
+                num_sprites = SDL_max(SDL_atoi(argv[i + 1]), 0);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--max-threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--size W H]", "[--frames N]", "[--sprites N]", "[--max-threads N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    SDL_Log("%d logical CPU cores", SDL_GetNumLogicalCPUCores());
+    result = run(width, height, frames, num_sprites, max_threads);
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,177 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Stress test for the timer queue: lots of long-lived timers, add/cancel
+   churn on top of them, and a batch of short timers that must all fire. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NUM_SHORT_TIMERS 1000
+
+static SDL_AtomicInt long_fired;
+static SDL_AtomicInt short_fired;
+
+static Uint32 SDLCALL long_callback(void *userdata, SDL_TimerID timerID, Uint32 interval)
+{
+    (void)userdata;
+    (void)timerID;
+    (void)interval;
+    SDL_AddAtomicInt(&long_fired, 1);
+    return 0;
+}
+
+static Uint32 SDLCALL short_callback(void *userdata, SDL_TimerID timerID, Uint32 interval)
+{
+    (void)userdata;
+    (void)timerID;
+    (void)interval;
+    SDL_AddAtomicInt(&short_fired, 1);
+    return 0;
+}
+
+static double ns_per_op(Uint64 start, int ops)
+{
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+    return ops ? ((double)elapsed / (double)ops) : 0.0;
+}
+
+static int run_test(int num_timers, int churn, Uint64 *seed)
+{
+    SDL_TimerID *ids;
+    Uint64 start;
+    int i;
+    int result = 0;
+
+    ids = (SDL_TimerID *)SDL_malloc(num_timers * sizeof(*ids));
+    if (!ids) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        return 1;
+    }
+
+    SDL_SetAtomicInt(&long_fired, 0);
+    SDL_SetAtomicInt(&short_fired, 0);
+
+    /* These should never fire during the test. */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_timers; ++i) {
+        ids[i] = SDL_AddTimer(60 * 1000 + (i % 1000), long_callback, NULL);
+        if (!ids[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_AddTimer failed: %s", SDL_GetError());
+            num_timers = i;
+            result = 1;
+            break;
+        }
+    }
+    SDL_Log("%8d timers: add     %8.1f ns/timer", num_timers, ns_per_op(start, num_timers));
+
+    /* Cancel a random timer and replace it, over and over. */
+    start = SDL_GetTicksNS();
+    for (i = 0; (i < churn) && (num_timers > 0); ++i) {
+        const int which = SDL_rand_r(seed, num_timers);
+        if (!SDL_RemoveTimer(ids[which])) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_RemoveTimer failed: %s", SDL_GetError());
+            result = 1;
+        }
+        ids[which] = SDL_AddTimer(60 * 1000 + (i % 1000), long_callback, NULL);
+    }
+    SDL_Log("%8d timers: churn   %8.1f ns/cancel+add (%d iterations)", num_timers, ns_per_op(start, churn), churn);
+
+    /* With all of that in the queue, short timers still have to fire on time. */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < NUM_SHORT_TIMERS; ++i) {
+        if (!SDL_AddTimer(1 + (i % 50), short_callback, NULL)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_AddTimer failed: %s", SDL_GetError());
+            result = 1;
+        }
+    }
+    while ((SDL_GetAtomicInt(&short_fired) < NUM_SHORT_TIMERS) && ((SDL_GetTicksNS() - start) < SDL_NS_PER_SECOND * 10)) {
+        SDL_Delay(1);
+    }
+    if (SDL_GetAtomicInt(&short_fired) != NUM_SHORT_TIMERS) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of %d short timers fired", SDL_GetAtomicInt(&short_fired), NUM_SHORT_TIMERS);
+        result = 1;
+    } else {
+        SDL_Log("%8d timers: %d short timers (1-50ms) all fired after %.1f ms", num_timers, NUM_SHORT_TIMERS, (double)(SDL_GetTicksNS() - start) / SDL_NS_PER_MS);
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_timers; ++i) {
+        if (!SDL_RemoveTimer(ids[i])) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_RemoveTimer failed: %s", SDL_GetError());
+            result = 1;
+            break;
+        }
+    }
+    SDL_Log("%8d timers: remove  %8.1f ns/timer", num_timers, ns_per_op(start, num_timers));
+
+    if (SDL_GetAtomicInt(&long_fired) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d canceled timers fired anyway", SDL_GetAtomicInt(&long_fired));
+        result = 1;
+    }
+
+    SDL_free(ids);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    static const int default_counts[] = { 10000, 100000, 1000000 };
+    SDLTest_CommonState *state;
+    Uint64 seed = 0;
+    int num_timers = 0;
+    int churn = 100000;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--timers") == 0 && argv[i + 1]) {
+                num_timers = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--churn") == 0 && argv[i + 1]) {
+                churn = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--timers N]", "[--churn N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (num_timers > 0) {
+        result = run_test(num_timers, churn, &seed);
+    } else {
+        for (i = 0; i < (int)SDL_arraysize(default_counts); ++i) {
+            result |= run_test(default_counts[i], churn, &seed);
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,400 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Compares loading a whole .WAV file with SDL_LoadWAV_IO against streaming it
+   with SDL_OpenWAVStream_IO, for each supported encoding: the time until the
+   first period of audio is ready, the time to decode all of it, and the most
+   heap memory in use along the way. Also checks that both decode to the same
+   samples, including after seeking. The files are generated in memory, with
+   random data standing in for the audio. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define FREQ 48000
+#define CHANNELS 2
+#define PERIOD_FRAMES 1024
+#define ADPCM_BLOCK_SIZE 1024
+#define NUM_SEEKS 16
+
+typedef enum Encoding
+{
+    ENCODING_PCM16,
+    ENCODING_PCM24,
+    ENCODING_FLOAT,
+    ENCODING_ALAW,
+    ENCODING_MULAW,
+    ENCODING_MS_ADPCM,
+    ENCODING_IMA_ADPCM
+} Encoding;
+
+static const char *encoding_names[] = {
+    "16-bit PCM", "24-bit PCM", "float", "a-law", "mu-law", "MS ADPCM", "IMA ADPCM"
+};
+
+/* Heap tracking, to see how much memory each approach needs */
+static SDL_malloc_func real_malloc;
+static SDL_calloc_func real_calloc;
+static SDL_realloc_func real_realloc;
+static SDL_free_func real_free;
+static SDL_AtomicInt heap_used;
+static SDL_AtomicInt heap_peak;
+
+#define HEAP_HEADER 16
+
+static void *track_alloc(void *mem, size_t size)
+{
+    int used, peak;
+
+    if (!mem) {
+        return NULL;
+    }
+    *(size_t *)mem = size;
+    used = SDL_AddAtomicInt(&heap_used, (int)size) + (int)size;
+    do {
+        peak = SDL_GetAtomicInt(&heap_peak);
+    } while (used > peak && !SDL_CompareAndSwapAtomicInt(&heap_peak, peak, used));
+    return (Uint8 *)mem + HEAP_HEADER;
+}
+
+static void *SDLCALL tracked_malloc(size_t size)
+{
+    return track_alloc(real_malloc(size + HEAP_HEADER), size);
+}
+
+static void *SDLCALL tracked_calloc(size_t nmemb, size_t size)
+{
+    return track_alloc(real_calloc(1, nmemb * size + HEAP_HEADER), nmemb * size);
+}
+
+static void *SDLCALL tracked_realloc(void *ptr, size_t size)
+{
+    void *mem;
+
+    if (!ptr) {
+        return tracked_malloc(size);
+    }
+    ptr = (Uint8 *)ptr - HEAP_HEADER;
+    SDL_AddAtomicInt(&heap_used, -(int)*(size_t *)ptr);
+    mem = real_realloc(ptr, size + HEAP_HEADER);
+    if (!mem) {
+        SDL_AddAtomicInt(&heap_used, (int)*(size_t *)ptr);
+        return NULL;
+    }
+    return track_alloc(mem, size);
+}
+
+static void SDLCALL tracked_free(void *ptr)
+{
+    if (ptr) {
+        ptr = (Uint8 *)ptr - HEAP_HEADER;
+        SDL_AddAtomicInt(&heap_used, -(int)*(size_t *)ptr);
+        real_free(ptr);
+    }
+}
+
+static void reset_heap_peak(void)
+{
+    SDL_SetAtomicInt(&heap_peak, SDL_GetAtomicInt(&heap_used));
+}
+
+static int heap_peak_since(int baseline)
+{
+    return SDL_GetAtomicInt(&heap_peak) - baseline;
+}
+
+/* Writes a whole .WAV file of random data to `io` */
+static bool write_wav(SDL_IOStream *io, Encoding encoding, int frames, Uint64 *seed)
+{
+    static const Sint16 ms_coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+    Uint16 tag, bits, blockalign, extsize = 0, samplesperblock = 0;
+    Uint32 datalen;
+    int i, c;
+
+    switch (encoding) {
+    case ENCODING_PCM16:
+        tag = 1, bits = 16, blockalign = 2 * CHANNELS;
+        break;
+    case ENCODING_PCM24:
+        tag = 1, bits = 24, blockalign = 3 * CHANNELS;
+        break;
+    case ENCODING_FLOAT:
+        tag = 3, bits = 32, blockalign = 4 * CHANNELS;
+        break;
+    case ENCODING_ALAW:
+        tag = 6, bits = 8, blockalign = CHANNELS;
+        break;
+    case ENCODING_MULAW:
+        tag = 7, bits = 8, blockalign = CHANNELS;
+        break;
+    case ENCODING_MS_ADPCM:
+        tag = 2, bits = 4, blockalign = ADPCM_BLOCK_SIZE, extsize = 32;
+        samplesperblock = (ADPCM_BLOCK_SIZE - 7 * CHANNELS) * 8 / (4 * CHANNELS) + 2;
+        break;
+    default:
+        tag = 0x11, bits = 4, blockalign = ADPCM_BLOCK_SIZE, extsize = 2;
+        samplesperblock = (ADPCM_BLOCK_SIZE - 4 * CHANNELS) * 8 / (4 * CHANNELS) + 1;
+        break;
+    }
+
+    if (samplesperblock) {
+        datalen = (Uint32)((frames + samplesperblock - 1) / samplesperblock) * blockalign;
+    } else {
+        datalen = (Uint32)frames * blockalign;
+    }
+
+    SDL_WriteU32LE(io, 0x46464952); /* "RIFF" */
+    SDL_WriteU32LE(io, 4 + 8 + 18 + extsize + 8 + datalen);
+    SDL_WriteU32LE(io, 0x45564157); /* "WAVE" */
+    SDL_WriteU32LE(io, 0x20746D66); /* "fmt " */
+    SDL_WriteU32LE(io, 18 + extsize);
+    SDL_WriteU16LE(io, tag);
+    SDL_WriteU16LE(io, CHANNELS);
+    SDL_WriteU32LE(io, FREQ);
+    SDL_WriteU32LE(io, FREQ * blockalign / (samplesperblock ? samplesperblock : 1));
+    SDL_WriteU16LE(io, blockalign);
+    SDL_WriteU16LE(io, bits);
+    SDL_WriteU16LE(io, extsize);
+    if (encoding == ENCODING_MS_ADPCM) {
+        SDL_WriteU16LE(io, samplesperblock);
+        SDL_WriteU16LE(io, 7);
+        for (i = 0; i < 14; ++i) {
+            SDL_WriteS16LE(io, ms_coeffs[i]);
+        }
+    } else if (encoding == ENCODING_IMA_ADPCM) {
+        SDL_WriteU16LE(io, samplesperblock);
+    }
+    SDL_WriteU32LE(io, 0x61746164); /* "data" */
+    SDL_WriteU32LE(io, datalen);
+
+    if (encoding == ENCODING_FLOAT) {
+        for (i = 0; i < frames * CHANNELS; ++i) {
+            const float sample = SDL_randf_r(seed) * 2.0f - 1.0f;
+            Uint32 bits32;
+            SDL_memcpy(&bits32, &sample, sizeof(bits32));
+            SDL_WriteU32LE(io, bits32);
+        }
+    } else if (samplesperblock) {
+        /* Random nibbles are fine, but the block headers have to be in range */
+        Uint32 pos;
+        for (pos = 0; pos < datalen; pos += blockalign) {
+            Uint16 headersize;
+            if (encoding == ENCODING_MS_ADPCM) {
+                headersize = 7 * CHANNELS;
+                for (c = 0; c < CHANNELS; ++c) {
+                    SDL_WriteU8(io, (Uint8)SDL_rand_r(seed, 7));
+                }
+                for (c = 0; c < CHANNELS; ++c) {
+                    SDL_WriteU16LE(io, (Uint16)(16 + SDL_rand_r(seed, 1024)));
+                }
+                for (c = 0; c < CHANNELS * 2; ++c) {
+                    SDL_WriteU16LE(io, (Uint16)SDL_rand_bits_r(seed));
+                }
+            } else {
+                headersize = 4 * CHANNELS;
+                for (c = 0; c < CHANNELS; ++c) {
+                    SDL_WriteU16LE(io, (Uint16)SDL_rand_bits_r(seed));
+                    SDL_WriteU8(io, (Uint8)SDL_rand_r(seed, 89));
+                    SDL_WriteU8(io, 0);
+                }
+            }
+            for (i = headersize; i < blockalign; ++i) {
+                SDL_WriteU8(io, (Uint8)SDL_rand_bits_r(seed));
+            }
+        }
+    } else {
+        for (i = 0; i < (int)datalen; ++i) {
+            SDL_WriteU8(io, (Uint8)SDL_rand_bits_r(seed));
+        }
+    }
+
+    return SDL_GetIOStatus(io) != SDL_IO_STATUS_ERROR;
+}
+
+/* Reads `frames` sample frames from the stream, returns how many it got */
+static int read_frames(SDL_AudioStream *stream, Uint8 *buf, int frames, int frame_size)
+{
+    int total = 0;
+
+    while (total < frames) {
+        const int len = SDL_GetAudioStreamData(stream, buf + total * frame_size, (frames - total) * frame_size);
+        if (len <= 0) {
+            break;
+        }
+        total += len / frame_size;
+    }
+    return total;
+}
+
+static int run_case(Encoding encoding, int seconds, Uint64 *seed)
+{
+    const int frames = FREQ * seconds;
+    SDL_IOStream *file = SDL_IOFromDynamicMem();
+    const void *file_data = NULL;
+    Sint64 file_size = 0;
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream = NULL;
+    Uint8 *loaded = NULL;
+    Uint32 loaded_len = 0;
+    Uint8 *streamed = NULL;
+    int frame_size, total_frames, baseline, i;
+    int load_peak, stream_peak;
+    Uint64 start, load_first_ns, load_all_ns, stream_first_ns, stream_all_ns;
+    int result = 1;
+
+    if (!file || !write_wav(file, encoding, frames, seed)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't write WAVE file: %s", SDL_GetError());
+        goto done;
+    }
+    file_data = SDL_GetPointerProperty(SDL_GetIOProperties(file), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+    file_size = SDL_GetIOSize(file);
+
+    /* Load it all, then start playing */
+    baseline = SDL_GetAtomicInt(&heap_used);
+    reset_heap_peak();
+    start = SDL_GetTicksNS();
+    if (!SDL_LoadWAV_IO(SDL_IOFromConstMem(file_data, (size_t)file_size), true, &spec, &loaded, &loaded_len)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load WAVE file: %s", SDL_GetError());
+        goto done;
+    }
+    frame_size = SDL_AUDIO_FRAMESIZE(spec);
+    total_frames = (int)(loaded_len / frame_size);
+    streamed = (Uint8 *)SDL_malloc(PERIOD_FRAMES * frame_size);
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!streamed || !stream || !SDL_PutAudioStreamData(stream, loaded, (int)loaded_len) || !SDL_FlushAudioStream(stream)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't queue WAVE data: %s", SDL_GetError());
+        goto done;
+    }
+    read_frames(stream, streamed, PERIOD_FRAMES, frame_size);
+    load_first_ns = SDL_GetTicksNS() - start;
+    while (read_frames(stream, streamed, PERIOD_FRAMES, frame_size) > 0) {
+    }
+    load_all_ns = SDL_GetTicksNS() - start;
+    SDL_DestroyAudioStream(stream);
+    stream = NULL;
+    SDL_free(streamed);
+    streamed = NULL;
+    load_peak = heap_peak_since(baseline);
+
+    /* Stream it, a period at a time, checking it against what was loaded */
+    baseline = SDL_GetAtomicInt(&heap_used);
+    reset_heap_peak();
+    start = SDL_GetTicksNS();
+    stream = SDL_OpenWAVStream_IO(SDL_IOFromConstMem(file_data, (size_t)file_size), true, NULL);
+    streamed = (Uint8 *)SDL_malloc(PERIOD_FRAMES * frame_size);
+    if (!stream || !streamed) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open WAVE stream: %s", SDL_GetError());
+        goto done;
+    }
+    stream_first_ns = 0;
+    for (i = 0; i < total_frames;) {
+        const int got = read_frames(stream, streamed, PERIOD_FRAMES, frame_size);
+        if (!stream_first_ns) {
+            stream_first_ns = SDL_GetTicksNS() - start;
+        }
+        if (got <= 0) {
+            break;
+        }
+        if (SDL_memcmp(streamed, loaded + (size_t)i * frame_size, (size_t)SDL_min(got, total_frames - i) * frame_size) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: streamed data differs around frame %d", encoding_names[encoding], i);
+            goto done;
+        }
+        i += got;
+    }
+    stream_all_ns = SDL_GetTicksNS() - start;
+    stream_peak = heap_peak_since(baseline);
+    if (i != total_frames || read_frames(stream, streamed, PERIOD_FRAMES, frame_size) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: streamed %d frames, loaded %d", encoding_names[encoding], i, total_frames);
+        goto done;
+    }
+    if (SDL_GetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_WAV_FRAMES_NUMBER, 0) != total_frames) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: wrong number of frames reported", encoding_names[encoding]);
+        goto done;
+    }
+
+    /* Seek around, including into the middle of ADPCM blocks and right to the end */
+    for (i = 0; i < NUM_SEEKS; ++i) {
+        const int frame = (i == NUM_SEEKS - 1) ? total_frames : (int)SDL_rand_r(seed, total_frames);
+        const int expected = SDL_min(PERIOD_FRAMES, total_frames - frame);
+        int got;
+        if (!SDL_SeekWAVStream(stream, frame)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't seek: %s", SDL_GetError());
+            goto done;
+        }
+        got = read_frames(stream, streamed, PERIOD_FRAMES, frame_size);
+        if (got != expected || SDL_memcmp(streamed, loaded + (size_t)frame * frame_size, (size_t)got * frame_size) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: wrong data after seeking to frame %d", encoding_names[encoding], frame);
+            goto done;
+        }
+    }
+
+    SDL_Log("%-10s %4.1f MB file: first audio %8.3f ms loaded, %6.3f ms streamed; all audio %7.1f ms loaded, %7.1f ms streamed; peak heap %7.1f MB loaded, %6.1f KB streamed",
+            encoding_names[encoding], file_size / (1024.0 * 1024.0),
+            load_first_ns / 1e6, stream_first_ns / 1e6, load_all_ns / 1e6, stream_all_ns / 1e6,
+            load_peak / (1024.0 * 1024.0), stream_peak / 1024.0);
+    result = 0;
+
+done:
+    SDL_DestroyAudioStream(stream);
+    SDL_free(streamed);
+    SDL_free(loaded);
+    SDL_CloseIO(file);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint64 seed = 0;
+    int seconds = 60;
+    int result = 0;
+    int i;
+
+    /* Must come before anything is allocated */
+    SDL_GetOriginalMemoryFunctions(&real_malloc, &real_calloc, &real_realloc, &real_free);
+    SDL_SetMemoryFunctions(tracked_malloc, tracked_calloc, tracked_realloc, tracked_free);
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--seconds") == 0 && argv[i + 1]) {
+                seconds = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--seconds N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(encoding_names); ++i) {
+        result |= run_case((Encoding)i, seconds, &seed);
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}